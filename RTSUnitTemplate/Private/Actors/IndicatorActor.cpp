@@ -5,6 +5,7 @@
 
 #include "Characters/Unit/UnitBase.h"
 #include "Net/UnrealNetwork.h"
+#include "System/DamageIndicatorSubsystem.h"
 
 // Sets default values
 AIndicatorActor::AIndicatorActor(const FObjectInitializer& ObjectInitializer):Super(ObjectInitializer)
@@ -49,6 +50,14 @@ void AIndicatorActor::Tick(float DeltaTime)
 	LifeTime = LifeTime + DeltaTime;
 	if(LifeTime > MaxLifeTime)
 	{
+		if (bPooled)
+		{
+			if (UDamageIndicatorSubsystem* Indicators = GetWorld()->GetSubsystem<UDamageIndicatorSubsystem>())
+			{
+				Indicators->ReleaseIndicator(this);
+				return;
+			}
+		}
 		Destroy(true);
 	}else
 	{
@@ -87,3 +96,51 @@ void AIndicatorActor::Multicast_UpdateWidget_Implementation(float Damage, FLinea
 		}
 	}
 }
+
+void AIndicatorActor::ActivatePooled(const FVector& Location, float Damage, FLinearColor HighColor, FLinearColor LowColor, float ColorOffset)
+{
+	LifeTime = 0.f;
+	LastDamage = Damage;
+	SetActorLocation(Location);
+	SetActorHiddenInGame(false);
+	SetActorTickEnabled(true);
+
+	if (DamageIndicatorComp)
+	{
+		DamageIndicatorComp->SetWorldLocation(GetActorLocation() + DamageIndicatorCompLocation);
+		if (UDamageIndicator* DamageIndicator = Cast<UDamageIndicator>(DamageIndicatorComp->GetUserWidgetObject()))
+		{
+			DamageIndicator->SetDamage(Damage);
+			DamageIndicator->SetColour(HighColor, LowColor, ColorOffset);
+			DamageIndicator->ResetIndicator();
+		}
+	}
+}
+
+void AIndicatorActor::DeactivatePooled()
+{
+	SetActorTickEnabled(false);
+	SetActorHiddenInGame(true);
+
+	if (DamageIndicatorComp)
+	{
+		if (UDamageIndicator* DamageIndicator = Cast<UDamageIndicator>(DamageIndicatorComp->GetUserWidgetObject()))
+		{
+			DamageIndicator->StopUpdateTimer();
+		}
+	}
+}
+
+void AIndicatorActor::AddPooledDamage(float Damage)
+{
+	LastDamage += Damage;
+
+	if (DamageIndicatorComp)
+	{
+		if (UDamageIndicator* DamageIndicator = Cast<UDamageIndicator>(DamageIndicatorComp->GetUserWidgetObject()))
+		{
+			DamageIndicator->SetDamage(LastDamage);
+			DamageIndicator->UpdateIndicator();
+		}
+	}
+}
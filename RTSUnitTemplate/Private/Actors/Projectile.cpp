@@ -88,6 +88,21 @@ namespace
 		}
 		return Dir.Rotation();
 	}
+
+	float GetProjectileWorldZ(const AProjectile* Projectile)
+	{
+		// ISM instance if available, actor transform otherwise
+		FTransform InstanceXform;
+		if (Projectile->ISMComponent && Projectile->ISMComponent->IsValidInstance(Projectile->InstanceIndex))
+		{
+			Projectile->ISMComponent->GetInstanceTransform(Projectile->InstanceIndex, InstanceXform, /*bWorldSpace=*/true);
+		}
+		else
+		{
+			InstanceXform = Projectile->GetActorTransform();
+		}
+		return InstanceXform.GetLocation().Z;
+	}
 }
 
 // Sets default values
@@ -808,20 +823,7 @@ void AProjectile::Impact(AActor* ImpactTarget)
 	{
 		PiercedActors.Add(ImpactTarget);
 		
-		float NewDamage = Damage;
-		if (UseAttributeDamage)
-		{
-			NewDamage = ShootingUnit->Attributes->GetAttackDamage() - UnitToHit->Attributes->GetArmor();
-			
-			if(ShootingUnit->IsDoingMagicDamage)
-				NewDamage = ShootingUnit->Attributes->GetAttackDamage() - UnitToHit->Attributes->GetMagicResistance();
-		}else
-		{
-			NewDamage = Damage - UnitToHit->Attributes->GetArmor();
-			
-			if(ShootingUnit->IsDoingMagicDamage)
-				NewDamage = Damage - UnitToHit->Attributes->GetMagicResistance();
-		}
+		const float NewDamage = CalculateImpactDamage(ShootingUnit, UnitToHit, Damage, UseAttributeDamage);
 		
 		if(UnitToHit->Attributes->GetShield() <= 0)
 			UnitToHit->SetHealth_Implementation(UnitToHit->Attributes->GetHealth()-NewDamage);
@@ -843,32 +845,7 @@ void AProjectile::Impact(AActor* ImpactTarget)
 		{
 			UnitToHit->ActivateAbilityByInputID(UnitToHit->DefensiveAbilityID, UnitToHit->DefensiveAbilities);
 		}
-		// Spawn impact effects at the surface point so they are visible on large units/buildings
-		if (APerformanceUnit* PerfShooter = Cast<APerformanceUnit>(ShootingUnit))
-		{
-			FVector SurfaceLoc = ComputeImpactSurfaceXY(ShootingUnit, UnitToHit);
-			// Always use the projectile's world Z (ISM instance if available)
-			{
-				FTransform InstanceXform;
-				if (ISMComponent && ISMComponent->IsValidInstance(InstanceIndex))
-				{
-					ISMComponent->GetInstanceTransform(InstanceIndex, InstanceXform, /*bWorldSpace=*/true);
-				}
-				else
-				{
-					InstanceXform = GetActorTransform();
-				}
-				SurfaceLoc.Z = InstanceXform.GetLocation().Z;
-			}
-			const FVector FromLoc = ShootingUnit ? (Cast<AUnitBase>(ShootingUnit) ? Cast<AUnitBase>(ShootingUnit)->GetMassActorLocation() : ShootingUnit->GetActorLocation()) : SurfaceLoc;
-			const FRotator FaceRot = MakeFaceRotationXY(FromLoc, SurfaceLoc);
-			const float KillDelay = 2.0f;
-			PerfShooter->FireEffectsAtLocation(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, SurfaceLoc, KillDelay, FaceRot);
-		}
-		else
-		{
-			UnitToHit->FireEffects(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound);
-		}
+		FireImpactEffects(ShootingUnit, UnitToHit, ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, GetProjectileWorldZ(this));
 		SetNextBouncing(ShootingUnit, UnitToHit);
 		SetBackBouncing(ShootingUnit);
 
@@ -947,32 +924,7 @@ void AProjectile::ImpactHeal(AActor* ImpactTarget)
 		{
 			UnitToHit->ActivateAbilityByInputID(UnitToHit->DefensiveAbilityID, UnitToHit->DefensiveAbilities);
 		}
-		// Spawn impact effects at the surface point even for heals (so it's on the unit surface)
-		if (APerformanceUnit* PerfShooter = Cast<APerformanceUnit>(ShootingUnit))
-		{
-			FVector SurfaceLoc = ComputeImpactSurfaceXY(ShootingUnit, UnitToHit);
-			// Always use the projectile's world Z (ISM instance if available)
-			{
-				FTransform InstanceXform;
-				if (ISMComponent && ISMComponent->IsValidInstance(InstanceIndex))
-				{
-					ISMComponent->GetInstanceTransform(InstanceIndex, InstanceXform, /*bWorldSpace=*/true);
-				}
-				else
-				{
-					InstanceXform = GetActorTransform();
-				}
-				SurfaceLoc.Z = InstanceXform.GetLocation().Z;
-			}
-			const FVector FromLoc = ShootingUnit ? (Cast<AUnitBase>(ShootingUnit) ? Cast<AUnitBase>(ShootingUnit)->GetMassActorLocation() : ShootingUnit->GetActorLocation()) : SurfaceLoc;
-			const FRotator FaceRot = MakeFaceRotationXY(FromLoc, SurfaceLoc);
-			const float KillDelay = 2.0f;
-			PerfShooter->FireEffectsAtLocation(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, SurfaceLoc, KillDelay, FaceRot);
-		}
-		else
-		{
-			UnitToHit->FireEffects(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound);
-		}
+		FireImpactEffects(ShootingUnit, UnitToHit, ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, GetProjectileWorldZ(this));
 		SetNextBouncing(ShootingUnit, UnitToHit);
 		SetBackBouncing(ShootingUnit);
 		DestroyWhenMaxPierced();
@@ -1046,31 +998,7 @@ void AProjectile::OnOverlapBegin_Implementation(UPrimitiveComponent* OverlappedC
 		if(UnitToHit && UnitToHit->GetUnitState() == UnitData::Dead)
 		{
 			ImpactEvent();
-			if (APerformanceUnit* PerfShooter = Cast<APerformanceUnit>(ShootingUnit))
-			{
-				FVector SurfaceLoc = ComputeImpactSurfaceXY(ShootingUnit, UnitToHit);
-				// Always use the projectile's world Z (ISM instance if available)
-				{
-					FTransform InstanceXform;
-					if (ISMComponent && ISMComponent->IsValidInstance(InstanceIndex))
-					{
-						ISMComponent->GetInstanceTransform(InstanceIndex, InstanceXform, /*bWorldSpace=*/true);
-					}
-					else
-					{
-						InstanceXform = GetActorTransform();
-					}
-					SurfaceLoc.Z = InstanceXform.GetLocation().Z;
-				}
-				const FVector FromLoc = ShootingUnit ? (Cast<AUnitBase>(ShootingUnit) ? Cast<AUnitBase>(ShootingUnit)->GetMassActorLocation() : ShootingUnit->GetActorLocation()) : SurfaceLoc;
-				const FRotator FaceRot = MakeFaceRotationXY(FromLoc, SurfaceLoc);
-				const float KillDelay = 2.0f;
-				PerfShooter->FireEffectsAtLocation(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, SurfaceLoc, KillDelay, FaceRot);
-			}
-			else
-			{
-				UnitToHit->FireEffects(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound);
-			}
+			FireImpactEffects(ShootingUnit, UnitToHit, ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, GetProjectileWorldZ(this));
 			DestroyWhenMaxPierced();
 		}else if(UnitToHit && UnitToHit->TeamId == TeamId && BouncedBack && IsHealing)
 		{
@@ -1078,31 +1006,7 @@ void AProjectile::OnOverlapBegin_Implementation(UPrimitiveComponent* OverlappedC
 		}else if(UnitToHit && UnitToHit->TeamId == TeamId && BouncedBack && !IsHealing)
 		{
 			ImpactEvent();
-			if (APerformanceUnit* PerfShooter = Cast<APerformanceUnit>(ShootingUnit))
-			{
-				FVector SurfaceLoc = ComputeImpactSurfaceXY(ShootingUnit, UnitToHit);
-				// Always use the projectile's world Z (ISM instance if available)
-				{
-					FTransform InstanceXform;
-					if (ISMComponent && ISMComponent->IsValidInstance(InstanceIndex))
-					{
-						ISMComponent->GetInstanceTransform(InstanceIndex, InstanceXform, /*bWorldSpace=*/true);
-					}
-					else
-					{
-						InstanceXform = GetActorTransform();
-					}
-					SurfaceLoc.Z = InstanceXform.GetLocation().Z;
-				}
-				const FVector FromLoc = ShootingUnit ? (Cast<AUnitBase>(ShootingUnit) ? Cast<AUnitBase>(ShootingUnit)->GetMassActorLocation() : ShootingUnit->GetActorLocation()) : SurfaceLoc;
-				const FRotator FaceRot = MakeFaceRotationXY(FromLoc, SurfaceLoc);
-				const float KillDelay = 2.0f;
-				PerfShooter->FireEffectsAtLocation(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, SurfaceLoc, KillDelay, FaceRot);
-			}
-			else
-			{
-				UnitToHit->FireEffects(ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound);
-			}
+			FireImpactEffects(ShootingUnit, UnitToHit, ImpactVFX, ImpactSound, ScaleImpactVFX, ScaleImpactSound, GetProjectileWorldZ(this));
 			DestroyWhenMaxPierced();
 		}else if(UnitToHit && UnitToHit->TeamId != TeamId && !IsHealing)
 		{
@@ -1138,6 +1042,41 @@ void AProjectile::DestroyProjectile()
 
 
 void AProjectile::SetIsAttacked(AUnitBase* UnitToHit)
+{
+	ApplyIsAttacked(GetWorld(), UnitToHit);
+}
+
+float AProjectile::CalculateImpactDamage(const AUnitBase* ShootingUnit, const AUnitBase* UnitToHit, float BaseDamage, bool bUseAttributeDamage)
+{
+	const float SourceDamage = bUseAttributeDamage ? ShootingUnit->Attributes->GetAttackDamage() : BaseDamage;
+
+	if (ShootingUnit->IsDoingMagicDamage)
+	{
+		return SourceDamage - UnitToHit->Attributes->GetMagicResistance();
+	}
+	return SourceDamage - UnitToHit->Attributes->GetArmor();
+}
+
+void AProjectile::FireImpactEffects(AUnitBase* ShootingUnit, AUnitBase* UnitToHit, UNiagaraSystem* InImpactVFX, USoundBase* InImpactSound, const FVector& InScaleImpactVFX, float InScaleImpactSound, float ImpactZ)
+{
+	// Spawn impact effects at the surface point so they are visible on large units/buildings
+	if (APerformanceUnit* PerfShooter = Cast<APerformanceUnit>(ShootingUnit))
+	{
+		FVector SurfaceLoc = ComputeImpactSurfaceXY(ShootingUnit, UnitToHit);
+		// Always use the projectile's world Z
+		SurfaceLoc.Z = ImpactZ;
+		const FVector FromLoc = ShootingUnit->GetMassActorLocation();
+		const FRotator FaceRot = MakeFaceRotationXY(FromLoc, SurfaceLoc);
+		const float KillDelay = 2.0f;
+		PerfShooter->FireEffectsAtLocation(InImpactVFX, InImpactSound, InScaleImpactVFX, InScaleImpactSound, SurfaceLoc, KillDelay, FaceRot);
+	}
+	else if (UnitToHit)
+	{
+		UnitToHit->FireEffects(InImpactVFX, InImpactSound, InScaleImpactVFX, InScaleImpactSound);
+	}
+}
+
+void AProjectile::ApplyIsAttacked(UWorld* World, AUnitBase* UnitToHit)
 {
 	if(UnitToHit->GetUnitState() != UnitData::Run &&
 		UnitToHit->GetUnitState() != UnitData::Attack &&
@@ -1148,7 +1087,6 @@ void AProjectile::SetIsAttacked(AUnitBase* UnitToHit)
 		UnitToHit->UnitControlTimer = 0.f;
 		UnitToHit->SetUnitState( UnitData::IsAttacked );
 		
-		UWorld* World = GetWorld();
 				
 		if (!World) return;
 		
@@ -31,7 +31,7 @@ void ASelectionCircleActor::BeginPlay()
 {
     Super::BeginPlay();
     InitCircleMaskTexture();
-    GetWorldTimerManager().SetTimer(SelectionCircleUpdateTimerHandle, this, &ASelectionCircleActor::Multicast_ApplyCircleMask, SelectionCircleUpdateRate, true, 0.0f);
+    GetWorldTimerManager().SetTimer(SelectionCircleUpdateTimerHandle, this, &ASelectionCircleActor::ApplyCircleMask, SelectionCircleUpdateRate, true, 0.0f);
 }
 
 void ASelectionCircleActor::Tick(float DeltaTime)
@@ -54,14 +54,23 @@ void ASelectionCircleActor::InitCircleMaskTexture()
     CircleMaskTexture->UpdateResource();
 
     CirclePixels.Init(FColor::Transparent, CircleTexSize * CircleTexSize);
+    DrawnSquares.Reset();
+
+    // Start from a cleared texture; later uploads only touch the squares that changed
+    UploadCirclePixels({ FIntRect(0, 0, CircleTexSize, CircleTexSize) });
 }
 
 void ASelectionCircleActor::ApplyCircleMaskToMesh(UStaticMeshComponent* MeshComponent, UMaterialInterface* BaseMaterial, int32 MaterialIndex)
 {
     if (!MeshComponent || !BaseMaterial || !CircleMaskTexture) return;
     
-    MeshComponent->SetMaterial(MaterialIndex, BaseMaterial);
-    UMaterialInstanceDynamic* MID = MeshComponent->CreateDynamicMaterialInstance(MaterialIndex, BaseMaterial);
+    // Reuse the MID created by an earlier call instead of creating a new one
+    UMaterialInstanceDynamic* MID = Cast<UMaterialInstanceDynamic>(MeshComponent->GetMaterial(MaterialIndex));
+    if (!MID || MID->Parent != BaseMaterial)
+    {
+        MeshComponent->SetMaterial(MaterialIndex, BaseMaterial);
+        MID = MeshComponent->CreateDynamicMaterialInstance(MaterialIndex, BaseMaterial);
+    }
 
     if (MID)
     {
@@ -70,7 +79,7 @@ void ASelectionCircleActor::ApplyCircleMaskToMesh(UStaticMeshComponent* MeshComp
 }
 
 
-void ASelectionCircleActor::Multicast_ApplyCircleMask_Implementation()
+void ASelectionCircleActor::ApplyCircleMask()
 {
     UWorld* World = GetWorld();
     if (!World) return;
@@ -84,6 +93,7 @@ void ASelectionCircleActor::Multicast_ApplyCircleMask_Implementation()
             {
                 CircleMesh->SetHiddenInGame(false);
                 ApplyCircleMaskToMesh(CircleMesh, CircleMaterial, 0);
+                GetWorldTimerManager().ClearTimer(SelectionCircleUpdateTimerHandle);
             }
         }
     }
@@ -96,64 +106,143 @@ void ASelectionCircleActor::SetCircleBounds(const FVector2D& Min, const FVector2
     CircleMapMaxBounds = Max;
 }
 
-void ASelectionCircleActor::Multicast_UpdateSelectionCircles_Implementation(const TArray<FVector_NetQuantize>& Positions, const TArray<float>& WorldRadii)
+void ASelectionCircleActor::DrawSquareOutline(const FIntRect& Square, const FColor& Color)
 {
-    if (!CircleMaskTexture)
+    const int32 MinX = FMath::Max(0, Square.Min.X);
+    const int32 MaxX = FMath::Min(CircleTexSize - 1, Square.Max.X);
+    const int32 MinY = FMath::Max(0, Square.Min.Y);
+    const int32 MaxY = FMath::Min(CircleTexSize - 1, Square.Max.Y);
+    if (MinX > MaxX || MinY > MaxY)
     {
         return;
     }
 
-    // 1) Clear mask
-    FMemory::Memset(CirclePixels.GetData(), 0, CirclePixels.Num() * sizeof(FColor));
+    FColor* Pixels = CirclePixels.GetData();
+
+    // Top and bottom edge, only if they are inside the texture
+    for (const int32 Y : { Square.Min.Y, Square.Max.Y })
+    {
+        if (Y >= 0 && Y < CircleTexSize)
+        {
+            FColor* Row = Pixels + Y * CircleTexSize;
+            for (int32 X = MinX; X <= MaxX; ++X)
+            {
+                Row[X] = Color;
+            }
+        }
+    }
+
+    // Left and right edge
+    for (const int32 X : { Square.Min.X, Square.Max.X })
+    {
+        if (X >= 0 && X < CircleTexSize)
+        {
+            for (int32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                Pixels[Y * CircleTexSize + X] = Color;
+            }
+        }
+    }
+}
+
+void ASelectionCircleActor::UploadCirclePixels(const TArray<FIntRect>& DirtyRects)
+{
+    if (!CircleMaskTexture || DirtyRects.Num() == 0)
+    {
+        return;
+    }
+
+    // Many small regions cost more than one upload of their bounding box
+    constexpr int32 MaxUploadRegions = 32;
+    const int32 NumRegions = DirtyRects.Num() > MaxUploadRegions ? 1 : DirtyRects.Num();
+
+    // Owned by the render command and freed once the upload ran
+    FUpdateTextureRegion2D* Regions = new FUpdateTextureRegion2D[NumRegions];
+    if (NumRegions == 1)
+    {
+        FIntRect Bounds = DirtyRects[0];
+        for (const FIntRect& Rect : DirtyRects)
+        {
+            Bounds.Union(Rect);
+        }
+        Regions[0] = FUpdateTextureRegion2D(Bounds.Min.X, Bounds.Min.Y, Bounds.Min.X, Bounds.Min.Y, Bounds.Width(), Bounds.Height());
+    }
+    else
+    {
+        for (int32 i = 0; i < NumRegions; ++i)
+        {
+            const FIntRect& Rect = DirtyRects[i];
+            Regions[i] = FUpdateTextureRegion2D(Rect.Min.X, Rect.Min.Y, Rect.Min.X, Rect.Min.Y, Rect.Width(), Rect.Height());
+        }
+    }
+
+    CircleMaskTexture->UpdateTextureRegions(
+        0, NumRegions, Regions,
+        CircleTexSize * sizeof(FColor),
+        sizeof(FColor),
+        reinterpret_cast<uint8*>(CirclePixels.GetData()),
+        [](uint8* SrcData, const FUpdateTextureRegion2D* InRegions)
+        {
+            delete[] InRegions;
+        }
+    );
+}
+
+void ASelectionCircleActor::UpdateSelectionCircles_Local(const TArray<FVector>& Positions, const TArray<float>& WorldRadii)
+{
+    if (!CircleMaskTexture)
+    {
+        return;
+    }
 
-    // 2) Precompute
     const float WorldExtentX = CircleMapMaxBounds.X - CircleMapMinBounds.X;
     const float WorldExtentY = CircleMapMaxBounds.Y - CircleMapMinBounds.Y;
 
-    // 3) Loop over the arrays
     const int32 Count = FMath::Min(Positions.Num(), WorldRadii.Num());
+    TArray<FIntRect> NewSquares;
+    NewSquares.Reserve(Count);
     for (int32 i = 0; i < Count; ++i)
     {
-        // [MODIFIED] 3a) Compute pixel‐space center using integers for a "sharp" grid-snapped result.
-        const FVector WorldPos = Positions[i];
+        // Pixel-space center snapped to the grid for a sharp outline
+        const FVector& WorldPos = Positions[i];
         const float U = (WorldPos.X - CircleMapMinBounds.X) / WorldExtentX;
         const float V = (WorldPos.Y - CircleMapMinBounds.Y) / WorldExtentY;
         const int32 CenterX = FMath::Clamp(FMath::RoundToInt(U * CircleTexSize), 0, CircleTexSize - 1);
         const int32 CenterY = FMath::Clamp(FMath::RoundToInt(V * CircleTexSize), 0, CircleTexSize - 1);
 
-        // [MODIFIED] 3b) Compute the square's "half side" length from the world radius.
+        // The square's "half side" length from the world radius
         const int32 HalfSide = FMath::Clamp(FMath::RoundToInt((WorldRadii[i] / WorldExtentX) * CircleTexSize), 1, CircleTexSize - 1);
 
-        // 3c) Draw the 1px sharp square outline
-        // Define the bounding box for the loop for efficiency.
-        const int32 MinX = FMath::Max(0, CenterX - HalfSide);
-        const int32 MaxX = FMath::Min(CircleTexSize - 1, CenterX + HalfSide);
-        const int32 MinY = FMath::Max(0, CenterY - HalfSide);
-        const int32 MaxY = FMath::Min(CircleTexSize - 1, CenterY + HalfSide);
+        NewSquares.Emplace(CenterX - HalfSide, CenterY - HalfSide, CenterX + HalfSide, CenterY + HalfSide);
+    }
 
-        for (int32 Y = MinY; Y <= MaxY; ++Y)
-        {
-            FColor* Row = CirclePixels.GetData() + Y * CircleTexSize;
-            for (int32 X = MinX; X <= MaxX; ++X)
-            {
-                const int32 dX_abs = FMath::Abs(X - CenterX);
-                const int32 dY_abs = FMath::Abs(Y - CenterY);
-                
-                // [MODIFIED] Check if the pixel lies on the border of the square.
-                if ((dX_abs == HalfSide && dY_abs <= HalfSide) || (dY_abs == HalfSide && dX_abs <= HalfSide))
-                {
-                    Row[X] = FColor::White;
-                }
-            }
-        }
+    if (NewSquares == DrawnSquares)
+    {
+        return;
     }
 
-    // 4) Upload updated pixels to the GPU texture
-    FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, CircleTexSize, CircleTexSize);
-    CircleMaskTexture->UpdateTextureRegions(
-        0, 1, Region,
-        CircleTexSize * sizeof(FColor),
-        sizeof(FColor),
-        reinterpret_cast<uint8*>(CirclePixels.GetData())
-    );
-}
\ No newline at end of file
+    // Erase the previous outlines, then draw the new ones; upload only the touched squares
+    TArray<FIntRect> DirtyRects;
+    DirtyRects.Reserve(DrawnSquares.Num() + NewSquares.Num());
+
+    auto ToDirtyRect = [this](const FIntRect& Square)
+    {
+        return FIntRect(
+            FMath::Max(0, Square.Min.X), FMath::Max(0, Square.Min.Y),
+            FMath::Min(CircleTexSize - 1, Square.Max.X) + 1, FMath::Min(CircleTexSize - 1, Square.Max.Y) + 1);
+    };
+
+    for (const FIntRect& Square : DrawnSquares)
+    {
+        DrawSquareOutline(Square, FColor::Transparent);
+        DirtyRects.Add(ToDirtyRect(Square));
+    }
+    for (const FIntRect& Square : NewSquares)
+    {
+        DrawSquareOutline(Square, FColor::White);
+        DirtyRects.Add(ToDirtyRect(Square));
+    }
+
+    DrawnSquares = MoveTemp(NewSquares);
+    UploadCirclePixels(DirtyRects);
+}
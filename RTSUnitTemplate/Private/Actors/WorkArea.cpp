@@ -12,6 +12,7 @@
 #include "Widgets/UnitTimerWidget.h"
 #include "GameModes/ResourceGameMode.h"
 #include "Net/UnrealNetwork.h"
+#include "System/PlacementSpatialIndexSubsystem.h"
 
 
 // Sets default values
@@ -119,36 +120,7 @@ void AWorkArea::AddAreaToGroup_Implementation()
 
 	if(ResourceGameMode)
 	{
-		switch (Type)
-		{
-		case WorkAreaData::Primary:
-			ResourceGameMode->WorkAreaGroups.PrimaryAreas.Add(this);
-			break;
-		case WorkAreaData::Secondary:
-			ResourceGameMode->WorkAreaGroups.SecondaryAreas.Add(this);
-			break;
-		case WorkAreaData::Tertiary:
-			ResourceGameMode->WorkAreaGroups.TertiaryAreas.Add(this);
-			break;
-		case WorkAreaData::Rare:
-			ResourceGameMode->WorkAreaGroups.RareAreas.Add(this);
-			break;
-		case WorkAreaData::Epic:
-			ResourceGameMode->WorkAreaGroups.EpicAreas.Add(this);
-			break;
-		case WorkAreaData::Legendary:
-			ResourceGameMode->WorkAreaGroups.LegendaryAreas.Add(this);
-			break;
-		/*case WorkAreaData::Base:
-			ResourceGameMode->WorkAreaGroups.BaseAreas.Add(this);
-			break;*/
-		case WorkAreaData::BuildArea:
-			ResourceGameMode->WorkAreaGroups.BuildAreas.Add(this);
-			break;
-		default:
-			// Handle any cases not explicitly covered
-				break;
-		}
+		ResourceGameMode->AddWorkAreaToGroup(this);
 	}
 }
 
@@ -158,36 +130,7 @@ void AWorkArea::RemoveAreaFromGroup_Implementation()
 
 	if(ResourceGameMode)
 	{
-		switch (Type)
-		{
-		case WorkAreaData::Primary:
-			ResourceGameMode->WorkAreaGroups.PrimaryAreas.Remove(this);
-			break;
-		case WorkAreaData::Secondary:
-			ResourceGameMode->WorkAreaGroups.SecondaryAreas.Remove(this);
-			break;
-		case WorkAreaData::Tertiary:
-			ResourceGameMode->WorkAreaGroups.TertiaryAreas.Remove(this);
-			break;
-		case WorkAreaData::Rare:
-			ResourceGameMode->WorkAreaGroups.RareAreas.Remove(this);
-			break;
-		case WorkAreaData::Epic:
-			ResourceGameMode->WorkAreaGroups.EpicAreas.Remove(this);
-			break;
-		case WorkAreaData::Legendary:
-			ResourceGameMode->WorkAreaGroups.LegendaryAreas.Remove(this);
-			break;
-		/* case WorkAreaData::Base:
-			ResourceGameMode->WorkAreaGroups.BaseAreas.Remove(this);
-			break; */
-		case WorkAreaData::BuildArea:
-			ResourceGameMode->WorkAreaGroups.BuildAreas.Remove(this);
-			break;
-		default:
-			// Handle any cases not explicitly covered
-				break;
-		}
+		ResourceGameMode->RemoveWorkAreaFromGroup(this);
 	}
 }
 // Called every frame
@@ -231,6 +174,20 @@ void AWorkArea::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetim
 	DOREPLIFETIME(AWorkArea, Workers);
 }
 
+void AWorkArea::SetIsNoBuildZone(bool bNewIsNoBuildZone)
+{
+	IsNoBuildZone = bNewIsNoBuildZone;
+	OnRep_IsNoBuildZone();
+}
+
+void AWorkArea::OnRep_IsNoBuildZone()
+{
+	if (UPlacementSpatialIndexSubsystem* PlacementIndex = GetWorld() ? GetWorld()->GetSubsystem<UPlacementSpatialIndexSubsystem>() : nullptr)
+	{
+		PlacementIndex->NotifyNoBuildZoneChanged(this);
+	}
+}
+
 void AWorkArea::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
     // Early return if OtherActor is not a AWorkingUnitBase
@@ -330,6 +287,7 @@ void AWorkArea::SwitchResourceArea(AWorkingUnitBase* Worker, AUnitBase* UnitBase
 			ResourceGameMode->AddCurrentWorkersForResourceType(UnitBase->TeamId, ConvertToResourceType(NewResourcePlace->Type), +1.0f);
 		}
 		UnitBase->ResourcePlace = NewResourcePlace;
+		ResourceGameMode->UpdateWorkerAssignment(Worker);
 		
 		// Register worker at the new location immediately
 		UnitBase->ResourcePlace->AddWorkerToArray(Worker);
@@ -350,6 +308,7 @@ void AWorkArea::SwitchResourceArea(AWorkingUnitBase* Worker, AUnitBase* UnitBase
 				ResourceGameMode->AddCurrentWorkersForResourceType(UnitBase->TeamId, ConvertToResourceType(NewResourcePlace->Type), +1.0f);
 			}
 			UnitBase->ResourcePlace = NewResourcePlace;
+			ResourceGameMode->UpdateWorkerAssignment(Worker);
 
 			// Register worker at the fallback location immediately
 			UnitBase->ResourcePlace->AddWorkerToArray(Worker);
@@ -581,6 +540,11 @@ void AWorkArea::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		World->GetTimerManager().ClearTimer(OverflowWorkersTimerHandle);
 		World->GetTimerManager().ClearTimer(BuildProgressTimerHandle);
+
+		if (AResourceGameMode* ResourceGameMode = Cast<AResourceGameMode>(World->GetAuthGameMode()))
+		{
+			ResourceGameMode->HandleWorkAreaEndPlay(this);
+		}
 	}
 }
 
@@ -16,9 +16,12 @@
 #include "Components/CapsuleComponent.h"
 #include "Sound\SoundCue.h"
 #include "Characters/Unit/MassUnitBase.h"
+#include "Characters/Unit/UnitBase.h"
+#include "Widgets/SquadHealthBar.h"
+#include "System/UnitAttributeSyncSubsystem.h"
+#include "GameModes/RTSGameModeBase.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
-#include "GameModes/RTSGameModeBase.h"
 
 void AAbilityUnit::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
@@ -70,6 +73,7 @@ void AAbilityUnit::LevelUp_Implementation()
 		// Trigger any additional level-up effects or logic here
 
 		OnLevelUp(LevelData.CharacterLevel);
+		UUnitAttributeSyncSubsystem::RequestFullSync(this);
 		
 		LevelVisibilityCheck();
 
@@ -414,7 +418,22 @@ void AAbilityUnit::SetUnitState(TEnumAsByte<UnitData::EState> NewUnitState)
 		}
 	}
 	
+	const bool bDeathStateChanged = (UnitState == UnitData::Dead) != (NewUnitState == UnitData::Dead);
 	UnitState = NewUnitState;
+
+	if (bDeathStateChanged)
+	{
+		FSquadHealthRegistry::UpdateUnit(Cast<AUnitBase>(this));
+
+		if (HasAuthority() && GetWorld())
+		{
+			if (ARTSGameModeBase* GM = Cast<ARTSGameModeBase>(GetWorld()->GetAuthGameMode()))
+			{
+				if (UnitState == UnitData::Dead) GM->UnregisterAliveUnit(this);
+				else GM->RegisterAliveUnit(this);
+			}
+		}
+	}
 }
 
 TEnumAsByte<UnitData::EState> AAbilityUnit::GetUnitState() const
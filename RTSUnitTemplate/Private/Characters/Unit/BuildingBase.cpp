@@ -248,6 +248,7 @@ void ABuildingBase::SwitchResourceArea(AUnitBase* UnitBase, AResourceGameMode* R
 				}
 				
 				UnitBase->ResourcePlace = BestWorkPlace;
+				ResourceGameMode->UpdateWorkerAssignment(UnitBase);
 				
 				// Register worker at the new location immediately
 				if (AWorkingUnitBase* WorkingUnit = Cast<AWorkingUnitBase>(UnitBase))
@@ -276,6 +277,7 @@ void ABuildingBase::SwitchResourceArea(AUnitBase* UnitBase, AResourceGameMode* R
 			ResourceGameMode->AddCurrentWorkersForResourceType(UnitBase->TeamId, ConvertToResourceType(NewResourcePlace->Type), +1.0f);
 		}
 		UnitBase->ResourcePlace = NewResourcePlace;
+		ResourceGameMode->UpdateWorkerAssignment(UnitBase);
 
 		// Register worker at the new location immediately
 		if (AWorkingUnitBase* WorkingUnit = Cast<AWorkingUnitBase>(UnitBase))
@@ -308,6 +310,7 @@ void ABuildingBase::SwitchResourceArea(AUnitBase* UnitBase, AResourceGameMode* R
 		{
 			ResourceGameMode->AddCurrentWorkersForResourceType(UnitBase->TeamId, ConvertToResourceType(BestFallback->Type), +1.0f);
 			UnitBase->ResourcePlace = BestFallback;
+			ResourceGameMode->UpdateWorkerAssignment(UnitBase);
 
 			// Register worker at the fallback location immediately
 			if (AWorkingUnitBase* WorkingUnit = Cast<AWorkingUnitBase>(UnitBase))
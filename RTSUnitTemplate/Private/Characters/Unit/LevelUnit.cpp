@@ -5,6 +5,7 @@
 #include "Core/TalentSaveGame.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "System/UnitAttributeSyncSubsystem.h"
 
 void ALevelUnit::Tick(float DeltaTime)
 {
@@ -84,6 +85,7 @@ void ALevelUnit::LevelUp_Implementation()
 		LevelData.TalentPoints += LevelUpData.TalentPointsPerLevel; // Define TalentPointsPerLevel as appropriate
 		LevelData.Experience -= LevelUpData.ExperiencePerLevel*LevelData.CharacterLevel;
 		OnLevelUp(LevelData.CharacterLevel);
+		UUnitAttributeSyncSubsystem::RequestFullSync(this);
 		// Trigger any additional level-up effects or logic here
 	}
 
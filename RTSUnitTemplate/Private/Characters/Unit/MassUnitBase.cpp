@@ -5,6 +5,7 @@
 
 #include "MassSignalSubsystem.h"
 #include "Characters/Unit/UnitBase.h"
+#include "Widgets/SquadHealthBar.h"
 #include "Mass/Signals/MySignals.h"
 #include "Net/UnrealNetwork.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -20,6 +21,8 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Engine/StaticMeshActor.h"
+#include "System/UnitTweenSubsystem.h"
+#include "System/UnitAttributeSyncSubsystem.h"
 
 AMassUnitBase::AMassUnitBase(const FObjectInitializer& ObjectInitializer)
 {
@@ -1010,6 +1013,18 @@ void AMassUnitBase::BeginPlay()
 
 void AMassUnitBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	FSquadHealthRegistry::RemoveUnit(Cast<AUnitBase>(this));
+
+	if (UUnitTweenSubsystem* TweenScheduler = GetWorld() ? GetWorld()->GetSubsystem<UUnitTweenSubsystem>() : nullptr)
+	{
+		TweenScheduler->RemoveTweensForOwner(this);
+	}
+
+	if (UUnitAttributeSyncSubsystem* AttributeSync = GetWorld() ? GetWorld()->GetSubsystem<UUnitAttributeSyncSubsystem>() : nullptr)
+	{
+		AttributeSync->UnregisterUnit(Cast<AUnitBase>(this));
+	}
+
 	// Stop any pending rotation/movement timers
 	GetWorldTimerManager().ClearTimer(RotateTimerHandle);
 	GetWorldTimerManager().ClearTimer(StaticMeshRotateTimerHandle);
@@ -1440,6 +1455,32 @@ void AMassUnitBase::MulticastTransformSync_Implementation(const FVector& Locatio
 	SwitchEntityTagByState(UnitData::Idle, UnitStatePlaceholder);
 }
 
+UUnitTweenSubsystem* AMassUnitBase::GetTweenScheduler() const
+{
+	UWorld* World = GetWorld();
+	return (World && UUnitTweenSubsystem::IsEnabled()) ? World->GetSubsystem<UUnitTweenSubsystem>() : nullptr;
+}
+
+bool AMassUnitBase::GetVisualTweenTarget(FUnitTweenTarget& OutTarget)
+{
+	// Same visual as Get/ApplyLocalVisual*: our ISM instance, else the ISM component, else the skeletal mesh
+	if (!bUseSkeletalMovement && ISMComponent)
+	{
+		OutTarget = ISMComponent->IsValidInstance(InstanceIndex)
+			? FUnitTweenTarget::MakeISMInstance(this, ISMComponent, InstanceIndex)
+			: FUnitTweenTarget::MakeComponent(this, ISMComponent);
+		return true;
+	}
+
+	if (USkeletalMeshComponent* SkelMesh = GetMesh())
+	{
+		OutTarget = FUnitTweenTarget::MakeComponent(this, SkelMesh);
+		return true;
+	}
+
+	return false;
+}
+
 void AMassUnitBase::MulticastRotateISMLinear_Implementation(const FRotator& NewRotation, float InRotateDuration, float InRotationEaseExponent)
 {
 	// Assign incoming parameters to the global variables so all machines share identical tween settings
@@ -1464,6 +1505,16 @@ void AMassUnitBase::MulticastRotateISMLinear_Implementation(const FRotator& NewR
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		FUnitTweenTarget Target;
+		if (GetVisualTweenTarget(Target))
+		{
+			TweenScheduler->StartRotation(Target, GetCurrentLocalVisualRotation(), DesiredLocal, RotateDuration, RotationEaseExponent);
+		}
+		return;
+	}
+
 	// Initialize interpolation state and start/update the timer on this machine.
 	GetWorldTimerManager().ClearTimer(RotateTimerHandle);
 	RotateStart = GetCurrentLocalVisualRotation().GetNormalized();
@@ -1577,6 +1628,12 @@ void AMassUnitBase::MulticastRotateActorLinear_Implementation(UStaticMeshCompone
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		TweenScheduler->StartRotation(FUnitTweenTarget::MakeComponent(this, MeshToRotate), MeshToRotate->GetRelativeRotation().Quaternion(), NewRotation.Quaternion(), InRotateDuration, InRotationEaseExponent);
+		return;
+	}
+
 	// Setup or update tween for this component
  AMassUnitBase::FStaticMeshRotateTween& Tween = ActiveStaticMeshTweens.FindOrAdd(MeshToRotate);
 	Tween.Duration = InRotateDuration;
@@ -1662,6 +1719,20 @@ void AMassUnitBase::MulticastRotateActorYawToChase_Implementation(UStaticMeshCom
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		const FUnitTweenTarget Target = FUnitTweenTarget::MakeComponent(this, MeshToRotate);
+		if (bEnable)
+		{
+			TweenScheduler->StartYawFollow(Target, InRotateDuration, InRotationEaseExponent, YawOffsetDegrees);
+		}
+		else
+		{
+			TweenScheduler->StopYawFollow(Target);
+		}
+		return;
+	}
+
 	if (bEnable)
 	{
 		FYawFollowData& Data = ActiveYawFollows.FindOrAdd(MeshToRotate);
@@ -1697,6 +1768,20 @@ void AMassUnitBase::MulticastRotateISMYawToChase_Implementation(UInstancedStatic
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		const FUnitTweenTarget Target = FUnitTweenTarget::MakeISMInstance(this, ISMToRotate, InstIndex);
+		if (bEnable)
+		{
+			TweenScheduler->StartYawFollow(Target, InRotateDuration, InRotationEaseExponent, YawOffsetDegrees, bTeleport);
+		}
+		else
+		{
+			TweenScheduler->StopYawFollow(Target);
+		}
+		return;
+	}
+
 	FISMInstanceKey Key(ISMToRotate, InstIndex);
 
 	if (bEnable)
@@ -1952,6 +2037,24 @@ void AMassUnitBase::MulticastRotateUnitYawToChase_Implementation(float InRotateD
 {
 	bUnitYawFollowEnabled = bEnable;
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		const FUnitTweenTarget Target = FUnitTweenTarget::MakeActor(this);
+		if (bEnable)
+		{
+			// Disable continuous constant rotation if it was active
+			bContinuousUnitRotationEnabled = false;
+			TweenScheduler->StopSpin(Target);
+			TweenScheduler->StartYawFollow(Target, InRotateDuration, InRotationEaseExponent, YawOffsetDegrees);
+		}
+		else
+		{
+			TweenScheduler->StopYawFollow(Target);
+			TweenScheduler->StopRotation(Target);
+		}
+		return;
+	}
+
 	if (bUnitYawFollowEnabled)
 	{
 		// Disable continuous constant rotation if it was active
@@ -2066,6 +2169,24 @@ void AMassUnitBase::MulticastContinuousUnitRotation_Implementation(float YawRate
 	bContinuousUnitRotationEnabled = bEnable;
 	ContinuousUnitYawRate = YawRate;
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		const FUnitTweenTarget Target = FUnitTweenTarget::MakeActor(this);
+		if (bEnable)
+		{
+			// Disable unit-to-chase yaw follow if it was active
+			bUnitYawFollowEnabled = false;
+			TweenScheduler->StopYawFollow(Target);
+			TweenScheduler->StopRotation(Target);
+			TweenScheduler->StartSpin(Target, YawRate);
+		}
+		else
+		{
+			TweenScheduler->StopSpin(Target);
+		}
+		return;
+	}
+
 	if (bContinuousUnitRotationEnabled)
 	{
 		// Disable unit-to-chase yaw follow if it was active
@@ -2116,6 +2237,13 @@ void AMassUnitBase::MulticastMoveUnitLinear_Implementation(const FVector& Relati
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		const FVector Start = GetActorLocation();
+		TweenScheduler->StartLocation(FUnitTweenTarget::MakeActor(this), Start, Start + GetActorRotation().RotateVector(RelativeLocationChange), InMoveDuration, InMoveEaseExponent);
+		return;
+	}
+
 	// Initialize interpolation state
 	GetWorldTimerManager().ClearTimer(UnitMoveTimerHandle);
 	UnitMoveTween.Duration = InMoveDuration;
@@ -2173,6 +2301,16 @@ void AMassUnitBase::MulticastMoveISMLinear_Implementation(const FVector& NewLoca
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		FUnitTweenTarget Target;
+		if (GetVisualTweenTarget(Target))
+		{
+			TweenScheduler->StartLocation(Target, GetCurrentLocalVisualLocation(), NewLocation, MoveDuration, MoveEaseExponent);
+		}
+		return;
+	}
+
 	// Initialize interpolation state
 	GetWorldTimerManager().ClearTimer(MoveTimerHandle);
 	MoveStart = GetCurrentLocalVisualLocation();
@@ -2271,6 +2409,12 @@ void AMassUnitBase::MulticastMoveActorLinear_Implementation(UStaticMeshComponent
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		TweenScheduler->StartLocation(FUnitTweenTarget::MakeComponent(this, MeshToMove), MeshToMove->GetRelativeLocation(), NewLocation, InMoveDuration, InMoveEaseExponent);
+		return;
+	}
+
 	AMassUnitBase::FStaticMeshMoveTween& Tween = ActiveStaticMeshMoveTweens.FindOrAdd(MeshToMove);
 	Tween.Duration = InMoveDuration;
 	Tween.Elapsed = 0.f;
@@ -2358,6 +2502,16 @@ void AMassUnitBase::MulticastScaleISMLinear_Implementation(const FVector& NewSca
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		FUnitTweenTarget Target;
+		if (GetVisualTweenTarget(Target))
+		{
+			TweenScheduler->StartScale(Target, GetCurrentLocalVisualScale(), NewScale, ScaleDuration, ScaleEaseExponent);
+		}
+		return;
+	}
+
 	// Initialize interpolation state
 	GetWorldTimerManager().ClearTimer(ScaleTimerHandle);
 	ScaleStart = GetCurrentLocalVisualScale();
@@ -2456,6 +2610,12 @@ void AMassUnitBase::MulticastScaleActorLinear_Implementation(UStaticMeshComponen
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		TweenScheduler->StartScale(FUnitTweenTarget::MakeComponent(this, MeshToScale), MeshToScale->GetRelativeScale3D(), NewScale, InScaleDuration, InScaleEaseExponent);
+		return;
+	}
+
 	AMassUnitBase::FStaticMeshScaleTween& Tween = ActiveStaticMeshScaleTweens.FindOrAdd(MeshToScale);
 	Tween.Duration = InScaleDuration;
 	Tween.Elapsed = 0.f;
@@ -2534,6 +2694,28 @@ void AMassUnitBase::MulticastPulsateISMScale_Implementation(const FVector& InMin
 		return;
 	}
 
+	if (UUnitTweenSubsystem* TweenScheduler = GetTweenScheduler())
+	{
+		FUnitTweenTarget Target;
+		if (!GetVisualTweenTarget(Target))
+		{
+			return;
+		}
+
+		bPulsateScaleEnabled = bEnable;
+		if (bEnable)
+		{
+			// Ensure one-shot scale tween is not fighting with the pulsation
+			TweenScheduler->StopScale(Target);
+			TweenScheduler->StartPulsate(Target, InMinScale, InMaxScale, TimeMinToMax);
+		}
+		else
+		{
+			TweenScheduler->StopPulsate(Target);
+		}
+		return;
+	}
+
 	// Disable pulsating on request
 	if (!bEnable)
 	{
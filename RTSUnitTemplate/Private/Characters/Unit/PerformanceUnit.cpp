@@ -15,6 +15,9 @@
 #include "NiagaraFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "Controller/AIController/UnitControllerBase.h"
+#include "Mass/UnitVisibilityProcessor.h"
+#include "Mass/UnitMassTag.h"
+#include "System/DamageIndicatorSubsystem.h"
 #include "Controller/PlayerController/ControllerBase.h"
 #include "Controller/PlayerController/CustomControllerBase.h"
 #include "Engine/SkeletalMesh.h" // For USkeletalMesh
@@ -46,6 +49,12 @@ APerformanceUnit::APerformanceUnit(const FObjectInitializer& ObjectInitializer):
 void APerformanceUnit::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	// Mass bound units get their visibility from UUnitVisibilityProcessor
+	if (UUnitVisibilityProcessor::IsEnabled() && MassActorBindingComponent && MassActorBindingComponent->GetMassEntityHandle().IsValid())
+	{
+		return;
+	}
 	
 	CheckViewport();
 	
@@ -162,6 +171,45 @@ void APerformanceUnit::VisibilityTickFog()
 	}
 }
 
+void APerformanceUnit::ApplyProcessorVisibility(bool bOnViewport, bool bMyTeam, FMassUnitVisibilityFragment& State)
+{
+	IsOnViewport = bOnViewport;
+	IsMyTeam = bMyTeam;
+
+	if (StopVisibilityTick)
+	{
+		// Someone else owns the visibility meanwhile (e.g. loaded into a transporter); re-apply everything afterwards
+		State.bInitialized = false;
+		return;
+	}
+
+	const bool bViewportChanged = !State.bInitialized || State.bOnViewport != bOnViewport;
+
+	const bool bCharacterVisible = EnableFog ? (bOnViewport && (IsMyTeam || IsVisibleEnemy)) : bOnViewport;
+	if (!State.bInitialized || State.bCharacterVisible != bCharacterVisible)
+	{
+		SetCharacterVisibility(bCharacterVisible);
+		State.bCharacterVisible = bCharacterVisible;
+	}
+
+	// Off screen and not shown the health bar handlers have nothing to do
+	if (bOnViewport || bViewportChanged || HealthBarUpdateTriggered)
+	{
+		CheckHealthBarVisibility();
+	}
+
+	const bool bTimerVisible = bOnViewport && IsMyTeam;
+	if (bTimerVisible || !State.bInitialized || State.bTimerVisible != bTimerVisible)
+	{
+		// While visible this also keeps the widget following ISM units
+		CheckTimerVisibility();
+		State.bTimerVisible = bTimerVisible;
+	}
+
+	State.bOnViewport = bOnViewport;
+	State.bInitialized = true;
+}
+
 void APerformanceUnit::CheckViewport()
 {
 	FVector ALocation = GetMassActorLocation();
@@ -416,6 +464,12 @@ void APerformanceUnit::SpawnDamageIndicator_Implementation(const float Damage, F
 	{
 		if(Damage > 0 && Attributes->IndicatorBaseClass)
 		{
+			// Pooled and merged per target; spawning one actor per hit only remains as fallback
+			if (UDamageIndicatorSubsystem* Indicators = GetWorld()->GetSubsystem<UDamageIndicatorSubsystem>())
+			{
+				Indicators->RequestIndicator(this, Attributes->IndicatorBaseClass, GetActorLocation(), Damage, HighColor, LowColor, ColorOffset, IsMyTeam);
+				return;
+			}
 			
 			FTransform Transform;
 			Transform.SetLocation(GetActorLocation());
@@ -6,6 +6,7 @@
 #include "Actors/AbilityIndicator.h"
 #include "Controller/PlayerController/ControllerBase.h"
 #include "Net/UnrealNetwork.h"
+#include "GameModes/RTSGameModeBase.h"
 
 ASpawnerUnit::ASpawnerUnit(const FObjectInitializer& ObjectInitializer):Super(ObjectInitializer)
 {
@@ -17,6 +18,35 @@ void ASpawnerUnit::BeginPlay()
 {
 	Super::BeginPlay();
 	CreateSpawnDataFromDataTable();
+
+	if (HasAuthority())
+	{
+		// TeamId and tags are assigned right after spawning, so register for the win/lose counters one tick later
+		TWeakObjectPtr<ASpawnerUnit> WeakThis(this);
+		GetWorldTimerManager().SetTimerForNextTick([WeakThis]()
+		{
+			ASpawnerUnit* StrongThis = WeakThis.Get();
+			if (!StrongThis || !StrongThis->GetWorld()) return;
+
+			if (ARTSGameModeBase* GM = Cast<ARTSGameModeBase>(StrongThis->GetWorld()->GetAuthGameMode()))
+			{
+				GM->RegisterAliveUnit(StrongThis);
+			}
+		});
+	}
+}
+
+void ASpawnerUnit::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (HasAuthority() && GetWorld())
+	{
+		if (ARTSGameModeBase* GM = Cast<ARTSGameModeBase>(GetWorld()->GetAuthGameMode()))
+		{
+			GM->UnregisterAliveUnit(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASpawnerUnit::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const
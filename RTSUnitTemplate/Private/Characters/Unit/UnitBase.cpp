@@ -11,6 +11,7 @@
 #include "Components/CapsuleComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Actors/Projectile.h"
+#include "Mass/Projectiles/ProjectileSimulationSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -217,6 +218,9 @@ void AUnitBase::InitHealthbarOwner()
 
 void AUnitBase::EnsureSquadHealthbarState()
 {
+	// Called after every SquadId assignment; keep the squad health aggregate in sync
+	FSquadHealthRegistry::UpdateUnit(this);
+
 	if (!HealthWidgetComp) return;
 	if (SquadId <= 0) return; // Regular units keep their own healthbar
 
@@ -894,6 +898,25 @@ void AUnitBase::SpawnProjectile_Implementation(AActor* Target, AActor* Attacker)
 	Transform.SetRotation(FQuat(InitialRotation));
 	Transform.SetScale3D(ShootingUnit->ProjectileScale);
 
+	if (UProjectileSimulationSubsystem::IsPooledSimulationEnabled(ProjectileBaseClass))
+	{
+		if (UProjectileSimulationSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UProjectileSimulationSubsystem>())
+		{
+			// Same start values AProjectile::Init would use
+			FProjectileSpawnEvent Event;
+			Event.ProjectileClass = ProjectileBaseClass;
+			Event.Target = Cast<AUnitBase>(Target);
+			Event.Origin = Transform.GetLocation();
+			Event.ArcOrigin = ShootingUnit->bUseSkeletalMovement ? ShootingUnit->GetProjectileSpawnLocation() : ShootingUnit->GetMassActorLocation();
+			Event.TargetLocation = Event.Target ? Event.Target->GetMassActorLocation() : AimLocation;
+			Event.Rotation = InitialRotation;
+			Event.Scale = ShootingUnit->ProjectileScale;
+			Event.Speed = ShootingUnit->Attributes->GetProjectileSpeed();
+			Event.ProjectileId = ProjectileSubsystem->AllocateProjectileId();
+			ShootingUnit->Multicast_SpawnPooledProjectile(Event);
+			return;
+		}
+	}
 		
 	const auto MyProjectile = Cast<AProjectile>
 						(UGameplayStatics::BeginDeferredActorSpawnFromClass
@@ -908,6 +931,28 @@ void AUnitBase::SpawnProjectile_Implementation(AActor* Target, AActor* Attacker)
 }
 
 
+void AUnitBase::Multicast_SpawnPooledProjectile_Implementation(const FProjectileSpawnEvent& Event)
+{
+	if (UProjectileSimulationSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UProjectileSimulationSubsystem>())
+	{
+		ProjectileSubsystem->SpawnFromEvent(Event, this, HasAuthority());
+	}
+}
+
+void AUnitBase::Multicast_PooledProjectileFollowUps_Implementation(const TArray<FProjectileFollowUpEvent>& Events)
+{
+	// The server applied these when it queued them
+	if (HasAuthority())
+	{
+		return;
+	}
+
+	if (UProjectileSimulationSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UProjectileSimulationSubsystem>())
+	{
+		ProjectileSubsystem->ApplyFollowUps(Events);
+	}
+}
+
 void AUnitBase::SpawnProjectileFromClass_Implementation(
     AActor* Aim,
     AActor* Attacker,
@@ -30,6 +30,20 @@ void AWorkingUnitBase::BeginPlay()
 
 	if (GameMode)
 	{
+		// Spawners (buildings, save loading, spawn platforms) assign TeamId right after spawning, so the worker
+		// is counted one tick later under its final team
+		TWeakObjectPtr<AWorkingUnitBase> WeakThis(this);
+		GetWorldTimerManager().SetTimerForNextTick([WeakThis]()
+		{
+			AWorkingUnitBase* StrongThis = WeakThis.Get();
+			if (!StrongThis || !StrongThis->GetWorld()) return;
+
+			if (AResourceGameMode* GM = Cast<AResourceGameMode>(StrongThis->GetWorld()->GetAuthGameMode()))
+			{
+				GM->RegisterWorker(StrongThis);
+			}
+		});
+
 		AWorkerUnitControllerBase* WorkerController = Cast<AWorkerUnitControllerBase>(GetController());
 		if (WorkerController)
 		{
@@ -39,6 +53,19 @@ void AWorkingUnitBase::BeginPlay()
 	
 }
 
+void AWorkingUnitBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (AResourceGameMode* GameMode = Cast<AResourceGameMode>(World->GetAuthGameMode()))
+		{
+			GameMode->UnregisterWorker(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AWorkingUnitBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -24,6 +24,14 @@
 #include "Navigation/CrowdAgentInterface.h"
 #include "Navigation/CrowdManager.h"
 #include "Widgets/UnitBaseHealthBar.h"
+#include "System/UnitSpatialQuerySubsystem.h"
+#include "System/GroundTraceSubsystem.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_Detection_UseSpatialQuery(
+	TEXT("net.RTS.Detection.UseSpatialQuery"),
+	1,
+	TEXT("1 = actor AI detection queries the per team unit grid, 0 = scan all units of the GameMode (for comparison)."),
+	ECVF_Default);
 
 void AUnitControllerBase::DetectAndLoseUnits()
 {
@@ -553,6 +561,29 @@ void AUnitControllerBase::DetectUnitsFromGameMode(AUnitBase* DetectingUnit, TArr
         UE_LOG(LogTemp, Warning, TEXT("RTSGameMode->AllUnits.Num(): %d"), RTSGameMode->AllUnits.Num());
     }
 
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitController_DetectUnitsFromGameMode);
+
+    if (CVarRTS_Detection_UseSpatialQuery.GetValueOnGameThread() > 0)
+    {
+        if (UUnitSpatialQuerySubsystem* SpatialQuery = GetWorld()->GetSubsystem<UUnitSpatialQuerySubsystem>())
+        {
+            if (DetectingUnit->GetUnitState() == UnitData::Dead)
+            {
+                return;
+            }
+
+            FUnitDetectionFilter Filter;
+            Filter.TeamId = DetectingUnit->TeamId;
+            Filter.bFriendly = DetectFriendlyUnits;
+            Filter.bCanDetectInvisible = DetectingUnit->CanDetectInvisible;
+            Filter.bOnlyGround = DetectingUnit->CanOnlyAttackGround;
+            Filter.bOnlyFlying = DetectingUnit->CanOnlyAttackFlying;
+
+            SpatialQuery->QueryUnitsInRadius(DetectingUnit->GetActorLocation(), Sight, Filter, DetectedUnits);
+            return;
+        }
+    }
+
     // Loop through all units stored in the game mode.
     for (int32 i = 0; i < RTSGameMode->AllUnits.Num(); i++)
     {
@@ -1367,36 +1398,61 @@ bool AUnitControllerBase::SetUEPathfinding(AUnitBase* UnitBase, float DeltaSecon
 		return MoveToLocationUEPathFindingAvoidance(UnitBase, Location); // MoveToLocationUEPathFinding(UnitBase, Location);
 }
 
-bool AUnitControllerBase::PerformLineTrace(AUnitBase* Unit, const FVector& DestinationLocation, FHitResult& HitResult)
+bool AUnitControllerBase::TraceGround(const FVector& Start, const FVector& End, FHitResult& HitResult, bool bTraceComplex, const AActor* ExtraIgnoredActor) const
 {
-    FVector StartLocation = Unit->GetMassActorLocation();
-	
-    FVector EndLocation = DestinationLocation;
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitController_TraceGround);
 
-	EndLocation.Z = StartLocation.Z - 1500.f;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(Unit); // Ignore the unit itself
-	QueryParams.AddIgnoredActor(Unit->UnitToChase);
-	QueryParams.bTraceComplex = true;
+	UWorld* World = GetWorld();
+	if (!World) return false;
+
+	if (GroundTraceChannel != ECC_Visibility)
+	{
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(UnitControllerGroundTrace), bTraceComplex, ExtraIgnoredActor);
+		return World->LineTraceSingleByChannel(HitResult, Start, End, GroundTraceChannel, QueryParams);
+	}
 
-	for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
+	UGroundTraceSubsystem* GroundTrace = World->GetSubsystem<UGroundTraceSubsystem>();
+	if (!GroundTrace)
 	{
-		QueryParams.AddIgnoredActor(*It);
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(UnitControllerGroundTrace), bTraceComplex, ExtraIgnoredActor);
+		return World->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
 	}
 
-	// Add all AUnitBase actors to the ignore list.
-	for (TActorIterator<AUnitBase> It(GetWorld()); It; ++It)
+	const FCollisionQueryParams& QueryParams = GroundTrace->GetIgnoreParams(bTraceComplex);
+	if (!ExtraIgnoredActor || UGroundTraceSubsystem::IsIgnored(ExtraIgnoredActor))
 	{
-		QueryParams.AddIgnoredActor(*It);
+		return World->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
 	}
+
+	// ExtraIgnoredActor is not in the cached list: step past its hits instead of copying the list
+	const FVector Direction = (End - Start).GetSafeNormal();
+	FVector TraceStart = Start;
+	for (int32 Attempt = 0; Attempt < 4; ++Attempt)
+	{
+		if (!World->LineTraceSingleByChannel(HitResult, TraceStart, End, ECC_Visibility, QueryParams))
+		{
+			return false;
+		}
+		if (HitResult.GetActor() != ExtraIgnoredActor)
+		{
+			HitResult.TraceStart = Start;
+			HitResult.Distance = FVector::Dist(Start, HitResult.Location);
+			return true;
+		}
+		TraceStart = HitResult.Location + Direction;
+	}
+	return false;
+}
+
+bool AUnitControllerBase::PerformLineTrace(AUnitBase* Unit, const FVector& DestinationLocation, FHitResult& HitResult)
+{
+    FVector StartLocation = Unit->GetMassActorLocation();
 	
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        HitResult,
-        StartLocation,
-        EndLocation,
-        ECC_Visibility, // Trace against pawns only
-        QueryParams
-    );
+    FVector EndLocation = DestinationLocation;
+
+	EndLocation.Z = StartLocation.Z - 1500.f;
+	// Unit and UnitToChase are units, so they are skipped with all others
+    bool bHit = TraceGround(StartLocation, EndLocation, HitResult, true);
 
 	if (bHit && HitResult.GetActor())
 	{
@@ -366,11 +366,8 @@ FVector AWorkerUnitControllerBase::GetGroundLocationAndIgnore(const FVector& Ori
 	FHitResult HitResult;
 	FVector Start = Origin;
 	FVector End = Origin - FVector(0.f, 0.f, 1000.f); // Trace downward 1000 units
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(ActorToIgnore); // Ignore the resource actor
-
-	// Perform the trace
-	if(GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams))
+	// Perform the trace, ignoring the resource actor
+	if(TraceGround(Start, End, HitResult, false, ActorToIgnore))
 	{
 		return HitResult.ImpactPoint;
 	}
@@ -414,23 +411,11 @@ FVector AWorkerUnitControllerBase::GetFloorLocation(AUnitBase* Unit)
 	FVector StartLocation = BaseLocation + FVector(0, 0, 1000); // Start above the Base
 	FVector EndLocation = BaseLocation - FVector(0, 0, 1000);   // Trace downwards to find the floor
     
-	// Set up the collision query parameters
-	FCollisionQueryParams TraceParams;
-	TraceParams.AddIgnoredActor(Unit); // Ignore the base actor
-	TraceParams.bTraceComplex = true;        // Optional: Trace against complex collision
-	TraceParams.bReturnPhysicalMaterial = false; // Optional: Set to true if physical material is needed
-
 	// Set up the hit result
 	FHitResult HitResult;
 
-	// Perform the line trace
-	bool bHit = Unit->GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		StartLocation,
-		EndLocation,
-		ECC_Visibility, // Trace channel (Visibility or any custom channel)
-		TraceParams
-	);
+	// Perform the line trace against complex collision, ignoring the base actor and all other units
+	bool bHit = TraceGround(StartLocation, EndLocation, HitResult, true, Unit);
 
 	// Check the result of the trace
 	if (bHit)
@@ -2158,12 +2158,13 @@ void ACustomControllerBase::LeftClickReleasedMass()
 	
 	LeftClickIsPressed = false;
 	HUDBase->bSelectFriendly = false;
+	HUDBase->EndSelectionDrag();
 	SelectedUnits = HUDBase->SelectedUnits;
 
 	DropUnitBase();
 	int BestIndex = GetHighestPriorityWidgetIndex();
 	CurrentUnitWidgetIndex = BestIndex;
-	//UpdateSelectionCircles();
+	UpdateSelectionCircles();
 	AExtendedCameraBase* ExtendedCameraBase = Cast<AExtendedCameraBase>(CameraBase);
 	if (ExtendedCameraBase)
 	{
@@ -2292,7 +2293,7 @@ void ACustomControllerBase::UpdateSelectionCircles()
 	UWorld* World = GetWorld();
 	if (!ensure(World)) return;
 
-	TArray<FVector_NetQuantize> Positions;
+	TArray<FVector> Positions;
 	TArray<float> WorldRadii;
     
 	if (UMassEntitySubsystem* EntitySubsystem = World->GetSubsystem<UMassEntitySubsystem>())
@@ -2312,16 +2313,16 @@ void ACustomControllerBase::UpdateSelectionCircles()
 			// Use a default or calculated radius for the selection circle
 			float SelectionRadius = 50.f; // Example radius, adjust as needed
 
-			Positions.Add(FVector_NetQuantize(TransformFragment->GetTransform().GetLocation()));
+			Positions.Add(TransformFragment->GetTransform().GetLocation());
 			WorldRadii.Add(SelectionRadius);
 		}
 	}
     
-	// Multicast to all SelectionCircleActors
+	// Selection is cosmetic and per player: update only this client's circle actor, nothing goes over the network
 	for (TActorIterator<ASelectionCircleActor> It(World); It; ++It)
 	{
 		if (It->TeamId == SelectableTeamId)
-			It->Multicast_UpdateSelectionCircles(Positions, WorldRadii);
+			It->UpdateSelectionCircles_Local(Positions, WorldRadii);
 	}
 }
 
@@ -2744,6 +2745,7 @@ void ACustomControllerBase::DestroySelectedUnits()
 
 	// Clear selection after destroying
 	SelectedUnits.Empty();
+	UpdateSelectionCircles();
 }
 
 void ACustomControllerBase::Server_DestroyUnit_Implementation(AUnitBase* Unit)
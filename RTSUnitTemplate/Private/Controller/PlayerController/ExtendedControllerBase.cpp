@@ -2,6 +2,7 @@
 
 
 #include "Controller/PlayerController/ExtendedControllerBase.h"
+#include "Controller/PlayerController/CustomControllerBase.h"
 
 #include "EngineUtils.h"
 #include "GameplayTagsManager.h"
@@ -29,6 +30,10 @@
 #include "Kismet/GameplayStatics.h"
 #include "Characters/Unit/ConstructionUnit.h"
 #include "Mass/UnitMassTag.h"
+#include "System/PlacementSpatialIndexSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Drag Work Area"), STAT_RTSPlacement_DragWorkArea, STATGROUP_RTSPlacement);
+DECLARE_CYCLE_STAT(TEXT("Drag Ability Indicator"), STAT_RTSPlacement_DragAbilityIndicator, STATGROUP_RTSPlacement);
 
 // Helper: compute snap center/extent for any actor (works with ISMs too)
 static bool GetActorBoundsForSnap(AActor* Actor, FVector& OutCenter, FVector& OutExtent)
@@ -72,6 +77,97 @@ static bool GetActorBoundsForSnap(AActor* Actor, FVector& OutCenter, FVector& Ou
 	return true;
 }
 
+// Work areas / buildings that can come within Radius (2D) of Location; all of them if the placement index is off
+static void GatherSnapWorkAreas(UWorld* World, const FVector& Location, float Radius, TArray<AWorkArea*>& OutWorkAreas)
+{
+	if (UPlacementSpatialIndexSubsystem* PlacementIndex = UPlacementSpatialIndexSubsystem::GetIfEnabled(World))
+	{
+		PlacementIndex->GatherWorkAreasInRadius(Location, Radius, OutWorkAreas);
+		return;
+	}
+	if (!World)
+	{
+		return;
+	}
+	for (TActorIterator<AWorkArea> It(World); It; ++It)
+	{
+		OutWorkAreas.Add(*It);
+	}
+}
+
+static void GatherSnapBuildings(UWorld* World, const FVector& Location, float Radius, TArray<ABuildingBase*>& OutBuildings)
+{
+	if (UPlacementSpatialIndexSubsystem* PlacementIndex = UPlacementSpatialIndexSubsystem::GetIfEnabled(World))
+	{
+		PlacementIndex->GatherBuildingsInRadius(Location, Radius, OutBuildings);
+		return;
+	}
+	if (!World)
+	{
+		return;
+	}
+	for (TActorIterator<ABuildingBase> It(World); It; ++It)
+	{
+		OutBuildings.Add(*It);
+	}
+}
+
+// Work areas first, then buildings, like the world scans this replaces
+static void GatherSnapNeighbors(UWorld* World, const FVector& Location, float Radius, TArray<AActor*>& OutActors)
+{
+	TArray<AWorkArea*> WorkAreas;
+	GatherSnapWorkAreas(World, Location, Radius, WorkAreas);
+	TArray<ABuildingBase*> Buildings;
+	GatherSnapBuildings(World, Location, Radius, Buildings);
+
+	OutActors.Reserve(OutActors.Num() + WorkAreas.Num() + Buildings.Num());
+	OutActors.Append(WorkAreas);
+	OutActors.Append(Buildings);
+}
+
+// Ignores every work area a trace from Start to End can hit
+static void IgnoreWorkAreasAlongTrace(UWorld* World, const FVector& Start, const FVector& End, FCollisionQueryParams& Params)
+{
+	if (UPlacementSpatialIndexSubsystem* PlacementIndex = UPlacementSpatialIndexSubsystem::GetIfEnabled(World))
+	{
+		TArray<AWorkArea*> WorkAreas;
+		PlacementIndex->GatherWorkAreasAlongSegment(Start, End, WorkAreas);
+		for (AWorkArea* WorkArea : WorkAreas)
+		{
+			Params.AddIgnoredActor(WorkArea);
+		}
+		return;
+	}
+	if (!World)
+	{
+		return;
+	}
+	for (TActorIterator<AWorkArea> It(World); It; ++It)
+	{
+		Params.AddIgnoredActor(*It);
+	}
+}
+
+static bool HasOtherNoBuildZone(UWorld* World, const AWorkArea* DraggedWorkArea)
+{
+	if (UPlacementSpatialIndexSubsystem* PlacementIndex = UPlacementSpatialIndexSubsystem::GetIfEnabled(World))
+	{
+		return PlacementIndex->HasNoBuildZone(DraggedWorkArea);
+	}
+	if (!World)
+	{
+		return false;
+	}
+	for (TActorIterator<AWorkArea> It(World); It; ++It)
+	{
+		if (*It != DraggedWorkArea && It->IsNoBuildZone)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 void AExtendedControllerBase::BeginPlay()
 {
 	Super::BeginPlay();
@@ -553,10 +649,7 @@ void AExtendedControllerBase::SetWorkAreaPosition_Implementation(AWorkArea* Drag
     FHitResult HitResult;
     FCollisionQueryParams TraceParams(FName(TEXT("WorkAreaGroundTrace")), true, DraggedArea);
     //TraceParams.AddIgnoredActor(DraggedArea);
-	for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-	{
-		TraceParams.AddIgnoredActor(*It);
-	}
+	IgnoreWorkAreasAlongTrace(GetWorld(), TraceStart, TraceEnd, TraceParams);
 
     {
         // Iteratively ignore non-landscape hits until we find Landscape or no hit
@@ -694,10 +787,7 @@ FVector AExtendedControllerBase::ComputeGroundedLocation(AWorkArea* DraggedArea,
 	{
 		FCollisionQueryParams Params(FName(TEXT("WorkArea_GroundTrace")), true, DraggedArea);
 		// Ignore all WorkAreas so we hit world
-		for (TActorIterator<AWorkArea> It(World); It; ++It)
-		{
-			Params.AddIgnoredActor(*It);
-		}
+		IgnoreWorkAreasAlongTrace(World, TraceStart, TraceEnd, Params);
 
 		// Iteratively ignore non-landscape hits until we find Landscape or no hit
 		const int32 MaxTries = 8;
@@ -856,10 +946,7 @@ void AExtendedControllerBase::SnapToActor(AWorkArea* DraggedActor, AActor* Other
                 const FVector TraceStart = MousePos;
                 const FVector TraceEnd = TraceStart + MouseDir * 1000000.f;
                 FCollisionQueryParams Params;
-                for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-                {
-                    Params.AddIgnoredActor(*It);
-                }
+                IgnoreWorkAreasAlongTrace(GetWorld(), TraceStart, TraceEnd, Params);
                 FHitResult GroundHit;
                 if (GetWorld() && GetWorld()->LineTraceSingleByChannel(GroundHit, TraceStart, TraceEnd, ECC_Visibility, Params))
                 {
@@ -1109,10 +1196,7 @@ bool AExtendedControllerBase::TraceMouseToGround(FVector& OutMouseGround, FHitRe
     Params.bTraceComplex = true;
 
     // Ignore all actors of class AWorkArea
-    for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-    {
-        Params.AddIgnoredActor(*It);
-    }
+    IgnoreWorkAreasAlongTrace(GetWorld(), Start, End, Params);
 
     if (!GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, Params))
     {
@@ -1302,15 +1386,24 @@ bool AExtendedControllerBase::TrySnapViaProximity(AWorkArea* DraggedWorkArea, co
     UStaticMeshComponent* BestCandidateMesh = nullptr;
     float BestCandidateDist = TNumericLimits<float>::Max();
 
+    // No build zones anywhere only flash the dragged area, they are never snap targets
+    if (HasOtherNoBuildZone(GetWorld(), DraggedWorkArea))
+    {
+        DraggedWorkArea->TemporarilyChangeMaterial();
+    }
+
+    // Candidates beyond SnapDistance + SnapGap + the combined half extents can not pass the threshold below
+    const float QueryRadius = SnapDistance + SnapGap + (Extent.X + Extent.Y) * 0.5f;
+
     // Scan WorkAreas
-    for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
+    TArray<AWorkArea*> NearbyWorkAreas;
+    GatherSnapWorkAreas(GetWorld(), DraggedWorkArea->GetActorLocation(), QueryRadius, NearbyWorkAreas);
+    for (AWorkArea* Candidate : NearbyWorkAreas)
     {
-        AWorkArea* Candidate = *It;
         if (!Candidate || Candidate == DraggedWorkArea) continue;
 
         if (Candidate->IsNoBuildZone)
         {
-            DraggedWorkArea->TemporarilyChangeMaterial();
             continue;
         }
         if (Candidate->Type == WorkAreaData::Primary ||
@@ -1339,9 +1432,10 @@ bool AExtendedControllerBase::TrySnapViaProximity(AWorkArea* DraggedWorkArea, co
     }
 
     // Scan Buildings
-    for (TActorIterator<ABuildingBase> ItB(GetWorld()); ItB; ++ItB)
+    TArray<ABuildingBase*> NearbyBuildings;
+    GatherSnapBuildings(GetWorld(), DraggedWorkArea->GetActorLocation(), QueryRadius, NearbyBuildings);
+    for (ABuildingBase* Candidate : NearbyBuildings)
     {
-        ABuildingBase* Candidate = *ItB;
         if (!Candidate) continue;
 
         FVector OtherCenter, OtherExtent;
@@ -1530,13 +1624,12 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
         }
     };
 
-    for (TActorIterator<AWorkArea> It(World); It; ++It)
-    {
-        ConsiderActor(*It);
-    }
-    for (TActorIterator<ABuildingBase> ItB(World); ItB; ++ItB)
+    // Only actors whose footprint reaches within DragXY of the desired location can pass ConsiderActor
+    TArray<AActor*> Candidates;
+    GatherSnapNeighbors(World, DesiredGrounded, DragXY, Candidates);
+    for (AActor* Candidate : Candidates)
     {
-        ConsiderActor(*ItB);
+        ConsiderActor(Candidate);
     }
 
     // Helper: iterative push-away to satisfy distances vs all neighbors
@@ -1547,15 +1640,24 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
         const float MinStep = 0.1f;
         bOutAllGood = false;
 
-        // Build neighbor list once
+        // Without the placement index the neighbor list is built once; with it, each check gathers only
+        // the neighbors that can violate Required (at most DragR + NR + SnapGap or the resource distance)
+        const bool bQueryNeighbors = UPlacementSpatialIndexSubsystem::GetIfEnabled(World) != nullptr;
         TArray<AActor*> Neighbors;
-        for (TActorIterator<AWorkArea> ItWA(World); ItWA; ++ItWA)
+        auto GatherNeighbors = [&](const FVector& DragC, float DragR)
         {
-            if (*ItWA && *ItWA != DraggedWorkArea) Neighbors.Add(*ItWA);
-        }
-        for (TActorIterator<ABuildingBase> ItBD(World); ItBD; ++ItBD)
+            float Reach = DragR + SnapGap;
+            if (DraggedWorkArea->DenyPlacementCloseToResources)
+            {
+                Reach = FMath::Max(Reach, DraggedWorkArea->ResourcePlacementDistance);
+            }
+            Neighbors.Reset();
+            GatherSnapNeighbors(World, DragC, Reach, Neighbors);
+            Neighbors.Remove(DraggedWorkArea);
+        };
+        if (!bQueryNeighbors)
         {
-            if (*ItBD) Neighbors.Add(*ItBD);
+            GatherNeighbors(FVector::ZeroVector, 0.f);
         }
 
         FVector WorkingLoc = InOutLocation;
@@ -1571,6 +1673,10 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
                 break; // cannot evaluate; treat as failure
             }
             const float DragR = FMath::Max(DragE.X, DragE.Y);
+            if (bQueryNeighbors)
+            {
+                GatherNeighbors(DragC, DragR);
+            }
 
             bool bAnyViolation = false;
             FVector AccumulatedPush = FVector::ZeroVector;
@@ -1636,6 +1742,10 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
             if (GetActorBoundsForSnap(DraggedWorkArea, DragC2, DragE2))
             {
                 const float DragR2 = FMath::Max(DragE2.X, DragE2.Y);
+                if (bQueryNeighbors)
+                {
+                    GatherNeighbors(DragC2, DragR2);
+                }
                 bool bStillBad = false;
                 for (AActor* N : Neighbors)
                 {
@@ -1735,6 +1845,8 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
 
 void AExtendedControllerBase::MoveWorkArea_Local(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_RTSPlacement_DragWorkArea);
+
     // Ensure we have a unit and a dragged work area
     if (SelectedUnits.Num() == 0 || !SelectedUnits[0])
     {
@@ -1925,10 +2037,7 @@ void AExtendedControllerBase::MoveWorkArea_Local(float DeltaSeconds)
     //CollisionParams.AddIgnoredActor(DraggedWorkArea);
 
 	// Ignore all actors of class AWorkArea
-	for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-	{
-		CollisionParams.AddIgnoredActor(*It);
-	}
+	IgnoreWorkAreasAlongTrace(GetWorld(), Start, End, CollisionParams);
 	
 	bool bHit = GetWorld()->LineTraceSingleByChannel(
 		HitResult,
@@ -2144,74 +2253,9 @@ void AExtendedControllerBase::MoveWorkArea_Local(float DeltaSeconds)
     //---------------------------------
     // If no snap from overlap, try a fallback proximity scan (works with ISMs without overlaps)
     //---------------------------------
+    if (TrySnapViaProximity(DraggedWorkArea, MouseGround))
     {
-        AActor* BestCandidate = nullptr;
-        UStaticMeshComponent* BestCandidateMesh = nullptr;
-        float BestCandidateDist = TNumericLimits<float>::Max();
-
-        // Scan WorkAreas
-        for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-        {
-            AWorkArea* Candidate = *It;
-            if (!Candidate || Candidate == DraggedWorkArea) continue;
-
-            if (Candidate->IsNoBuildZone)
-            {
-                // Visual feedback only; don't snap to no-build zones
-                DraggedWorkArea->TemporarilyChangeMaterial();
-                continue;
-            }
-            if (Candidate->Type == WorkAreaData::Primary ||
-                Candidate->Type == WorkAreaData::Secondary ||
-                Candidate->Type == WorkAreaData::Tertiary ||
-                Candidate->Type == WorkAreaData::Rare ||
-                Candidate->Type == WorkAreaData::Epic ||
-                Candidate->Type == WorkAreaData::Legendary)
-            {
-                continue; // resources are not snap targets
-            }
-
-            FVector OtherCenter, OtherExtent;
-            if (!GetActorBoundsForSnap(Candidate, OtherCenter, OtherExtent))
-                continue;
-
-            const float XYDistance = FVector::Dist2D(DraggedWorkArea->GetActorLocation(), Candidate->GetActorLocation());
-            const float CombinedXYExtent = (Extent.X + OtherExtent.X + Extent.Y + OtherExtent.Y) * 0.5f;
-            const float SnapThreshold = SnapDistance + SnapGap + CombinedXYExtent;
-            if (XYDistance < SnapThreshold && XYDistance < BestCandidateDist)
-            {
-                BestCandidate = Candidate;
-                BestCandidateMesh = Candidate->Mesh; // may be null; SnapToActor can handle
-                BestCandidateDist = XYDistance;
-            }
-        }
-
-        // Scan Buildings
-        for (TActorIterator<ABuildingBase> ItB(GetWorld()); ItB; ++ItB)
-        {
-            ABuildingBase* Candidate = *ItB;
-            if (!Candidate) continue;
-
-            FVector OtherCenter, OtherExtent;
-            if (!GetActorBoundsForSnap(Candidate, OtherCenter, OtherExtent))
-                continue;
-
-            const float XYDistance = FVector::Dist2D(DraggedWorkArea->GetActorLocation(), Candidate->GetActorLocation());
-            const float CombinedXYExtent = (Extent.X + OtherExtent.X + Extent.Y + OtherExtent.Y) * 0.5f;
-            const float SnapThreshold = SnapDistance + SnapGap + CombinedXYExtent;
-            if (XYDistance < SnapThreshold && XYDistance < BestCandidateDist)
-            {
-                BestCandidate = Candidate;
-                BestCandidateMesh = nullptr; // buildings may be ISM; let SnapToActor resolve bounds
-                BestCandidateDist = XYDistance;
-            }
-        }
-
-        if (BestCandidate)
-        {
-            SnapToActor(DraggedWorkArea, BestCandidate, BestCandidateMesh);
-            return;
-        }
+        return;
     }
 
     //---------------------------------
@@ -2504,74 +2548,9 @@ void AExtendedControllerBase::SetWorkArea(FTransform AreaTransform)
     //---------------------------------
     // If no snap from overlap, try a fallback proximity scan (works with ISMs without overlaps)
     //---------------------------------
+    if (TrySnapViaProximity(DraggedWorkArea, MouseGround))
     {
-        AActor* BestCandidate = nullptr;
-        UStaticMeshComponent* BestCandidateMesh = nullptr;
-        float BestCandidateDist = TNumericLimits<float>::Max();
-
-        // Scan WorkAreas
-        for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-        {
-            AWorkArea* Candidate = *It;
-            if (!Candidate || Candidate == DraggedWorkArea) continue;
-
-            if (Candidate->IsNoBuildZone)
-            {
-                // Visual feedback only; don't snap to no-build zones
-                DraggedWorkArea->TemporarilyChangeMaterial();
-                continue;
-            }
-            if (Candidate->Type == WorkAreaData::Primary ||
-                Candidate->Type == WorkAreaData::Secondary ||
-                Candidate->Type == WorkAreaData::Tertiary ||
-                Candidate->Type == WorkAreaData::Rare ||
-                Candidate->Type == WorkAreaData::Epic ||
-                Candidate->Type == WorkAreaData::Legendary)
-            {
-                continue; // resources are not snap targets
-            }
-
-            FVector OtherCenter, OtherExtent;
-            if (!GetActorBoundsForSnap(Candidate, OtherCenter, OtherExtent))
-                continue;
-
-            const float XYDistance = FVector::Dist2D(DraggedWorkArea->GetActorLocation(), Candidate->GetActorLocation());
-            const float CombinedXYExtent = (Extent.X + OtherExtent.X + Extent.Y + OtherExtent.Y) * 0.5f;
-            const float SnapThreshold = SnapDistance + SnapGap + CombinedXYExtent;
-            if (XYDistance < SnapThreshold && XYDistance < BestCandidateDist)
-            {
-                BestCandidate = Candidate;
-                BestCandidateMesh = Candidate->Mesh; // may be null; SnapToActor can handle
-                BestCandidateDist = XYDistance;
-            }
-        }
-
-        // Scan Buildings
-        for (TActorIterator<ABuildingBase> ItB(GetWorld()); ItB; ++ItB)
-        {
-            ABuildingBase* Candidate = *ItB;
-            if (!Candidate) continue;
-
-            FVector OtherCenter, OtherExtent;
-            if (!GetActorBoundsForSnap(Candidate, OtherCenter, OtherExtent))
-                continue;
-
-            const float XYDistance = FVector::Dist2D(DraggedWorkArea->GetActorLocation(), Candidate->GetActorLocation());
-            const float CombinedXYExtent = (Extent.X + OtherExtent.X + Extent.Y + OtherExtent.Y) * 0.5f;
-            const float SnapThreshold = SnapDistance + SnapGap + CombinedXYExtent;
-            if (XYDistance < SnapThreshold && XYDistance < BestCandidateDist)
-            {
-                BestCandidate = Candidate;
-                BestCandidateMesh = nullptr; // buildings may be ISM; let SnapToActor resolve bounds
-                BestCandidateDist = XYDistance;
-            }
-        }
-
-        if (BestCandidate)
-        {
-            SnapToActor(DraggedWorkArea, BestCandidate, BestCandidateMesh);
-            return;
-        }
+        return;
     }
 
     //---------------------------------
@@ -2594,6 +2573,8 @@ void AExtendedControllerBase::SetWorkArea(FTransform AreaTransform)
 
 void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
 {
+    SCOPE_CYCLE_COUNTER(STAT_RTSPlacement_DragAbilityIndicator);
+
     // Follow-mouse and snap/pushback like WorkArea, but only when DetectOverlapWithWorkArea is enabled
     if (SelectedUnits.Num() == 0)
     {
@@ -2744,8 +2725,9 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
                 BestDist = D; BestCandidate = Candidate;
             }
         };
-        for (TActorIterator<AWorkArea> ItWA(World); ItWA; ++ItWA) { ConsiderActor(*ItWA); }
-        for (TActorIterator<ABuildingBase> ItBD(World); ItBD; ++ItBD) { ConsiderActor(*ItBD); }
+        TArray<AActor*> Candidates;
+        GatherSnapNeighbors(World, DesiredGrounded, DragXY, Candidates);
+        for (AActor* Candidate : Candidates) { ConsiderActor(Candidate); }
 
         auto ComputeSnapForIndicator = [&](AActor* OtherActor, FVector& OutLoc)
         {
@@ -2791,9 +2773,20 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
             const float Padding = 1.0f;
             const float MinStep = 0.1f;
             bOutAllGood = false;
+            // Same neighbor gathering as MoveWorkArea_Local_Simplified
+            const bool bQueryNeighbors = UPlacementSpatialIndexSubsystem::GetIfEnabled(World) != nullptr;
             TArray<AActor*> Neighbors;
-            for (TActorIterator<AWorkArea> ItWA2(World); ItWA2; ++ItWA2) { if (*ItWA2) Neighbors.Add(*ItWA2); }
-            for (TActorIterator<ABuildingBase> ItBD2(World); ItBD2; ++ItBD2) { if (*ItBD2) Neighbors.Add(*ItBD2); }
+            auto GatherNeighbors = [&](const FVector& DragC, float DragR)
+            {
+                float Reach = DragR + SnapGap;
+                if (CurrentIndicator->DetectOverlapWithWorkArea && CurrentIndicator->DenyPlacementCloseToResources)
+                {
+                    Reach = FMath::Max(Reach, CurrentIndicator->ResourcePlacementDistance);
+                }
+                Neighbors.Reset();
+                GatherSnapNeighbors(World, DragC, Reach, Neighbors);
+            };
+            if (!bQueryNeighbors) { GatherNeighbors(FVector::ZeroVector, 0.f); }
             FVector Working = InOutLoc;
             bool bSolved = false;
             for (int32 Iter=0; Iter<MaxIterations; ++Iter)
@@ -2802,6 +2795,7 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
                 const FBoxSphereBounds DragNow = CurrentIndicator->IndicatorMesh->CalcBounds(CurrentIndicator->IndicatorMesh->GetComponentTransform());
                 const FVector DragExtNow = DragNow.BoxExtent;
                 const float DragR = FMath::Max(DragExtNow.X, DragExtNow.Y);
+                if (bQueryNeighbors) { GatherNeighbors(DragNow.Origin, DragR); }
                 bool bAnyViolation = false;
                 FVector Accum = FVector::ZeroVector;
                 for (AActor* N : Neighbors)
@@ -2849,6 +2843,7 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
                 const FBoxSphereBounds DragNow = CurrentIndicator->IndicatorMesh->CalcBounds(CurrentIndicator->IndicatorMesh->GetComponentTransform());
                 const FVector DragExtNow = DragNow.BoxExtent;
                 const float DragR = FMath::Max(DragExtNow.X, DragExtNow.Y);
+                if (bQueryNeighbors) { GatherNeighbors(DragNow.Origin, DragR); }
                 bool bStillBad = false;
                 for (AActor* N : Neighbors)
                 {
@@ -3618,6 +3613,7 @@ void AExtendedControllerBase::Server_AssignTagToSelectedUnits_Implementation(FGa
 			{
 				Unit->UnitTags.RemoveTag(Tag);
 			}
+			RTSGameMode->RefreshAliveUnit(Unit);
 		}
 	}
 }
@@ -3645,6 +3641,10 @@ void AExtendedControllerBase::Client_UpdateHUDSelection_Implementation(const TAr
 	}
 	CurrentUnitWidgetIndex = 0;
 	SelectedUnits = HUDBase->SelectedUnits;
+	if (ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(this))
+	{
+		CustomPC->UpdateSelectionCircles();
+	}
 }
 
 void AExtendedControllerBase::Client_DeselectSingleUnit_Implementation(AUnitBase* UnitToDeselect)
@@ -3662,6 +3662,10 @@ void AExtendedControllerBase::Client_DeselectSingleUnit_Implementation(AUnitBase
 
 	// Update the controller's selected units
 	SelectedUnits = HUDBase->SelectedUnits;
+	if (ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(this))
+	{
+		CustomPC->UpdateSelectionCircles();
+	}
 }
 
 void AExtendedControllerBase::AddToCurrentUnitWidgetIndex(int Add)
@@ -3718,6 +3722,10 @@ void AExtendedControllerBase::SendWorkerToResource_Implementation(AWorkingUnitBa
 	if (!Worker || !Worker->IsWorker) return;
 	
 	Worker->ResourcePlace = WorkArea;
+	if (AResourceGameMode* ResourceGameMode = Cast<AResourceGameMode>(GetWorld()->GetAuthGameMode()))
+	{
+		ResourceGameMode->UpdateWorkerAssignment(Worker);
+	}
 	Worker->SetUnitState(UnitData::GoToResourceExtraction);
 	Worker->SwitchEntityTagByState(UnitData::GoToResourceExtraction, Worker->UnitStatePlaceholder);
 
@@ -6,6 +6,28 @@
 #include "Characters/Unit/UnitBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "System/UnitAttributeSyncSubsystem.h"
+#include "System/UnitUIUpdateSubsystem.h"
+#include "Widgets/SquadHealthBar.h"
+
+namespace
+{
+	// Health.SetCurrentValue and Shield = ... bypass the ability system component, so no change delegate fires for them
+	void QueueDirectAttributeSync(const UAttributeSet* AttributeSet, EUnitSyncedAttribute Attribute)
+	{
+		if (!UUnitAttributeSyncSubsystem::IsEnabled())
+		{
+			return;
+		}
+
+		AUnitBase* UnitBase = Cast<AUnitBase>(AttributeSet->GetOwningActor());
+		UWorld* World = UnitBase ? UnitBase->GetWorld() : nullptr;
+		if (UUnitAttributeSyncSubsystem* AttributeSync = World ? World->GetSubsystem<UUnitAttributeSyncSubsystem>() : nullptr)
+		{
+			AttributeSync->QueueAttributeChange(UnitBase, Attribute);
+		}
+	}
+}
 
 UAttributeSetBase::UAttributeSetBase()
 {
@@ -73,6 +95,10 @@ void UAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallba
 
 	if(UnitBase && UnitBase->GetUnitState() != UnitData::Dead)
 	{
+		// Widget refreshes and threshold events are flushed once per unit and frame when coalescing is on
+		UUnitUIUpdateSubsystem* UIUpdates = UUnitUIUpdateSubsystem::IsEnabled() && UnitBase->GetWorld()
+			? UnitBase->GetWorld()->GetSubsystem<UUnitUIUpdateSubsystem>() : nullptr;
+
 		// Turn on Healthbar Visibility
 
 		if(Data.EvaluatedData.Attribute == GetEffectDamageAttribute())
@@ -83,6 +109,10 @@ void UAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallba
 
 			if (GetHealth() <= 0)
 			{
+				if (UIUpdates)
+				{
+					UIUpdates->FlushUnit(UnitBase);
+				}
 				UnitBase->SwitchEntityTagByState(UnitData::Dead, UnitData::Dead);
 				UnitBase->DeadEffectsAndEvents();
 				return;
@@ -112,7 +142,11 @@ void UAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallba
 				{
 					const float NewHealthProjected = FMath::Clamp(GetHealth() + DamageAmount, 0.0f, GetMaxHealth());
 					const float MaxH = GetMaxHealth();
-					if (MaxH > 0.f && OldHealth != NewHealthProjected)
+					if (UIUpdates)
+					{
+						UIUpdates->QueueHealthChange(UnitBase, OldHealth, NewHealthProjected);
+					}
+					else if (MaxH > 0.f && OldHealth != NewHealthProjected)
 					{
 						const float OldPct = OldHealth / MaxH;
 						const float NewPct = NewHealthProjected / MaxH;
@@ -129,6 +163,12 @@ void UAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallba
 
 				if (GetHealth() <= 0)
 				{
+					// Threshold events of this frame run before the death handling; the rest runs directly as before
+					if (UIUpdates)
+					{
+						UIUpdates->FlushUnit(UnitBase);
+						UIUpdates = nullptr;
+					}
 					UnitBase->SwitchEntityTagByState(UnitData::Dead, UnitData::Dead);
 					UnitBase->DeadEffectsAndEvents();
 				}
@@ -141,7 +181,11 @@ void UAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallba
 				{
 					const float NewHealthProjected = FMath::Clamp(GetHealth() + DamageAmount, 0.0f, GetMaxHealth());
 					const float MaxH = GetMaxHealth();
-					if (MaxH > 0.f && OldHealth != NewHealthProjected)
+					if (UIUpdates)
+					{
+						UIUpdates->QueueHealthChange(UnitBase, OldHealth, NewHealthProjected);
+					}
+					else if (MaxH > 0.f && OldHealth != NewHealthProjected)
 					{
 						const float OldPct = OldHealth / MaxH;
 						const float NewPct = NewHealthProjected / MaxH;
@@ -158,10 +202,24 @@ void UAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallba
 
 			if (OldHealth + DamageAmount <= GetMaxHealth())
 			{
-				UnitBase->HealthbarCollapseCheck(OldHealth + DamageAmount , OldHealth);
+				if (UIUpdates)
+				{
+					UIUpdates->QueueHealthCollapseCheck(UnitBase, OldHealth + DamageAmount, OldHealth);
+				}
+				else
+				{
+					UnitBase->HealthbarCollapseCheck(OldHealth + DamageAmount , OldHealth);
+				}
 			}
 			
-			UnitBase->UpdateWidget();
+			if (UIUpdates)
+			{
+				UIUpdates->QueueWidgetUpdate(UnitBase);
+			}
+			else
+			{
+				UnitBase->UpdateWidget();
+			}
 		}
 
 		if(Data.EvaluatedData.Attribute == GetEffectShieldAttribute() && GetHealth() > 0)
@@ -172,12 +230,26 @@ void UAttributeSetBase::PostGameplayEffectExecute(const FGameplayEffectModCallba
 			
 			if (OldShield + ShieldAmount <= GetMaxShield())
 			{
-				UnitBase->ShieldCollapseCheck(OldShield + ShieldAmount, OldShield);
+				if (UIUpdates)
+				{
+					UIUpdates->QueueShieldCollapseCheck(UnitBase, OldShield + ShieldAmount, OldShield);
+				}
+				else
+				{
+					UnitBase->ShieldCollapseCheck(OldShield + ShieldAmount, OldShield);
+				}
 				SpawnIndicator(ShieldAmount, FLinearColor::Blue, FLinearColor::White, 0.7f);
 			}
 			SetAttributeShield(OldShield + ShieldAmount);
 		
-			UnitBase->UpdateWidget();
+			if (UIUpdates)
+			{
+				UIUpdates->QueueWidgetUpdate(UnitBase);
+			}
+			else
+			{
+				UnitBase->UpdateWidget();
+			}
 		}
 	}
 
@@ -232,6 +304,11 @@ void UAttributeSetBase::SetAttributeHealth(float NewHealth)
 	{
 		Health.SetCurrentValue(FMath::Max(NewHealth, 0.0f));
 	}
+
+	QueueDirectAttributeSync(this, EUnitSyncedAttribute::Health);
+	// No change delegate fires for this write, the squad totals are updated here
+	FSquadHealthRegistry::UpdateUnit(Cast<AUnitBase>(GetOwningActor()));
+	OnDirectHealthWrite.Broadcast(this);
 }
 
 void UAttributeSetBase::OnRep_Shield(const FGameplayAttributeData& OldShield)
@@ -262,6 +339,10 @@ void UAttributeSetBase::SetAttributeShield(float NewShield)
 	{
 		Shield = NewShield;
 	}
+
+	QueueDirectAttributeSync(this, EUnitSyncedAttribute::Shield);
+	FSquadHealthRegistry::UpdateUnit(Cast<AUnitBase>(GetOwningActor()));
+	OnDirectHealthWrite.Broadcast(this);
 }
 
 void UAttributeSetBase::OnRep_AttackDamage(const FGameplayAttributeData& OldAttackDamage)
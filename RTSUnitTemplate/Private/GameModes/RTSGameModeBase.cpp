@@ -39,15 +39,20 @@
 #include "System/MapSwitchSubsystem.h"
 #include "Engine/GameInstance.h"
 
+static TAutoConsoleVariable<int32> CVarRTS_WinLose_ValidateCounters(
+	TEXT("net.RTS.WinLose.ValidateCounters"),
+	0,
+	TEXT("Non-shipping builds: 1 = compare the incremental alive counters against a full unit scan on every win/lose evaluation and log mismatches."),
+	ECVF_Default);
+
 
 void ARTSGameModeBase::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Alive counters are not reset here: level units may already have registered before the GameMode begins play
 	TagsDestroyedCountMap.Empty();
-	TagsAliveCountMap.Empty();
 	TeamTagsDestroyedCountMap.Empty();
-	TeamTagsAliveCountMap.Empty();
 	bWinLoseTriggered = false;
 
 	FillUnitArrays();
@@ -255,93 +260,208 @@ float ARTSGameModeBase::GetResource(int32 TeamId, EResourceType ResourceType) co
 	return 0.f;
 }
 
-void ARTSGameModeBase::CheckWinLoseCondition(AUnitBase* DestroyedUnit)
+void ARTSGameModeBase::RegisterAliveUnit(ASpawnerUnit* Unit)
 {
-	if (DestroyedUnit && bInitialSpawnFinished)
+	if (!Unit || !IsValid(Unit) || AliveUnitRecords.Contains(Unit)) return;
+
+	if (AAbilityUnit* AbilityUnit = Cast<AAbilityUnit>(Unit))
 	{
-		for (auto TagIt = DestroyedUnit->UnitTags.CreateConstIterator(); TagIt; ++TagIt)
-		{
-			TagsDestroyedCountMap.FindOrAdd(*TagIt)++;
-			TeamTagsDestroyedCountMap.FindOrAdd(DestroyedUnit->TeamId).TagCounts.FindOrAdd(*TagIt)++;
-		}
+		if (AbilityUnit->GetUnitState() == UnitData::Dead) return;
 	}
 
-	if (bWinLoseTriggered) return;
-	if (WinLoseConfigActors.Num() == 0) return;
+	FAliveUnitRecord Record;
+	Record.TeamId = Unit->TeamId;
+	Record.Tags = Unit->UnitTags;
+	Record.bIsBuilding = Unit->IsA<ABuildingBase>();
 
-	TArray<ABuildingBase*> AllBuildings;
-	TagsAliveCountMap.Empty();
-	TeamTagsAliveCountMap.Empty();
-	bool bNeedBuildings = false;
-	bool bNeedTags = false;
+	AddAliveRecord(Record);
+	AliveUnitRecords.Add(Unit, MoveTemp(Record));
+}
 
-	for (AWinLoseConfigActor* Config : WinLoseConfigActors)
+void ARTSGameModeBase::UnregisterAliveUnit(ASpawnerUnit* Unit)
+{
+	if (!Unit) return;
+
+	FAliveUnitRecord Record;
+	if (AliveUnitRecords.RemoveAndCopyValue(Unit, Record))
 	{
-		EWinLoseCondition CurrentWinCondition = Config->GetCurrentWinCondition();
-		if (CurrentWinCondition == EWinLoseCondition::AllBuildingsDestroyed || 
-			Config->LoseCondition == EWinLoseCondition::AllBuildingsDestroyed)
-		{
-			bNeedBuildings = true;
-		}
-		
-		if (CurrentWinCondition == EWinLoseCondition::TaggedUnitsDestroyed ||
-			CurrentWinCondition == EWinLoseCondition::TaggedUnitsSpawned ||
-			Config->LoseCondition == EWinLoseCondition::TaggedUnitsDestroyed || 
-			Config->LoseCondition == EWinLoseCondition::TaggedUnitsSpawned ||
-			Config->WinLoseTargetTags.Num() > 0)
-		{
-			bNeedTags = true;
-		}
+		RemoveAliveRecord(Record);
+	}
+}
+
+void ARTSGameModeBase::RefreshAliveUnit(ASpawnerUnit* Unit)
+{
+	if (!Unit) return;
+
+	FAliveUnitRecord* Record = AliveUnitRecords.Find(Unit);
+	if (!Record) return;
+
+	if (Record->TeamId == Unit->TeamId && Record->Tags == Unit->UnitTags) return;
+
+	RemoveAliveRecord(*Record);
+	Record->TeamId = Unit->TeamId;
+	Record->Tags = Unit->UnitTags;
+	AddAliveRecord(*Record);
+}
+
+void ARTSGameModeBase::AddAliveRecord(const FAliveUnitRecord& Record)
+{
+	if (Record.bIsBuilding)
+	{
+		TeamBuildingsAliveCountMap.FindOrAdd(Record.TeamId)++;
+	}
+
+	if (Record.Tags.Num() == 0) return;
 
-		for (const FWinConditionData& ConditionData : Config->WinConditions)
+	FTagCountMap& TeamCounts = TeamTagsAliveCountMap.FindOrAdd(Record.TeamId);
+	for (auto TagIt = Record.Tags.CreateConstIterator(); TagIt; ++TagIt)
+	{
+		TagsAliveCountMap.FindOrAdd(*TagIt)++;
+		TeamCounts.TagCounts.FindOrAdd(*TagIt)++;
+	}
+}
+
+void ARTSGameModeBase::RemoveAliveRecord(const FAliveUnitRecord& Record)
+{
+	// Keys are dropped at zero so the maps look exactly like a fresh scan would produce them
+	if (Record.bIsBuilding)
+	{
+		if (int32* Count = TeamBuildingsAliveCountMap.Find(Record.TeamId))
 		{
-			if (ConditionData.Condition == EWinLoseCondition::TaggedUnitsDestroyed || 
-				ConditionData.Condition == EWinLoseCondition::TaggedUnitsSpawned ||
-				ConditionData.WinLoseTargetTags.Num() > 0 ||
-				ConditionData.TargetTagCounts.Num() > 0)
+			if (--(*Count) <= 0)
 			{
-				bNeedTags = true;
-				break;
+				TeamBuildingsAliveCountMap.Remove(Record.TeamId);
 			}
 		}
 	}
 
-	if (bNeedBuildings || bNeedTags)
+	if (Record.Tags.Num() == 0) return;
+
+	FTagCountMap* TeamCounts = TeamTagsAliveCountMap.Find(Record.TeamId);
+	for (auto TagIt = Record.Tags.CreateConstIterator(); TagIt; ++TagIt)
 	{
-		for (TActorIterator<ASpawnerUnit> It(GetWorld()); It; ++It)
+		if (int32* Count = TagsAliveCountMap.Find(*TagIt))
 		{
-			ASpawnerUnit* Spawner = *It;
-			if (Spawner && Spawner != DestroyedUnit)
+			if (--(*Count) <= 0)
 			{
-				// Check if it's dead (if it has a state)
-				if (AAbilityUnit* AbilityUnit = Cast<AAbilityUnit>(Spawner))
-				{
-					if (AbilityUnit->GetUnitState() == UnitData::Dead)
-					{
-						continue;
-					}
-				}
+				TagsAliveCountMap.Remove(*TagIt);
+			}
+		}
 
-				if (ABuildingBase* Building = Cast<ABuildingBase>(Spawner))
-				{
-					AllBuildings.Add(Building);
-				}
-				
-				for (auto TagIt = Spawner->UnitTags.CreateConstIterator(); TagIt; ++TagIt)
+		if (TeamCounts)
+		{
+			if (int32* Count = TeamCounts->TagCounts.Find(*TagIt))
+			{
+				if (--(*Count) <= 0)
 				{
-					TagsAliveCountMap.FindOrAdd(*TagIt)++;
-					TeamTagsAliveCountMap.FindOrAdd(Spawner->TeamId).TagCounts.FindOrAdd(*TagIt)++;
+					TeamCounts->TagCounts.Remove(*TagIt);
 				}
 			}
 		}
+	}
 
-		if (bNeedBuildings)
+	if (TeamCounts && TeamCounts->TagCounts.Num() == 0)
+	{
+		TeamTagsAliveCountMap.Remove(Record.TeamId);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+void ARTSGameModeBase::ValidateAliveCounters() const
+{
+	TMap<FGameplayTag, int32> ScannedTags;
+	TMap<int32, FTagCountMap> ScannedTeamTags;
+	TMap<int32, int32> ScannedBuildings;
+
+	for (TActorIterator<ASpawnerUnit> It(GetWorld()); It; ++It)
+	{
+		ASpawnerUnit* Spawner = *It;
+		if (!IsValid(Spawner)) continue;
+
+		if (AAbilityUnit* AbilityUnit = Cast<AAbilityUnit>(Spawner))
 		{
-			if (!bBuildingsEverExisted && AllBuildings.Num() > 0)
+			if (AbilityUnit->GetUnitState() == UnitData::Dead) continue;
+		}
+
+		if (Spawner->IsA<ABuildingBase>())
+		{
+			ScannedBuildings.FindOrAdd(Spawner->TeamId)++;
+		}
+
+		for (auto TagIt = Spawner->UnitTags.CreateConstIterator(); TagIt; ++TagIt)
+		{
+			ScannedTags.FindOrAdd(*TagIt)++;
+			ScannedTeamTags.FindOrAdd(Spawner->TeamId).TagCounts.FindOrAdd(*TagIt)++;
+		}
+	}
+
+	// Units register one tick after spawning, so a single mismatch right after a spawn wave can be transient
+	bool bMismatch = !ScannedTags.OrderIndependentCompareEqual(TagsAliveCountMap)
+		|| !ScannedBuildings.OrderIndependentCompareEqual(TeamBuildingsAliveCountMap)
+		|| ScannedTeamTags.Num() != TeamTagsAliveCountMap.Num();
+
+	for (const auto& Pair : ScannedTeamTags)
+	{
+		if (bMismatch) break;
+		const FTagCountMap* Counted = TeamTagsAliveCountMap.Find(Pair.Key);
+		bMismatch = !Counted || !Counted->TagCounts.OrderIndependentCompareEqual(Pair.Value.TagCounts);
+	}
+
+	if (bMismatch)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ARTSGameModeBase::ValidateAliveCounters: Counter mismatch! Tags %d/%d, TeamTags %d/%d, BuildingTeams %d/%d (counted/scanned)"),
+			TagsAliveCountMap.Num(), ScannedTags.Num(), TeamTagsAliveCountMap.Num(), ScannedTeamTags.Num(),
+			TeamBuildingsAliveCountMap.Num(), ScannedBuildings.Num());
+	}
+}
+#endif
+
+void ARTSGameModeBase::CheckWinLoseCondition(AUnitBase* DestroyedUnit)
+{
+	if (DestroyedUnit)
+	{
+		if (bInitialSpawnFinished)
+		{
+			for (auto TagIt = DestroyedUnit->UnitTags.CreateConstIterator(); TagIt; ++TagIt)
 			{
-				bBuildingsEverExisted = true;
+				TagsDestroyedCountMap.FindOrAdd(*TagIt)++;
+				TeamTagsDestroyedCountMap.FindOrAdd(DestroyedUnit->TeamId).TagCounts.FindOrAdd(*TagIt)++;
 			}
 		}
+
+		UnregisterAliveUnit(DestroyedUnit);
+
+		PendingDestroyedTagsByTeam.FindOrAdd(DestroyedUnit->TeamId).AppendTags(DestroyedUnit->UnitTags);
+	}
+
+	if (bWinLoseEvaluationPending) return;
+
+	// Several deaths in one frame share a single evaluation
+	bWinLoseEvaluationPending = true;
+	GetWorldTimerManager().SetTimerForNextTick(this, &ARTSGameModeBase::EvaluateWinLoseCondition);
+}
+
+void ARTSGameModeBase::EvaluateWinLoseCondition()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_RTSGameMode_EvaluateWinLoseCondition);
+
+	bWinLoseEvaluationPending = false;
+	const TMap<int32, FGameplayTagContainer> DestroyedTagsByTeam = MoveTemp(PendingDestroyedTagsByTeam);
+	PendingDestroyedTagsByTeam.Reset();
+
+	if (bWinLoseTriggered) return;
+	if (WinLoseConfigActors.Num() == 0) return;
+
+#if !UE_BUILD_SHIPPING
+	if (CVarRTS_WinLose_ValidateCounters.GetValueOnGameThread() > 0)
+	{
+		ValidateAliveCounters();
+	}
+#endif
+
+	if (!bBuildingsEverExisted && TeamBuildingsAliveCountMap.Num() > 0)
+	{
+		bBuildingsEverExisted = true;
 	}
 
 	// Update TagProgress for ALL configs so UI is correct even during delay
@@ -389,9 +509,9 @@ void ARTSGameModeBase::CheckWinLoseCondition(AUnitBase* DestroyedUnit)
 					bool bFriendlyBuildingsExist = false;
 					bool bEnemyBuildingsExist = false;
 
-					for (ABuildingBase* Building : AllBuildings)
+					for (const auto& Pair : TeamBuildingsAliveCountMap)
 					{
-						if (Building->TeamId == PlayerTeamId) bFriendlyBuildingsExist = true;
+						if (Pair.Key == PlayerTeamId) bFriendlyBuildingsExist = true;
 						else bEnemyBuildingsExist = true;
 					}
 
@@ -405,6 +525,7 @@ void ARTSGameModeBase::CheckWinLoseCondition(AUnitBase* DestroyedUnit)
 				{
 					bool bAllTagsMet = true;
 					bool bLastDestroyedWasFriendly = false;
+					const FGameplayTagContainer* FriendlyDestroyedTags = DestroyedTagsByTeam.Find(PlayerTeamId);
 
 					const FGameplayTagContainer& TargetTags = CurrentWinData.WinLoseTargetTags.Num() > 0 ? CurrentWinData.WinLoseTargetTags : Config->WinLoseTargetTags;
 					if (TargetTags.Num() == 0 || Config->TagProgress.Num() == 0) bAllTagsMet = false;
@@ -413,7 +534,7 @@ void ARTSGameModeBase::CheckWinLoseCondition(AUnitBase* DestroyedUnit)
 					{
 						if (Progress.TotalCount > 0 && Progress.AliveCount == 0)
 						{
-							if (DestroyedUnit && DestroyedUnit->UnitTags.HasTagExact(Progress.Tag) && DestroyedUnit->TeamId == PlayerTeamId)
+							if (FriendlyDestroyedTags && FriendlyDestroyedTags->HasTagExact(Progress.Tag))
 							{
 								bLastDestroyedWasFriendly = true;
 							}
@@ -505,15 +626,7 @@ void ARTSGameModeBase::CheckWinLoseCondition(AUnitBase* DestroyedUnit)
 			{
 				if (Config->LoseCondition == EWinLoseCondition::AllBuildingsDestroyed)
 				{
-					bool bTeamBuildingsExist = false;
-					for (ABuildingBase* Building : AllBuildings)
-					{
-						if (Building->TeamId == PlayerTeamId)
-						{
-							bTeamBuildingsExist = true;
-							break;
-						}
-					}
+					const bool bTeamBuildingsExist = TeamBuildingsAliveCountMap.Contains(PlayerTeamId);
 
 					if (!bTeamBuildingsExist)
 					{
@@ -18,6 +18,18 @@
 #include "System/MapSwitchSubsystem.h"
 #include "Engine/GameInstance.h"
 
+static TAutoConsoleVariable<int32> CVarRTS_Work_SpatialIndex(
+	TEXT("net.RTS.Work.SpatialIndex"),
+	1,
+	TEXT("1 = closest base / resource / build area queries use the game mode's grid index, 0 = linear scan and full sort of the WorkAreaGroups arrays."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_Work_VerifyWorkerRegistry(
+	TEXT("net.RTS.Work.VerifyWorkerRegistry"),
+	0,
+	TEXT("1 = whenever worker limits or counts are updated, compare the per team worker registry against a scan over all workers and log mismatches."),
+	ECVF_Default);
+
 AResourceGameMode::AResourceGameMode()
 {
 	ResourceDistanceMultiplier = 2.0f;
@@ -31,6 +43,14 @@ AResourceGameMode::AResourceGameMode()
 void AResourceGameMode::BeginPlay()
 {
 	Super::BeginPlay();
+	// Bases may already have registered themselves, so the grids are re-bucketed rather than reset
+	for (TActorGridIndex<AWorkArea>& ResourceAreaIndex : ResourceAreaIndices)
+	{
+		ResourceAreaIndex.SetCellSize(WorkAreaIndexCellSize);
+	}
+	BuildAreaIndex.SetCellSize(WorkAreaIndexCellSize);
+	BaseIndex.SetCellSize(WorkAreaIndexCellSize);
+
 	// Initialize resources for the game
 	InitializeResources(NumberOfTeams);
 	GatherWorkAreas();
@@ -93,6 +113,7 @@ void AResourceGameMode::GatherBases()
 		if(BuildingBase->IsBase)
 		{
 			WorkAreaGroups.BaseAreas.Add(BuildingBase);
+			BaseIndex.Add(BuildingBase);
 		}
 	}
 
@@ -101,13 +122,19 @@ void AResourceGameMode::GatherBases()
 void AResourceGameMode::AddBaseToGroup(ABuildingBase* BuildingBase)
 {
 	if(BuildingBase && BuildingBase->IsBase && BuildingBase->GetUnitState() != UnitData::Dead)
+	{
 		WorkAreaGroups.BaseAreas.Add(BuildingBase);
+		BaseIndex.Add(BuildingBase);
+	}
 }
 
 void AResourceGameMode::RemoveBaseFromGroup(ABuildingBase* BuildingBase)
 {
 		if(BuildingBase && BuildingBase->IsBase && BuildingBase->GetUnitState() == UnitData::Dead)
+		{
 			WorkAreaGroups.BaseAreas.Remove(BuildingBase);
+			BaseIndex.Remove(BuildingBase);
+		}
 }
 
 void AResourceGameMode::GatherWorkAreas()
@@ -118,40 +145,102 @@ void AResourceGameMode::GatherWorkAreas()
 		AWorkArea* WorkArea = *It;
 		if (!WorkArea) continue;
 
-		switch (WorkArea->Type)
-		{
-		case WorkAreaData::Primary:
-			WorkAreaGroups.PrimaryAreas.Add(WorkArea);
-			break;
-		case WorkAreaData::Secondary:
-			WorkAreaGroups.SecondaryAreas.Add(WorkArea);
-			break;
-		case WorkAreaData::Tertiary:
-			WorkAreaGroups.TertiaryAreas.Add(WorkArea);
-			break;
-		case WorkAreaData::Rare:
-			WorkAreaGroups.RareAreas.Add(WorkArea);
-			break;
-		case WorkAreaData::Epic:
-			WorkAreaGroups.EpicAreas.Add(WorkArea);
-			break;
-		case WorkAreaData::Legendary:
-			WorkAreaGroups.LegendaryAreas.Add(WorkArea);
-			break;
-		/*case WorkAreaData::Base:
-			WorkAreaGroups.BaseAreas.Add(WorkArea);
-			break;*/
-		case WorkAreaData::BuildArea:
-			WorkAreaGroups.BuildAreas.Add(WorkArea);
-			break;
-		default:
-			// Handle any cases not explicitly covered
-			break;
-		}
+		AddWorkAreaToGroup(WorkArea);
 	}
 	
 }
 
+TActorGridIndex<AWorkArea>* AResourceGameMode::GetWorkAreaIndex(WorkAreaData::WorkAreaType Type)
+{
+	if (Type >= WorkAreaData::Primary && Type <= WorkAreaData::Legendary)
+	{
+		return &ResourceAreaIndices[static_cast<int32>(ConvertToResourceType(Type))];
+	}
+	return Type == WorkAreaData::BuildArea ? &BuildAreaIndex : nullptr;
+}
+
+void AResourceGameMode::AddWorkAreaToGroup(AWorkArea* WorkArea)
+{
+	if (!WorkArea) return;
+
+	switch (WorkArea->Type)
+	{
+	case WorkAreaData::Primary:
+		WorkAreaGroups.PrimaryAreas.Add(WorkArea);
+		break;
+	case WorkAreaData::Secondary:
+		WorkAreaGroups.SecondaryAreas.Add(WorkArea);
+		break;
+	case WorkAreaData::Tertiary:
+		WorkAreaGroups.TertiaryAreas.Add(WorkArea);
+		break;
+	case WorkAreaData::Rare:
+		WorkAreaGroups.RareAreas.Add(WorkArea);
+		break;
+	case WorkAreaData::Epic:
+		WorkAreaGroups.EpicAreas.Add(WorkArea);
+		break;
+	case WorkAreaData::Legendary:
+		WorkAreaGroups.LegendaryAreas.Add(WorkArea);
+		break;
+	/*case WorkAreaData::Base:
+		WorkAreaGroups.BaseAreas.Add(WorkArea);
+		break;*/
+	case WorkAreaData::BuildArea:
+		WorkAreaGroups.BuildAreas.Add(WorkArea);
+		break;
+	default:
+		// Handle any cases not explicitly covered
+		break;
+	}
+
+	if (TActorGridIndex<AWorkArea>* Index = GetWorkAreaIndex(WorkArea->Type))
+	{
+		Index->Add(WorkArea);
+	}
+}
+
+void AResourceGameMode::RemoveWorkAreaFromGroup(AWorkArea* WorkArea)
+{
+	if (!WorkArea) return;
+
+	switch (WorkArea->Type)
+	{
+	case WorkAreaData::Primary:
+		WorkAreaGroups.PrimaryAreas.Remove(WorkArea);
+		break;
+	case WorkAreaData::Secondary:
+		WorkAreaGroups.SecondaryAreas.Remove(WorkArea);
+		break;
+	case WorkAreaData::Tertiary:
+		WorkAreaGroups.TertiaryAreas.Remove(WorkArea);
+		break;
+	case WorkAreaData::Rare:
+		WorkAreaGroups.RareAreas.Remove(WorkArea);
+		break;
+	case WorkAreaData::Epic:
+		WorkAreaGroups.EpicAreas.Remove(WorkArea);
+		break;
+	case WorkAreaData::Legendary:
+		WorkAreaGroups.LegendaryAreas.Remove(WorkArea);
+		break;
+	/* case WorkAreaData::Base:
+		WorkAreaGroups.BaseAreas.Remove(WorkArea);
+		break; */
+	case WorkAreaData::BuildArea:
+		WorkAreaGroups.BuildAreas.Remove(WorkArea);
+		break;
+	default:
+		// Handle any cases not explicitly covered
+		break;
+	}
+
+	if (TActorGridIndex<AWorkArea>* Index = GetWorkAreaIndex(WorkArea->Type))
+	{
+		Index->Remove(WorkArea);
+	}
+}
+
 // Adjusting the ModifyResource function to use the ResourceType within FResourceArray
 void AResourceGameMode::ModifyResource_Implementation(EResourceType ResourceType, int32 TeamId, float Amount)
 {
@@ -371,16 +460,18 @@ bool AResourceGameMode::CanAffordConstructionExtended(const FBuildingCost& Const
 
 void AResourceGameMode::AssignWorkAreasToWorkers()
 {
-	TArray<AActor*> TempActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AWorkingUnitBase::StaticClass(), TempActors);
+	TArray<AWorkingUnitBase*> Workers;
+	Workers.Reserve(RegisteredWorkers.Num());
+	for (const TPair<TObjectKey<AWorkingUnitBase>, FRegisteredWorker>& Pair : RegisteredWorkers)
+	{
+		Workers.Add(Pair.Key.ResolveObjectPtr());
+	}
 	
 	// Use the improved AssignWorkAreasToWorker function for each worker
 	// This ensures proper distribution with DistanceThresholdMultiplier and even worker distribution
-	for (AActor* MyActor : TempActors)
+	for (AWorkingUnitBase* Worker : Workers)
 	{
-		AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(MyActor);
-		
-		if (!Worker || !Worker->IsWorker) continue;
+		if (!IsValid(Worker) || !Worker->IsWorker) continue;
 
 		// Use the single worker assignment function which handles:
 		// - DistanceThresholdMultiplier threshold from base
@@ -493,6 +584,7 @@ void AResourceGameMode::AssignWorkAreasToWorker(AWorkingUnitBase* Worker)
 	}
 	
 	Worker->ResourcePlace = BestWorkPlace;
+	UpdateWorkerAssignment(Worker);
 
 	if (Worker->ResourcePlace)
 	{
@@ -509,6 +601,17 @@ void AResourceGameMode::AssignWorkAreasToWorker(AWorkingUnitBase* Worker)
 
 ABuildingBase* AResourceGameMode::GetClosestBaseFromArray(AWorkingUnitBase* Worker, const TArray<ABuildingBase*>& Bases)
 {
+    // The grid mirrors WorkAreaGroups.BaseAreas; other arrays are scanned
+    if (CVarRTS_Work_SpatialIndex.GetValueOnGameThread() > 0 && Worker && &Bases == &WorkAreaGroups.BaseAreas)
+    {
+       const FVector From = Worker->ResourcePlace ? Worker->ResourcePlace->GetActorLocation() : Worker->GetActorLocation();
+       const int32 TeamId = Worker->TeamId;
+       return BaseIndex.FindNearest(From, [TeamId](const ABuildingBase* Base)
+       {
+          return TeamId == Base->TeamId && Base->GetUnitState() != UnitData::Dead;
+       });
+    }
+
     ABuildingBase* ClosestBase = nullptr;
     float MinDistanceSquared = FLT_MAX;
 
@@ -563,7 +666,11 @@ AWorkArea* AResourceGameMode::GetClosestWorkArea(AWorkingUnitBase* Worker, const
 
 TArray<AWorkArea*> AResourceGameMode::GetFiveClosestResourcePlaces(AWorkingUnitBase* Worker)
 {
-	
+	if (CVarRTS_Work_SpatialIndex.GetValueOnGameThread() > 0)
+	{
+		return GatherClosestResourcePlaces(Worker);
+	}
+
 	WorkAreaGroups.PrimaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
 	WorkAreaGroups.SecondaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
 	WorkAreaGroups.TertiaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
@@ -616,6 +723,23 @@ AWorkArea* AResourceGameMode::GetRandomClosestWorkArea(const TArray<AWorkArea*>&
 
 TArray<AWorkArea*> AResourceGameMode::GetClosestBuildPlaces(AWorkingUnitBase* Worker)
 {
+	if (CVarRTS_Work_SpatialIndex.GetValueOnGameThread() > 0 && Worker)
+	{
+		// Same as below: the closest MaxBuildAreasToSet areas of any team, then filtered
+		TArray<TActorGridIndex<AWorkArea>::FNearestEntry, TInlineAllocator<16>> Nearest;
+		BuildAreaIndex.GatherNearest(Worker->GetActorLocation(), MaxBuildAreasToSet, [](const AWorkArea*) { return true; }, Nearest);
+
+		TArray<AWorkArea*> ClosestAreas;
+		for (const TActorGridIndex<AWorkArea>::FNearestEntry& Entry : Nearest)
+		{
+			if (!Entry.Value->PlannedBuilding && (Entry.Value->TeamId == Worker->TeamId || Entry.Value->TeamId == 0))
+			{
+				ClosestAreas.Add(Entry.Value);
+			}
+		}
+		return ClosestAreas;
+	}
+
 	// Clean up all arrays in WorkAreaGroups to remove invalid pointers
 	WorkAreaGroups.BuildAreas.RemoveAll([](const AWorkArea* Area) { return !IsValid(Area); });
     
@@ -745,6 +869,11 @@ float AResourceGameMode::GetResource(int32 TeamId, EResourceType ResourceType) c
 
 TArray<AWorkArea*> AResourceGameMode::GetClosestResourcePlaces(AWorkingUnitBase* Worker)
 {
+	if (CVarRTS_Work_SpatialIndex.GetValueOnGameThread() > 0)
+	{
+		return GatherClosestResourcePlaces(Worker);
+	}
+
 	// Clean up all arrays in WorkAreaGroups to remove invalid pointers
 	WorkAreaGroups.PrimaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
 	WorkAreaGroups.SecondaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
@@ -785,6 +914,33 @@ TArray<AWorkArea*> AResourceGameMode::GetClosestResourcePlaces(AWorkingUnitBase*
 	return ClosestAreas;
 }
 
+TArray<AWorkArea*> AResourceGameMode::GatherClosestResourcePlaces(AWorkingUnitBase* Worker)
+{
+	TArray<AWorkArea*> ClosestAreas;
+	if (!Worker)
+	{
+		return ClosestAreas;
+	}
+
+	const FVector ReferenceLocation = (Worker->Base && IsValid(Worker->Base)) 
+		? Worker->Base->GetActorLocation() 
+		: Worker->GetActorLocation();
+
+	// k-nearest over the grids of all resource types into one sorted buffer
+	TArray<TActorGridIndex<AWorkArea>::FNearestEntry, TInlineAllocator<16>> Nearest;
+	for (const TActorGridIndex<AWorkArea>& ResourceAreaIndex : ResourceAreaIndices)
+	{
+		ResourceAreaIndex.GatherNearest(ReferenceLocation, MaxResourceAreasToSet, [](const AWorkArea*) { return true; }, Nearest);
+	}
+
+	ClosestAreas.Reserve(Nearest.Num());
+	for (const TActorGridIndex<AWorkArea>::FNearestEntry& Entry : Nearest)
+	{
+		ClosestAreas.Add(Entry.Value);
+	}
+	return ClosestAreas;
+}
+
 AWorkArea* AResourceGameMode::GetSuitableWorkAreaToWorker(int TeamId, const TArray<AWorkArea*>& WorkAreas)
 {
 	AWorkArea* BestWorkArea = nullptr;
@@ -834,21 +990,8 @@ AWorkArea* AResourceGameMode::GetSuitableWorkAreaToWorker(int TeamId, const TArr
 
 void AResourceGameMode::AddMaxWorkersForResourceType(int TeamId, EResourceType ResourceType, float Amount)
 {
-	TArray<AActor*> TempActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AWorkingUnitBase::StaticClass(), TempActors);
-	
-	// Correctly use GetWorld()->GetAllActorsOfClass
-	int32 TeamWorkerCount = 0;
-	for (AActor* MyActor : TempActors)
-	{
-		AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(MyActor);
-		if (Worker && Worker->IsWorker && Worker->TeamId == TeamId)
-		{
-			{
-				TeamWorkerCount++;
-			}
-		}
-	}
+	VerifyWorkerRegistry(TeamId);
+	const int32 TeamWorkerCount = GetTeamWorkerCount(TeamId);
 
 	const int CurrentMaxWorkerCount = GetMaxWorkersForResourceType(TeamId, EResourceType::Primary) +
 										GetMaxWorkersForResourceType(TeamId, EResourceType::Secondary) +
@@ -908,31 +1051,148 @@ void AResourceGameMode::SetCurrentWorkersForResourceType(int TeamId, EResourceTy
 
 void AResourceGameMode::SetAllCurrentWorkers(int TeamId)
 {
+	VerifyWorkerRegistry(TeamId);
+
+	// Setting current workers for each resource type that has workers
+	for (int32 TypeIndex = 0; TypeIndex < static_cast<int32>(EResourceType::MAX); ++TypeIndex)
+	{
+		const EResourceType ResourceType = static_cast<EResourceType>(TypeIndex);
+		const int32 AssignedWorkers = GetAssignedWorkerCount(TeamId, ResourceType);
+		if (AssignedWorkers > 0)
+		{
+			SetCurrentWorkersForResourceType(TeamId, ResourceType, AssignedWorkers);
+		}
+	}
+}
+
+AResourceGameMode::FRegisteredWorker AResourceGameMode::DescribeWorker(AWorkingUnitBase* Worker)
+{
+	FRegisteredWorker Registered;
+	Registered.TeamId = Worker->TeamId;
+	Registered.bIsWorker = Worker->IsWorker;
+	if (IsValid(Worker->ResourcePlace) && Cast<AWorkerUnitControllerBase>(Worker->GetController()))
+	{
+		Registered.AssignedPlace = Worker->ResourcePlace;
+		Registered.AssignedType = ConvertToResourceType(Worker->ResourcePlace->Type);
+	}
+	return Registered;
+}
+
+void AResourceGameMode::CountWorker(const FRegisteredWorker& Registered, int32 Delta)
+{
+	FTeamWorkers& Team = TeamWorkers.FindOrAdd(Registered.TeamId);
+	if (Registered.bIsWorker)
+	{
+		Team.WorkerCount += Delta;
+	}
+	if (Registered.AssignedType < EResourceType::MAX)
+	{
+		Team.AssignedWorkers[static_cast<int32>(Registered.AssignedType)] += Delta;
+	}
+}
+
+void AResourceGameMode::RegisterWorker(AWorkingUnitBase* Worker)
+{
+	if (!Worker || RegisteredWorkers.Contains(Worker)) return;
+
+	const FRegisteredWorker& Registered = RegisteredWorkers.Add(Worker, DescribeWorker(Worker));
+	CountWorker(Registered, +1);
+}
+
+void AResourceGameMode::UnregisterWorker(AWorkingUnitBase* Worker)
+{
+	FRegisteredWorker Registered;
+	if (Worker && RegisteredWorkers.RemoveAndCopyValue(Worker, Registered))
+	{
+		CountWorker(Registered, -1);
+	}
+}
+
+void AResourceGameMode::UpdateWorkerAssignment(AWorkingUnitBase* Worker)
+{
+	FRegisteredWorker* Registered = Worker ? RegisteredWorkers.Find(Worker) : nullptr;
+	if (!Registered) return;
+
+	CountWorker(*Registered, -1);
+	*Registered = DescribeWorker(Worker);
+	CountWorker(*Registered, +1);
+}
+
+void AResourceGameMode::HandleWorkAreaEndPlay(AWorkArea* WorkArea)
+{
+	if (!WorkArea) return;
+
+	for (TPair<TObjectKey<AWorkingUnitBase>, FRegisteredWorker>& Pair : RegisteredWorkers)
+	{
+		FRegisteredWorker& Registered = Pair.Value;
+		if (Registered.AssignedPlace == WorkArea)
+		{
+			CountWorker(Registered, -1);
+			Registered.AssignedPlace.Reset();
+			Registered.AssignedType = EResourceType::MAX;
+			CountWorker(Registered, +1);
+		}
+	}
+}
+
+int32 AResourceGameMode::GetTeamWorkerCount(int32 TeamId) const
+{
+	const FTeamWorkers* Team = TeamWorkers.Find(TeamId);
+	return Team ? Team->WorkerCount : 0;
+}
+
+int32 AResourceGameMode::GetAssignedWorkerCount(int32 TeamId, EResourceType ResourceType) const
+{
+	const FTeamWorkers* Team = TeamWorkers.Find(TeamId);
+	return Team && ResourceType < EResourceType::MAX ? Team->AssignedWorkers[static_cast<int32>(ResourceType)] : 0;
+}
+
+void AResourceGameMode::VerifyWorkerRegistry(int32 TeamId) const
+{
+#if !UE_BUILD_SHIPPING
+	if (CVarRTS_Work_VerifyWorkerRegistry.GetValueOnGameThread() <= 0)
+	{
+		return;
+	}
+
+	// The scans AddMaxWorkersForResourceType and SetAllCurrentWorkers used before the registry
 	TArray<AActor*> TempActors;
 	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AWorkingUnitBase::StaticClass(), TempActors);
-	
-	TMap<EResourceType, int32> WorkerCountPerType;
-	
+
+	int32 TeamWorkerCount = 0;
+	int32 AssignedWorkers[static_cast<int32>(EResourceType::MAX)] = {};
 	for (AActor* MyActor : TempActors)
 	{
 		AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(MyActor);
-		if (Worker && Worker->ResourcePlace && Worker->TeamId == TeamId)
+		if (!Worker || Worker->TeamId != TeamId) continue;
+
+		if (Worker->IsWorker)
 		{
-			// Cast the Controller property to AWorkingUnitController
-			AWorkerUnitControllerBase* WorkerController = Cast<AWorkerUnitControllerBase>(Worker->GetController());
-			if (WorkerController)
+			TeamWorkerCount++;
+		}
+		if (Worker->ResourcePlace && Cast<AWorkerUnitControllerBase>(Worker->GetController()))
+		{
+			const EResourceType ResourceType = ConvertToResourceType(Worker->ResourcePlace->Type);
+			if (ResourceType < EResourceType::MAX)
 			{
-				EResourceType ResourceType = ConvertToResourceType(Worker->ResourcePlace->Type);
-				// SAVE WORKERCOUNT DEPENDING ON RESOURCETYPE
-				WorkerCountPerType.FindOrAdd(ResourceType)++;
+				AssignedWorkers[static_cast<int32>(ResourceType)]++;
 			}
 		}
 	}
-	// Setting current workers for each resource type
-	for (const auto& Pair : WorkerCountPerType)
+
+	if (TeamWorkerCount != GetTeamWorkerCount(TeamId))
 	{
-		SetCurrentWorkersForResourceType(TeamId, Pair.Key, Pair.Value);
+		UE_LOG(LogTemp, Warning, TEXT("Worker registry mismatch for team %d: %d workers registered, %d found"), TeamId, GetTeamWorkerCount(TeamId), TeamWorkerCount);
+	}
+	for (int32 TypeIndex = 0; TypeIndex < static_cast<int32>(EResourceType::MAX); ++TypeIndex)
+	{
+		const int32 Registered = GetAssignedWorkerCount(TeamId, static_cast<EResourceType>(TypeIndex));
+		if (AssignedWorkers[TypeIndex] != Registered)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Worker registry mismatch for team %d, resource type %d: %d assigned registered, %d found"), TeamId, TypeIndex, Registered, AssignedWorkers[TypeIndex]);
+		}
 	}
+#endif
 }
 
 void AResourceGameMode::AddCurrentWorkersForResourceType(int TeamId, EResourceType ResourceType, float Amount)
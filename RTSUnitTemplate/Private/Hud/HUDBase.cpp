@@ -14,6 +14,10 @@
 #include "Kismet/GameplayStatics.h"
 #include "GeometryCollection/GeometryCollectionSimulationTypes.h"
 #include "Net/UnrealNetwork.h"
+#include "EngineUtils.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "SceneView.h"
 
 // Project-Specific Headers
 #include "Characters/Unit/HealingUnit.h"
@@ -24,6 +28,68 @@
 #include "Characters/Unit/BuildingBase.h"
 #include "Actors/Waypoint.h"
 
+DECLARE_STATS_GROUP(TEXT("RTS Selection"), STATGROUP_RTSSelection, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Update Selection Drag"), STAT_RTSSelection_UpdateDrag, STATGROUP_RTSSelection);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projected Points"), STAT_RTSSelection_ProjectedPoints, STATGROUP_RTSSelection);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tested Points"), STAT_RTSSelection_TestedPoints, STATGROUP_RTSSelection);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Selection Changes"), STAT_RTSSelection_Changes, STATGROUP_RTSSelection);
+
+static TAutoConsoleVariable<int32> CVarRTS_Selection_Binned(
+	TEXT("net.RTS.Selection.Binned"),
+	1,
+	TEXT("1 = box selection projects the local team's units once per frame into screen bins and commits on release, 0 = per frame actor scans and squad requests."),
+	ECVF_Default);
+
+namespace
+{
+	/** View projection of the owning player for one frame, relative to the view origin to keep float precision. */
+	struct FSelectionProjection
+	{
+		FMatrix44f TranslatedViewProjection = FMatrix44f::Identity;
+		FVector ViewOrigin = FVector::ZeroVector;
+		FIntRect ViewRect;
+
+		bool Initialize(const APlayerController* PlayerController)
+		{
+			const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+			if (!LocalPlayer || !LocalPlayer->ViewportClient)
+			{
+				return false;
+			}
+
+			FSceneViewProjectionData ProjectionData;
+			if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+			{
+				return false;
+			}
+
+			TranslatedViewProjection = FMatrix44f(ProjectionData.ViewRotationMatrix * ProjectionData.ProjectionMatrix);
+			ViewOrigin = ProjectionData.ViewOrigin;
+			ViewRect = ProjectionData.GetConstrainedViewRect();
+			return ViewRect.Width() > 0 && ViewRect.Height() > 0;
+		}
+
+		// Same screen position as APlayerController::ProjectWorldLocationToScreen; false behind the camera
+		bool Project(const FVector& WorldPosition, FVector2f& OutScreenPosition) const
+		{
+			const FVector3f Relative(WorldPosition - ViewOrigin);
+			const VectorRegister4Float Clip = VectorTransformVector(VectorLoadFloat3_W1(&Relative), &TranslatedViewProjection);
+
+			float ClipValues[4];
+			VectorStore(Clip, ClipValues);
+			if (ClipValues[3] <= 0.f)
+			{
+				return false;
+			}
+
+			const float RHW = 1.f / ClipValues[3];
+			OutScreenPosition.X = ViewRect.Min.X + (ClipValues[0] * RHW * 0.5f + 0.5f) * ViewRect.Width();
+			OutScreenPosition.Y = ViewRect.Min.Y + (0.5f - ClipValues[1] * RHW * 0.5f) * ViewRect.Height();
+			return true;
+		}
+	};
+}
+
 
 void AHUDBase::DrawDashedLine3D(const FVector& InStart, const FVector& InEnd, float DashLen, float GapLen, FColor Color, float Thickness, float ZOffset)
 {
@@ -187,16 +253,30 @@ void AHUDBase::DrawHUD()
 	// Draw dashed links between selected buildings and their waypoints each frame
 	DrawSelectedBuildingWaypointLinks();
 
+	const bool bBinnedSelection = CVarRTS_Selection_Binned.GetValueOnGameThread() > 0;
+
 	if (bSelectFriendly) {
-		if(!bAddToSelection)
+		if (bBinnedSelection)
+		{
+			// Selection is updated incrementally while dragging and committed on release
+			if (!bSelectionDragActive)
+			{
+				BeginSelectionDrag();
+			}
+		}
+		else if(!bAddToSelection)
 		{
 	       DeselectAllUnits();
 	       SelectedUnits.Empty();
        }
        
        CurrentPoint = GetMousePos2D();
+
+       FVector2D InitialSelectionPoint = FVector2D::ZeroVector;
+       FVector2D CurrentSelectionPoint = FVector2D::ZeroVector;
+       const bool bSelectionDragged = abs(InitialPoint.X - CurrentPoint.X) >= 2;
        
-       if (abs(InitialPoint.X - CurrentPoint.X) >= 2) {
+       if (bSelectionDragged) {
 
           // This is the visual rectangle the player sees.
           DrawRect(FLinearColor(0, 0, 1, .15f),
@@ -210,8 +290,6 @@ void AHUDBase::DrawHUD()
           const float LengthLineB = abs(InitialPoint.X - CurrentPoint.X);
       		  FVector2D LineCenterPointA;
       		  FVector2D LineCenterPointB;
-      		  FVector2D InitialSelectionPoint = FVector2D::ZeroVector;
-      		  FVector2D CurrentSelectionPoint = FVector2D::ZeroVector;
 
           if (InitialPoint.Y < CurrentPoint.Y && InitialPoint.X < CurrentPoint.X) {
              LineCenterPointA.X = InitialPoint.X;
@@ -261,54 +339,67 @@ void AHUDBase::DrawHUD()
              CurrentSelectionPoint.X - InitialSelectionPoint.X,
              CurrentSelectionPoint.Y - InitialSelectionPoint.Y);
 
-          TArray <AUnitBase*> NewUnitBases;
-          GetActorsInSelectionRectangle<AUnitBase>(InitialSelectionPoint, CurrentSelectionPoint, NewUnitBases, false, false);
-          
           ACameraControllerBase* Controller = Cast<ACameraControllerBase>(GetOwningPlayerController());
+
+          if (!bBinnedSelection) {
+             TArray <AUnitBase*> NewUnitBases;
+             GetActorsInSelectionRectangle<AUnitBase>(InitialSelectionPoint, CurrentSelectionPoint, NewUnitBases, false, false);
           
-          // --- START OF MODIFICATION ---
+             // --- START OF MODIFICATION ---
 
-          // To handle dragging the rectangle in any direction, we must find the min and max coordinates.
-          const FVector2D SelectionRectMin(FMath::Min(InitialSelectionPoint.X, CurrentSelectionPoint.X), FMath::Min(InitialSelectionPoint.Y, CurrentSelectionPoint.Y));
-          const FVector2D SelectionRectMax(FMath::Max(InitialSelectionPoint.X, CurrentSelectionPoint.X), FMath::Max(InitialSelectionPoint.Y, CurrentSelectionPoint.Y));
+             // To handle dragging the rectangle in any direction, we must find the min and max coordinates.
+             const FVector2D SelectionRectMin(FMath::Min(InitialSelectionPoint.X, CurrentSelectionPoint.X), FMath::Min(InitialSelectionPoint.Y, CurrentSelectionPoint.Y));
+             const FVector2D SelectionRectMax(FMath::Max(InitialSelectionPoint.X, CurrentSelectionPoint.X), FMath::Max(InitialSelectionPoint.Y, CurrentSelectionPoint.Y));
 
-          for (int32 i = 0; i < NewUnitBases.Num(); i++) {
+             for (int32 i = 0; i < NewUnitBases.Num(); i++) {
 
-             AUnitBase* Unit = NewUnitBases[i];
-             const ASpeakingUnit* SUnit = Cast<ASpeakingUnit>(Unit);
+                AUnitBase* Unit = NewUnitBases[i];
+                const ASpeakingUnit* SUnit = Cast<ASpeakingUnit>(Unit);
              
-             // Filter for units that are selectable and use skeletal movement
-             if(Controller && Unit && Unit->CanBeSelected && Unit->bUseSkeletalMovement && (Unit->TeamId == Controller->SelectableTeamId || Controller->SelectableTeamId == 0) && !SUnit)
-             {
-                // Get the unit's center location in the world
-                const FVector UnitWorldLocation = Unit->GetActorLocation();
-
-                // Project the world location to screen space
-                FVector2D ScreenLocation;
-                if (Controller->ProjectWorldLocationToScreen(UnitWorldLocation, ScreenLocation))
+                // Filter for units that are selectable and use skeletal movement
+                if(Controller && Unit && Unit->CanBeSelected && Unit->bUseSkeletalMovement && (Unit->TeamId == Controller->SelectableTeamId || Controller->SelectableTeamId == 0) && !SUnit)
                 {
-                    // Now, check if the projected center point is within our selection rectangle
-                    if (ScreenLocation.X >= SelectionRectMin.X && ScreenLocation.X <= SelectionRectMax.X &&
-                        ScreenLocation.Y >= SelectionRectMin.Y && ScreenLocation.Y <= SelectionRectMax.Y)
-                    {
-                        // The center is inside the rectangle, so we can select it.
-                        if (Unit->GetOwner() == nullptr) Unit->SetOwner(Controller);
-                        Unit->SetSelected();
-                        SelectedUnits.Emplace(Unit);
-                        SelectUnitsFromSameSquad(Unit);
-                    }
+                   // Get the unit's center location in the world
+                   const FVector UnitWorldLocation = Unit->GetActorLocation();
+
+                   // Project the world location to screen space
+                   FVector2D ScreenLocation;
+                   if (Controller->ProjectWorldLocationToScreen(UnitWorldLocation, ScreenLocation))
+                   {
+                       // Now, check if the projected center point is within our selection rectangle
+                       if (ScreenLocation.X >= SelectionRectMin.X && ScreenLocation.X <= SelectionRectMax.X &&
+                           ScreenLocation.Y >= SelectionRectMin.Y && ScreenLocation.Y <= SelectionRectMax.Y)
+                       {
+                           // The center is inside the rectangle, so we can select it.
+                           if (Unit->GetOwner() == nullptr) Unit->SetOwner(Controller);
+                           Unit->SetSelected();
+                           SelectedUnits.Emplace(Unit);
+                           SelectUnitsFromSameSquad(Unit);
+                       }
+                   }
                 }
              }
-          }
 
-          // --- END OF MODIFICATION ---
+             // --- END OF MODIFICATION ---
           
-          NewUnitBases.Empty();
+             NewUnitBases.Empty();
+          }
           
           if(Controller) Controller->AbilityArrayIndex = 0;
        }
-       // This call handles the non-skeletal (ISM) units correctly already.
-       SelectISMUnitsInRectangle(InitialPoint, CurrentPoint);
+       if (bBinnedSelection)
+       {
+          UpdateSelectionDrag(bSelectionDragged, InitialSelectionPoint, CurrentSelectionPoint, InitialPoint, CurrentPoint);
+       }
+       else
+       {
+          // This call handles the non-skeletal (ISM) units correctly already.
+          SelectISMUnitsInRectangle(InitialPoint, CurrentPoint);
+       }
+    }
+    else if (bSelectionDragActive)
+    {
+       EndSelectionDrag();
     }
 }
 
@@ -368,6 +459,281 @@ void AHUDBase::SelectISMUnitsInRectangle(const FVector2D& RectMin, const FVector
     }
 }
 
+void AHUDBase::BeginSelectionDrag()
+{
+	bSelectionDragActive = true;
+	SelectionCandidates.Reset();
+	SelectionBaseUnits.Reset();
+
+	if (!bAddToSelection)
+	{
+		DeselectAllUnits();
+		SelectedUnits.Empty();
+	}
+
+	TSet<AUnitBase*> BaseSelection;
+	for (AUnitBase* Unit : SelectedUnits)
+	{
+		if (Unit)
+		{
+			SelectionBaseUnits.Add(Unit);
+			BaseSelection.Add(Unit);
+		}
+	}
+
+	ACameraControllerBase* Controller = Cast<ACameraControllerBase>(GetOwningPlayerController());
+	if (!Controller)
+	{
+		return;
+	}
+
+	// Same team filters as the per frame scans: skeletal units also for spectators (team 0), ISM units only for the own team
+	const int32 SelectableTeamId = Controller->SelectableTeamId;
+	for (TActorIterator<AUnitBase> It(GetWorld()); It; ++It)
+	{
+		AUnitBase* Unit = *It;
+		const bool bSkeletal = Unit->bUseSkeletalMovement;
+		if (bSkeletal)
+		{
+			if ((Unit->TeamId != SelectableTeamId && SelectableTeamId != 0) || Cast<ASpeakingUnit>(Unit))
+			{
+				continue;
+			}
+		}
+		else if (Unit->TeamId != SelectableTeamId || !Unit->ISMComponent)
+		{
+			continue;
+		}
+
+		FSelectionCandidate& Candidate = SelectionCandidates.AddDefaulted_GetRef();
+		Candidate.Unit = Unit;
+		Candidate.bSkeletal = bSkeletal;
+		Candidate.bInBaseSelection = BaseSelection.Contains(Unit);
+	}
+}
+
+void AHUDBase::UpdateSelectionDrag(bool bTestSkeletal, const FVector2D& SkeletalCornerA, const FVector2D& SkeletalCornerB, const FVector2D& ISMCornerA, const FVector2D& ISMCornerB)
+{
+	SCOPE_CYCLE_COUNTER(STAT_RTSSelection_UpdateDrag);
+
+	APlayerController* PC = GetOwningPlayerController();
+	ACameraControllerBase* Controller = Cast<ACameraControllerBase>(PC);
+	FSelectionProjection Projection;
+	if (!Controller || !Projection.Initialize(PC))
+	{
+		return;
+	}
+
+	// One projection pass: the actor location of skeletal units, every instance of ISM units
+	SelectionPoints.Reset();
+	SelectionPointCandidates.Reset();
+	for (int32 CandidateIndex = 0; CandidateIndex < SelectionCandidates.Num(); ++CandidateIndex)
+	{
+		const FSelectionCandidate& Candidate = SelectionCandidates[CandidateIndex];
+		const AUnitBase* Unit = Candidate.Unit.Get();
+		if (!Unit || !Unit->CanBeSelected)
+		{
+			continue;
+		}
+
+		FVector2f ScreenPosition;
+		if (Candidate.bSkeletal)
+		{
+			if (bTestSkeletal && Projection.Project(Unit->GetActorLocation(), ScreenPosition))
+			{
+				SelectionPoints.Add(ScreenPosition);
+				SelectionPointCandidates.Add(CandidateIndex);
+			}
+			continue;
+		}
+
+		const UInstancedStaticMeshComponent* ISM = Unit->ISMComponent;
+		const int32 InstanceCount = ISM ? ISM->GetInstanceCount() : 0;
+		for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+		{
+			FTransform InstanceTransform;
+			ISM->GetInstanceTransform(InstanceIndex, InstanceTransform, /*bWorldSpace=*/true);
+			if (Projection.Project(InstanceTransform.GetLocation(), ScreenPosition))
+			{
+				SelectionPoints.Add(ScreenPosition);
+				SelectionPointCandidates.Add(CandidateIndex);
+			}
+		}
+	}
+	INC_DWORD_STAT_BY(STAT_RTSSelection_ProjectedPoints, SelectionPoints.Num());
+
+	// Counting sort of the points into screen cells; points off screen go to the border cells
+	const float BinSize = FMath::Max(SelectionBinSize, 8.f);
+	const FIntPoint BinOrigin = Projection.ViewRect.Min;
+	const int32 NumBinsX = FMath::Max(1, FMath::CeilToInt(Projection.ViewRect.Width() / BinSize));
+	const int32 NumBinsY = FMath::Max(1, FMath::CeilToInt(Projection.ViewRect.Height() / BinSize));
+	auto GetBinCoord = [BinSize](float Position, int32 Origin, int32 NumBins)
+	{
+		return FMath::Clamp(FMath::FloorToInt((Position - Origin) / BinSize), 0, NumBins - 1);
+	};
+
+	SelectionBinStarts.Reset();
+	SelectionBinStarts.SetNumZeroed(NumBinsX * NumBinsY + 1);
+	SelectionPointBins.SetNumUninitialized(SelectionPoints.Num());
+	for (int32 PointIndex = 0; PointIndex < SelectionPoints.Num(); ++PointIndex)
+	{
+		const FVector2f& Point = SelectionPoints[PointIndex];
+		const int32 Bin = GetBinCoord(Point.Y, BinOrigin.Y, NumBinsY) * NumBinsX + GetBinCoord(Point.X, BinOrigin.X, NumBinsX);
+		SelectionPointBins[PointIndex] = Bin;
+		++SelectionBinStarts[Bin + 1];
+	}
+	for (int32 Bin = 1; Bin < SelectionBinStarts.Num(); ++Bin)
+	{
+		SelectionBinStarts[Bin] += SelectionBinStarts[Bin - 1];
+	}
+
+	// Scatter with BinStarts[Bin] as write cursor, which leaves it at the start of the next cell; shift back afterwards
+	SelectionBinnedPoints.SetNumUninitialized(SelectionPoints.Num());
+	SelectionBinnedCandidates.SetNumUninitialized(SelectionPoints.Num());
+	for (int32 PointIndex = 0; PointIndex < SelectionPoints.Num(); ++PointIndex)
+	{
+		const int32 Target = SelectionBinStarts[SelectionPointBins[PointIndex]]++;
+		SelectionBinnedPoints[Target] = SelectionPoints[PointIndex];
+		SelectionBinnedCandidates[Target] = SelectionPointCandidates[PointIndex];
+	}
+	for (int32 Bin = SelectionBinStarts.Num() - 1; Bin > 0; --Bin)
+	{
+		SelectionBinStarts[Bin] = SelectionBinStarts[Bin - 1];
+	}
+	SelectionBinStarts[0] = 0;
+
+	// Rectangle queries only read the overlapped cells
+	SelectionInRectangle.Reset();
+	SelectionInRectangle.SetNumZeroed(SelectionCandidates.Num());
+	auto QueryRectangle = [&](const FVector2D& CornerA, const FVector2D& CornerB, bool bSkeletal)
+	{
+		const FVector2f RectMin(FMath::Min(CornerA.X, CornerB.X), FMath::Min(CornerA.Y, CornerB.Y));
+		const FVector2f RectMax(FMath::Max(CornerA.X, CornerB.X), FMath::Max(CornerA.Y, CornerB.Y));
+		const int32 MinBinY = GetBinCoord(RectMin.Y, BinOrigin.Y, NumBinsY);
+		const int32 MaxBinY = GetBinCoord(RectMax.Y, BinOrigin.Y, NumBinsY);
+		const int32 MinBinX = GetBinCoord(RectMin.X, BinOrigin.X, NumBinsX);
+		const int32 MaxBinX = GetBinCoord(RectMax.X, BinOrigin.X, NumBinsX);
+
+		int32 TestedPoints = 0;
+		for (int32 BinY = MinBinY; BinY <= MaxBinY; ++BinY)
+		{
+			// Cells of one row are contiguous
+			const int32 First = SelectionBinStarts[BinY * NumBinsX + MinBinX];
+			const int32 Last = SelectionBinStarts[BinY * NumBinsX + MaxBinX + 1];
+			TestedPoints += Last - First;
+			for (int32 PointIndex = First; PointIndex < Last; ++PointIndex)
+			{
+				const int32 CandidateIndex = SelectionBinnedCandidates[PointIndex];
+				if (SelectionInRectangle[CandidateIndex] || SelectionCandidates[CandidateIndex].bSkeletal != bSkeletal)
+				{
+					continue;
+				}
+
+				const FVector2f& Point = SelectionBinnedPoints[PointIndex];
+				if (Point.X >= RectMin.X && Point.X <= RectMax.X && Point.Y >= RectMin.Y && Point.Y <= RectMax.Y)
+				{
+					SelectionInRectangle[CandidateIndex] = true;
+				}
+			}
+		}
+		INC_DWORD_STAT_BY(STAT_RTSSelection_TestedPoints, TestedPoints);
+	};
+
+	if (bTestSkeletal)
+	{
+		QueryRectangle(SkeletalCornerA, SkeletalCornerB, true);
+	}
+	QueryRectangle(ISMCornerA, ISMCornerB, false);
+
+	// Only units entering or leaving the rectangle are touched
+	bool bSelectionChanged = false;
+	for (int32 CandidateIndex = 0; CandidateIndex < SelectionCandidates.Num(); ++CandidateIndex)
+	{
+		FSelectionCandidate& Candidate = SelectionCandidates[CandidateIndex];
+		const bool bInRectangle = SelectionInRectangle[CandidateIndex];
+		if (bInRectangle == Candidate.bInRectangle)
+		{
+			continue;
+		}
+
+		Candidate.bInRectangle = bInRectangle;
+		bSelectionChanged = true;
+		INC_DWORD_STAT(STAT_RTSSelection_Changes);
+
+		AUnitBase* Unit = Candidate.Unit.Get();
+		if (!Unit || Candidate.bInBaseSelection)
+		{
+			continue;
+		}
+
+		if (bInRectangle)
+		{
+			if (Unit->GetOwner() == nullptr)
+			{
+				Unit->SetOwner(Controller);
+			}
+			Unit->SetSelected();
+		}
+		else
+		{
+			Unit->SetDeselected();
+		}
+	}
+
+	if (bSelectionChanged)
+	{
+		SelectedUnits.Reset();
+		for (const TWeakObjectPtr<AUnitBase>& BaseUnit : SelectionBaseUnits)
+		{
+			if (AUnitBase* Unit = BaseUnit.Get())
+			{
+				SelectedUnits.Add(Unit);
+			}
+		}
+		for (const FSelectionCandidate& Candidate : SelectionCandidates)
+		{
+			AUnitBase* Unit = Candidate.Unit.Get();
+			if (Unit && Candidate.bInRectangle && !Candidate.bInBaseSelection)
+			{
+				SelectedUnits.Add(Unit);
+			}
+		}
+	}
+}
+
+void AHUDBase::EndSelectionDrag()
+{
+	if (!bSelectionDragActive)
+	{
+		return;
+	}
+	bSelectionDragActive = false;
+
+	// One squad request per squad the rectangle touched instead of one per unit and frame
+	if (bSelectFullSquad)
+	{
+		TSet<int32> RequestedSquads;
+		for (const FSelectionCandidate& Candidate : SelectionCandidates)
+		{
+			AUnitBase* Unit = Candidate.Unit.Get();
+			if (!Unit || !Candidate.bInRectangle || Unit->SquadId == 0)
+			{
+				continue;
+			}
+
+			bool bAlreadyRequested = false;
+			RequestedSquads.Add(Unit->SquadId, &bAlreadyRequested);
+			if (!bAlreadyRequested)
+			{
+				SelectUnitsFromSameSquad(Unit);
+			}
+		}
+	}
+
+	SelectionCandidates.Reset();
+	SelectionBaseUnits.Reset();
+}
+
 void AHUDBase::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
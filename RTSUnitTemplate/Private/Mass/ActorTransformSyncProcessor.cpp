@@ -108,6 +108,60 @@ void UActorTransformSyncProcessor::ConfigureQueries(const TSharedRef<FMassEntity
 		ClientEntityQuery.AddRequirement<FMassRepresentationLODFragment>(EMassFragmentAccess::ReadOnly);
 	*/
 		ClientEntityQuery.RegisterWithProcessor(*this);
+
+		TargetSnapshotQuery.Initialize(EntityManager);
+		TargetSnapshotQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+		TargetSnapshotQuery.AddTagRequirement<FUnitMassTag>(EMassFragmentPresence::All);
+		TargetSnapshotQuery.RegisterWithProcessor(*this);
+}
+
+/**
+ * @brief Stores a pointer to every unit's transform fragment at its entity index.
+ * Chunks do not move while the processor executes, so the pointers see the same live data
+ * as EntityManager.GetFragmentDataPtr, without the archetype lookup per target.
+ */
+void UActorTransformSyncProcessor::BuildTargetTransformSnapshot(FMassExecutionContext& Context)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_ActorTransformSync_BuildTargetSnapshot);
+
+    TargetTransformSnapshot.Reset();
+
+    TargetSnapshotQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& ChunkContext)
+    {
+        const int32 NumEntities = ChunkContext.GetNumEntities();
+        const TConstArrayView<FTransformFragment> TransformList = ChunkContext.GetFragmentView<FTransformFragment>();
+
+        for (int32 i = 0; i < NumEntities; ++i)
+        {
+            const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
+            if (Entity.Index >= TargetTransformSnapshot.Num())
+            {
+                TargetTransformSnapshot.SetNum(Entity.Index + 1, EAllowShrinking::No);
+            }
+            FUnitTransformSnapshotEntry& Entry = TargetTransformSnapshot[Entity.Index];
+            Entry.Entity = Entity;
+            Entry.Transform = &TransformList[i];
+        }
+    });
+}
+
+const FTransformFragment* UActorTransformSyncProcessor::FindTargetTransform(FMassEntityManager& EntityManager, const FMassEntityHandle& TargetEntity) const
+{
+    if (TargetTransformSnapshot.IsValidIndex(TargetEntity.Index))
+    {
+        const FUnitTransformSnapshotEntry& Entry = TargetTransformSnapshot[TargetEntity.Index];
+        if (Entry.Transform && Entry.Entity == TargetEntity)
+        {
+            return Entry.Transform;
+        }
+    }
+
+    // Targets without FUnitMassTag are not in the snapshot
+    if (EntityManager.IsEntityValid(TargetEntity))
+    {
+        return EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetEntity);
+    }
+    return nullptr;
 }
 
 
@@ -406,13 +460,9 @@ void UActorTransformSyncProcessor::RotateTowardsTarget(AUnitBase* UnitBase, FMas
     }
     
     FVector TargetLocation = TargetFrag.LastKnownLocation;
-    const FMassEntityHandle TargetEntity = TargetFrag.TargetEntity;
-    if (EntityManager.IsEntityValid(TargetEntity))
+    if (const FTransformFragment* TargetXform = FindTargetTransform(EntityManager, TargetFrag.TargetEntity))
     {
-        if (const FTransformFragment* TargetXform = EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetEntity))
-        {
-            TargetLocation = TargetXform->GetTransform().GetLocation();
-        }
+        TargetLocation = TargetXform->GetTransform().GetLocation();
     }
    
     FVector Dir = TargetLocation - CurrentActorLocation;
@@ -573,6 +623,8 @@ void UActorTransformSyncProcessor::ExecuteClient(FMassEntityManager& EntityManag
     const float ActualDeltaTime = Context.GetDeltaTimeSeconds();
     if (!ShouldProceedWithTick(ActualDeltaTime)) return;
 
+    BuildTargetTransformSnapshot(Context);
+
     TArray<FActorTransformUpdatePayload> PendingActorUpdates;
     PendingActorUpdates.Reserve(ClientEntityQuery.GetNumMatchingEntities());
 
@@ -746,6 +798,8 @@ void UActorTransformSyncProcessor::ExecuteServer(FMassEntityManager& EntityManag
     
     if (!ShouldProceedWithTick(ActualDeltaTime)) return;
     
+    BuildTargetTransformSnapshot(Context);
+
     TArray<FActorTransformUpdatePayload> PendingActorUpdates;
     PendingActorUpdates.Reserve(EntityQuery.GetNumMatchingEntities());
     
@@ -240,7 +240,7 @@ FMassEntityHandle UMassActorBindingComponent::CreateAndLinkOwnerToMassEntity()
 		
 		FMassArchetypeHandle Archetype;
 		FMassArchetypeSharedFragmentValues SharedValues;
-		if (!BuildArchetypeAndSharedValues(Archetype, SharedValues))
+		if (!GetOrBuildArchetypeAndSharedValues(Archetype, SharedValues))
 		{
 			return {};
 		}
@@ -248,94 +248,170 @@ FMassEntityHandle UMassActorBindingComponent::CreateAndLinkOwnerToMassEntity()
 		NewMassEntityHandle = EM.CreateEntity(Archetype, SharedValues);
 		if (NewMassEntityHandle.IsValid())
 		{
-			// Perform synchronous initializations
-			MassEntityHandle = NewMassEntityHandle;
-			ApplyInitialStartupFreeze(MyOwner, EM, NewMassEntityHandle);
-			InitTransform(EM, NewMassEntityHandle);
-			InitMovementFragments(EM, NewMassEntityHandle);
-			InitAIFragments(EM, NewMassEntityHandle);
-			InitRepresentation(EM, NewMassEntityHandle);
+			LinkOwnerToNewMassEntity(EM, NewMassEntityHandle);
+		}
+    }
+	
+	return NewMassEntityHandle;
+}
 
-			if (StopSeparation)
-			{
-				EM.Defer().AddTag<FMassStateStopSeparationTag>(NewMassEntityHandle);
-			}
-			
-			bNeedsMassUnitSetup = false;
-			AUnitBase* UnitBase = Cast<AUnitBase>(MyOwner);
-			UnitBase->bIsMassUnit = true;
-			UnitBase->CheckTeamVisibility();
-			UnitBase->UpdatePredictionFragment(UnitBase->GetMassActorLocation(), 0);
-			UnitBase->SyncTranslation();
-			
-			// Client: Clear stale cache for any NetID this actor might have had previously 
-			// or might be about to receive. Better yet, the ClientReplicationProcessor 
-			// handles the actual NetID assignment from registry.
-			
-			// Server: assign NetID and update authoritative registry so clients can reconcile
-			if (UWorld* WorldPtr = GetWorld())
+
+void UMassActorBindingComponent::LinkOwnerToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle)
+{
+	// Perform synchronous initializations
+	BeginLinkOwnerToNewMassEntity(EM, NewMassEntityHandle);
+	InitTransform(EM, NewMassEntityHandle);
+	InitMovementFragments(EM, NewMassEntityHandle);
+	InitAIFragments(EM, NewMassEntityHandle);
+	InitRepresentation(EM, NewMassEntityHandle);
+	FinishLinkOwnerToNewMassEntity(EM, NewMassEntityHandle);
+}
+
+void UMassActorBindingComponent::BeginLinkOwnerToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle)
+{
+	MassEntityHandle = NewMassEntityHandle;
+	// May move the entity to the frozen archetype, so it runs before any fragment pointer is resolved
+	ApplyInitialStartupFreeze(MyOwner, EM, NewMassEntityHandle);
+}
+
+void UMassActorBindingComponent::FinishLinkOwnerToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle)
+{
+	if (StopSeparation)
+	{
+		EM.Defer().AddTag<FMassStateStopSeparationTag>(NewMassEntityHandle);
+	}
+	
+	bNeedsMassUnitSetup = false;
+	AUnitBase* UnitBase = Cast<AUnitBase>(MyOwner);
+	UnitBase->bIsMassUnit = true;
+	UnitBase->CheckTeamVisibility();
+	UnitBase->UpdatePredictionFragment(UnitBase->GetMassActorLocation(), 0);
+	UnitBase->SyncTranslation();
+	
+	// Client: Clear stale cache for any NetID this actor might have had previously 
+	// or might be about to receive. Better yet, the ClientReplicationProcessor 
+	// handles the actual NetID assignment from registry.
+	
+	// Server: assign NetID and update authoritative registry so clients can reconcile
+	if (UWorld* WorldPtr = GetWorld())
+	{
+		if (WorldPtr->GetNetMode() != NM_Client)
+		{
+			if (FMassNetworkIDFragment* NetFrag = EM.GetFragmentDataPtr<FMassNetworkIDFragment>(NewMassEntityHandle))
 			{
-				if (WorldPtr->GetNetMode() != NM_Client)
-				{
-					if (FMassNetworkIDFragment* NetFrag = EM.GetFragmentDataPtr<FMassNetworkIDFragment>(NewMassEntityHandle))
+					// Skip registration if the owning unit is dead
+					AUnitBase* UnitBaseLocal2 = Cast<AUnitBase>(MyOwner);
+					if (UnitBaseLocal2 && UnitBaseLocal2->UnitState == UnitData::Dead)
 					{
-							// Skip registration if the owning unit is dead
-							AUnitBase* UnitBaseLocal2 = Cast<AUnitBase>(MyOwner);
-							if (UnitBaseLocal2 && UnitBaseLocal2->UnitState == UnitData::Dead)
-							{
-								// Do not assign NetID or add to registry for dead units
-							}
-							else if (AUnitRegistryReplicator* Reg = AUnitRegistryReplicator::GetOrSpawn(*WorldPtr))
-							{
-								// Ensure the unit has a valid unique UnitIndex before entering the registry.
-								int32 UnitIndex = UnitBaseLocal2 ? UnitBaseLocal2->UnitIndex : INDEX_NONE;
-								if (UnitBaseLocal2 && UnitIndex <= 0)
-								{
-									if (ARTSGameModeBase* GM = WorldPtr->GetAuthGameMode<ARTSGameModeBase>())
-									{
-										GM->AddUnitIndexAndAssignToAllUnitsArrayWithIndex(UnitBaseLocal2, INDEX_NONE, FUnitSpawnParameter());
-										UnitIndex = UnitBaseLocal2->UnitIndex;
-									}
-								}
-								if (UnitIndex <= 0)
-								{
-									// Cannot safely register without a stable UnitIndex.
-									// (Should not happen in normal flow; runtime-spawn paths must assign UnitIndex.)
-									return NewMassEntityHandle;
-								}
-
-								const uint32 NewID = Reg->GetNextNetID();
-								NetFrag->NetID = FMassNetworkID(NewID);
-								const FName OwnerName = MyOwner ? MyOwner->GetFName() : NAME_None;
-								FUnitRegistryItem* Existing = Reg->Registry.FindByUnitIndex(UnitIndex);
-							
-								if (Existing)
-								{
-									Existing->OwnerName = OwnerName;
-									Existing->UnitIndex = UnitIndex;
-								Existing->NetID = NetFrag->NetID;
-								Reg->Registry.MarkItemDirty(*Existing);
-							}
-							else
+						// Do not assign NetID or add to registry for dead units
+					}
+					else if (AUnitRegistryReplicator* Reg = AUnitRegistryReplicator::GetOrSpawn(*WorldPtr))
+					{
+						// Ensure the unit has a valid unique UnitIndex before entering the registry.
+						int32 UnitIndex = UnitBaseLocal2 ? UnitBaseLocal2->UnitIndex : INDEX_NONE;
+						if (UnitBaseLocal2 && UnitIndex <= 0)
+						{
+							if (ARTSGameModeBase* GM = WorldPtr->GetAuthGameMode<ARTSGameModeBase>())
 							{
-								const int32 NewIdx2 = Reg->Registry.Items.AddDefaulted();
-								Reg->Registry.Items[NewIdx2].OwnerName = OwnerName;
-								Reg->Registry.Items[NewIdx2].UnitIndex = UnitIndex;
-								Reg->Registry.Items[NewIdx2].NetID = NetFrag->NetID;
-								Reg->Registry.MarkItemDirty(Reg->Registry.Items[NewIdx2]);
-							}
-								Reg->Registry.MarkArrayDirty();
-								Reg->ForceNetUpdate();
+								GM->AddUnitIndexAndAssignToAllUnitsArrayWithIndex(UnitBaseLocal2, INDEX_NONE, FUnitSpawnParameter());
+								UnitIndex = UnitBaseLocal2->UnitIndex;
 							}
+						}
+						if (UnitIndex <= 0)
+						{
+							// Cannot safely register without a stable UnitIndex.
+							// (Should not happen in normal flow; runtime-spawn paths must assign UnitIndex.)
+							return;
+						}
+
+						const uint32 NewID = Reg->GetNextNetID();
+						NetFrag->NetID = FMassNetworkID(NewID);
+						const FName OwnerName = MyOwner ? MyOwner->GetFName() : NAME_None;
+						FUnitRegistryItem* Existing = Reg->Registry.FindByUnitIndex(UnitIndex);
+					
+						if (Existing)
+						{
+							Existing->OwnerName = OwnerName;
+							Existing->UnitIndex = UnitIndex;
+						Existing->NetID = NetFrag->NetID;
+						Reg->Registry.MarkItemDirty(*Existing);
+					}
+					else
+					{
+						const int32 NewIdx2 = Reg->Registry.Items.AddDefaulted();
+						Reg->Registry.Items[NewIdx2].OwnerName = OwnerName;
+						Reg->Registry.Items[NewIdx2].UnitIndex = UnitIndex;
+						Reg->Registry.Items[NewIdx2].NetID = NetFrag->NetID;
+						Reg->Registry.MarkItemDirty(Reg->Registry.Items[NewIdx2]);
+					}
+						Reg->RequestRegistryNetUpdate();
 					}
-				}
 			}
 		}
-    }
-	
-	return NewMassEntityHandle;
+	}
+}
+
+bool UMassActorBindingComponent::PrepareBatchedEntityCreation(FMassArchetypeHandle& OutArchetype,
+                                                              FMassArchetypeSharedFragmentValues& OutSharedValues)
+{
+	// Same preconditions as CreateAndLinkOwnerToMassEntity / CreateAndLinkBuildingToMassEntity
+	if (MassEntityHandle.IsValid() || (!bNeedsMassUnitSetup && !bNeedsMassBuildingSetup))
+	{
+		return false;
+	}
+
+	AUnitBase* UnitBaseLocal = Cast<AUnitBase>(GetOwner());
+	if (bNeedsMassUnitSetup && UnitBaseLocal && UnitBaseLocal->UnitState == UnitData::Dead)
+	{
+		return false;
+	}
+
+	MassEntitySubsystemCache = GetWorld() ? GetWorld()->GetSubsystem<UMassEntitySubsystem>() : nullptr;
+	if (!MassEntitySubsystemCache)
+	{
+		return false;
+	}
+
+	return GetOrBuildArchetypeAndSharedValues(OutArchetype, OutSharedValues);
 }
 
+bool UMassActorBindingComponent::GetOrBuildArchetypeAndSharedValues(FMassArchetypeHandle& OutArchetype,
+                                                                    FMassArchetypeSharedFragmentValues& OutSharedValues)
+{
+	AUnitBase* UnitBase = Cast<AUnitBase>(GetOwner());
+	URTSWorldCacheSubsystem* CacheSubsystem = GetWorld() ? GetWorld()->GetSubsystem<URTSWorldCacheSubsystem>() : nullptr;
+	if (!UnitBase || !UnitBase->Attributes || !CacheSubsystem)
+	{
+		return BuildArchetypeAndSharedValues(OutArchetype, OutSharedValues);
+	}
+
+	FMassUnitArchetypeKey Key;
+	Key.UnitClass = UnitBase->GetClass();
+	Key.bAddEffectTargetFragment = UnitBase->AddEffectTargetFragement;
+	Key.bAddGameplayEffectFragment = UnitBase->AddGameplayEffectFragement;
+	Key.bStopSeparation = StopSeparation;
+	Key.RunSpeed = UnitBase->Attributes->GetRunSpeed();
+	Key.MaxAcceleration = MaxAcceleration;
+	Key.AvoidanceDistance = AvoidanceDistance;
+	Key.ObstacleSeparationStiffness = ObstacleSeparationStiffness;
+
+	if (const FMassUnitArchetypeEntry* Cached = CacheSubsystem->FindUnitArchetype(Key))
+	{
+		if (Cached->Archetype.IsValid())
+		{
+			OutArchetype = Cached->Archetype;
+			OutSharedValues = Cached->SharedValues;
+			return true;
+		}
+	}
+
+	if (!BuildArchetypeAndSharedValues(OutArchetype, OutSharedValues))
+	{
+		return false;
+	}
+	CacheSubsystem->AddUnitArchetype(Key, OutArchetype, OutSharedValues);
+	return true;
+}
 
 bool UMassActorBindingComponent::BuildArchetypeAndSharedValues(FMassArchetypeHandle& OutArchetype,
                                                                FMassArchetypeSharedFragmentValues& OutSharedValues)
@@ -385,6 +461,7 @@ bool UMassActorBindingComponent::BuildArchetypeAndSharedValues(FMassArchetypeHan
 		FUnitMassTag::StaticStruct(),                   // Your custom tag
 		FMassPatrolFragment::StaticStruct(), 
 		FUnitNavigationPathFragment::StaticStruct(),    // ** REQUIRED: Used by your UnitMovementProcessor for path state **
+		FUnitNavPolyFragment::StaticStruct(),
     	
 		FMassAIStateFragment::StaticStruct(),
     	FMassSightFragment::StaticStruct(),
@@ -392,6 +469,7 @@ bool UMassActorBindingComponent::BuildArchetypeAndSharedValues(FMassArchetypeHan
 		FMassCombatStatsFragment::StaticStruct(), 
 		FMassAgentCharacteristicsFragment::StaticStruct(),
     	FMassChargeTimerFragment::StaticStruct(),
+		FMassUnitVisibilityFragment::StaticStruct(),
 
 		FMassWorkerStatsFragment::StaticStruct(),
 		// Actor Representation & Sync
@@ -570,22 +648,53 @@ bool UMassActorBindingComponent::BuildArchetypeAndSharedValues(FMassArchetypeHan
 }
 
 
+FMassNewEntityFragments FMassNewEntityFragments::FromEntity(const FMassEntityManager& EntityManager, FMassEntityHandle Handle)
+{
+	FMassNewEntityFragments Fragments;
+	Fragments.Transform = EntityManager.GetFragmentDataPtr<FTransformFragment>(Handle);
+	Fragments.Velocity = EntityManager.GetFragmentDataPtr<FMassVelocityFragment>(Handle);
+	Fragments.MoveTarget = EntityManager.GetFragmentDataPtr<FMassMoveTargetFragment>(Handle);
+	Fragments.CombatStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Handle);
+	Fragments.Characteristics = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(Handle);
+	Fragments.AIState = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Handle);
+	Fragments.Patrol = EntityManager.GetFragmentDataPtr<FMassPatrolFragment>(Handle);
+	Fragments.AgentRadius = EntityManager.GetFragmentDataPtr<FAgentRadiusFragment>(Handle);
+	Fragments.AvoidanceCollider = EntityManager.GetFragmentDataPtr<FMassAvoidanceColliderFragment>(Handle);
+	Fragments.AITarget = EntityManager.GetFragmentDataPtr<FMassAITargetFragment>(Handle);
+	Fragments.Actor = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Handle);
+	Fragments.RepresentationLOD = EntityManager.GetFragmentDataPtr<FMassRepresentationLODFragment>(Handle);
+	return Fragments;
+}
+
 void UMassActorBindingComponent::InitTransform(FMassEntityManager& EntityManager, const FMassEntityHandle& Handle)
 {
-    FTransformFragment& Frag = EntityManager.GetFragmentDataChecked<FTransformFragment>(Handle);
-    Frag.SetTransform(GetOwner()->GetActorTransform());
+	FMassNewEntityFragments Fragments;
+	Fragments.Transform = &EntityManager.GetFragmentDataChecked<FTransformFragment>(Handle);
+	InitTransform(Fragments);
+}
+
+void UMassActorBindingComponent::InitTransform(const FMassNewEntityFragments& Fragments)
+{
+    Fragments.Transform->SetTransform(GetOwner()->GetActorTransform());
 }
 
 void UMassActorBindingComponent::InitMovementFragments(FMassEntityManager& EntityManager, const FMassEntityHandle& Handle)
+{
+	FMassNewEntityFragments Fragments;
+	Fragments.Velocity = &EntityManager.GetFragmentDataChecked<FMassVelocityFragment>(Handle);
+	Fragments.MoveTarget = &EntityManager.GetFragmentDataChecked<FMassMoveTargetFragment>(Handle);
+	InitMovementFragments(Fragments);
+}
+
+void UMassActorBindingComponent::InitMovementFragments(const FMassNewEntityFragments& Fragments)
 {
     // Velocity
-    FMassVelocityFragment& Vel = EntityManager.GetFragmentDataChecked<FMassVelocityFragment>(Handle);
-    Vel.Value = GetOwner()->GetVelocity();
+    Fragments.Velocity->Value = GetOwner()->GetVelocity();
 
 	AUnitBase* Unit = Cast<AUnitBase>(MyOwner);
     // MoveTarget
 	
-    FMassMoveTargetFragment& MT = EntityManager.GetFragmentDataChecked<FMassMoveTargetFragment>(Handle);
+    FMassMoveTargetFragment& MT = *Fragments.MoveTarget;
     MT.Center = GetOwner()->GetActorLocation();
 
 	if (Unit)
@@ -606,10 +715,17 @@ void UMassActorBindingComponent::InitAIFragments(FMassEntityManager& EntityManag
 
 void UMassActorBindingComponent::InitRepresentation(FMassEntityManager& EntityManager, const FMassEntityHandle& Handle)
 {
-    FMassActorFragment& ActorFrag = EntityManager.GetFragmentDataChecked<FMassActorFragment>(Handle);
-    ActorFrag.SetAndUpdateHandleMap(Handle, GetOwner(), false);
+	FMassNewEntityFragments Fragments;
+	Fragments.Actor = &EntityManager.GetFragmentDataChecked<FMassActorFragment>(Handle);
+	Fragments.RepresentationLOD = &EntityManager.GetFragmentDataChecked<FMassRepresentationLODFragment>(Handle);
+	InitRepresentation(Fragments, Handle);
+}
+
+void UMassActorBindingComponent::InitRepresentation(const FMassNewEntityFragments& Fragments, FMassEntityHandle Handle)
+{
+    Fragments.Actor->SetAndUpdateHandleMap(Handle, GetOwner(), false);
 
-    FMassRepresentationLODFragment& LODFrag = EntityManager.GetFragmentDataChecked<FMassRepresentationLODFragment>(Handle);
+    FMassRepresentationLODFragment& LODFrag = *Fragments.RepresentationLOD;
     LODFrag.LOD = EMassLOD::High;
     LODFrag.PrevLOD = EMassLOD::Max;
 }
@@ -701,7 +817,7 @@ FMassEntityHandle UMassActorBindingComponent::CreateAndLinkBuildingToMassEntity(
 	{
 		FMassArchetypeHandle Archetype;
 		FMassArchetypeSharedFragmentValues SharedValues;
-		if (!BuildArchetypeAndSharedValuesForBuilding(Archetype, SharedValues))
+		if (!GetOrBuildArchetypeAndSharedValues(Archetype, SharedValues))
 		{
 			return {};
 		}
@@ -710,92 +826,95 @@ FMassEntityHandle UMassActorBindingComponent::CreateAndLinkBuildingToMassEntity(
 
 		if (NewMassEntityHandle.IsValid())
 		{
-			
-			MassEntityHandle = NewMassEntityHandle;
-			ApplyInitialStartupFreeze(MyOwner, EM, NewMassEntityHandle);
-			InitTransform(EM, NewMassEntityHandle);
+			LinkBuildingToNewMassEntity(EM, NewMassEntityHandle);
+		}
+	}
+	
+	return NewMassEntityHandle;
+	
+}
 
-			if (AUnitBase* Unit = Cast<AUnitBase>(MyOwner))
-				if (Unit->CanMove)
-					InitMovementFragments(EM, NewMassEntityHandle);
-			
-			InitAIFragments(EM, NewMassEntityHandle);
-			InitRepresentation(EM, NewMassEntityHandle);
 
-			if (StopSeparation)
-			{
-				EM.Defer().AddTag<FMassStateStopSeparationTag>(NewMassEntityHandle);
-			}
-			
-			bNeedsMassBuildingSetup = false;
-			if (AUnitBase* UnitBase = Cast<AUnitBase>(MyOwner))
-			{
-				UnitBase->bIsMassUnit = true;
-				UnitBase->CheckTeamVisibility();
-			}
-			// Server: assign NetID and update authoritative registry for buildings as well
-			if (UWorld* WorldPtr = GetWorld())
+void UMassActorBindingComponent::LinkBuildingToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle)
+{
+	MassEntityHandle = NewMassEntityHandle;
+	ApplyInitialStartupFreeze(MyOwner, EM, NewMassEntityHandle);
+	InitTransform(EM, NewMassEntityHandle);
+
+	if (AUnitBase* Unit = Cast<AUnitBase>(MyOwner))
+		if (Unit->CanMove)
+			InitMovementFragments(EM, NewMassEntityHandle);
+	
+	InitAIFragments(EM, NewMassEntityHandle);
+	InitRepresentation(EM, NewMassEntityHandle);
+
+	if (StopSeparation)
+	{
+		EM.Defer().AddTag<FMassStateStopSeparationTag>(NewMassEntityHandle);
+	}
+	
+	bNeedsMassBuildingSetup = false;
+	if (AUnitBase* UnitBase = Cast<AUnitBase>(MyOwner))
+	{
+		UnitBase->bIsMassUnit = true;
+		UnitBase->CheckTeamVisibility();
+	}
+	// Server: assign NetID and update authoritative registry for buildings as well
+	if (UWorld* WorldPtr = GetWorld())
+	{
+		if (WorldPtr->GetNetMode() != NM_Client)
+		{
+			if (FMassNetworkIDFragment* NetFrag = EM.GetFragmentDataPtr<FMassNetworkIDFragment>(NewMassEntityHandle))
 			{
-				if (WorldPtr->GetNetMode() != NM_Client)
+				AUnitBase* UnitBaseLocal = Cast<AUnitBase>(MyOwner);
+				if (UnitBaseLocal && UnitBaseLocal->UnitState != UnitData::Dead)
 				{
-					if (FMassNetworkIDFragment* NetFrag = EM.GetFragmentDataPtr<FMassNetworkIDFragment>(NewMassEntityHandle))
+					if (AUnitRegistryReplicator* Reg = AUnitRegistryReplicator::GetOrSpawn(*WorldPtr))
 					{
-						AUnitBase* UnitBaseLocal = Cast<AUnitBase>(MyOwner);
-						if (UnitBaseLocal && UnitBaseLocal->UnitState != UnitData::Dead)
+						// Ensure stable UnitIndex before entering registry
+						int32 UnitIdxVal = UnitBaseLocal->UnitIndex;
+						if (UnitIdxVal <= 0)
 						{
-							if (AUnitRegistryReplicator* Reg = AUnitRegistryReplicator::GetOrSpawn(*WorldPtr))
+							if (ARTSGameModeBase* GM = WorldPtr->GetAuthGameMode<ARTSGameModeBase>())
 							{
-								// Ensure stable UnitIndex before entering registry
-								int32 UnitIdxVal = UnitBaseLocal->UnitIndex;
-								if (UnitIdxVal <= 0)
-								{
-									if (ARTSGameModeBase* GM = WorldPtr->GetAuthGameMode<ARTSGameModeBase>())
-									{
-										GM->AddUnitIndexAndAssignToAllUnitsArrayWithIndex(UnitBaseLocal, INDEX_NONE, FUnitSpawnParameter());
-										UnitIdxVal = UnitBaseLocal->UnitIndex;
-									}
-								}
-								if (UnitIdxVal <= 0)
-								{
-									return NewMassEntityHandle;
-								}
-
-								const uint32 NewID = Reg->GetNextNetID();
-								NetFrag->NetID = FMassNetworkID(NewID);
-								const FName OwnerName = MyOwner ? MyOwner->GetFName() : NAME_None;
-								FUnitRegistryItem* Existing = nullptr;
-								Existing = Reg->Registry.FindByUnitIndex(UnitIdxVal);
-								
-								if (Existing)
-								{
-									Existing->OwnerName = OwnerName;
-									Existing->UnitIndex = UnitIdxVal;
-									Existing->NetID = NetFrag->NetID;
-									Reg->Registry.MarkItemDirty(*Existing);
-								}
-								else
-								{
-									const int32 NewIdx2 = Reg->Registry.Items.AddDefaulted();
-									Reg->Registry.Items[NewIdx2].OwnerName = OwnerName;
-									Reg->Registry.Items[NewIdx2].UnitIndex = UnitIdxVal;
-									Reg->Registry.Items[NewIdx2].NetID = NetFrag->NetID;
-									Reg->Registry.MarkItemDirty(Reg->Registry.Items[NewIdx2]);
-								}
-								Reg->Registry.MarkArrayDirty();
-								Reg->ForceNetUpdate();
+								GM->AddUnitIndexAndAssignToAllUnitsArrayWithIndex(UnitBaseLocal, INDEX_NONE, FUnitSpawnParameter());
+								UnitIdxVal = UnitBaseLocal->UnitIndex;
 							}
 						}
+						if (UnitIdxVal <= 0)
+						{
+							return;
+						}
+
+						const uint32 NewID = Reg->GetNextNetID();
+						NetFrag->NetID = FMassNetworkID(NewID);
+						const FName OwnerName = MyOwner ? MyOwner->GetFName() : NAME_None;
+						FUnitRegistryItem* Existing = nullptr;
+						Existing = Reg->Registry.FindByUnitIndex(UnitIdxVal);
+						
+						if (Existing)
+						{
+							Existing->OwnerName = OwnerName;
+							Existing->UnitIndex = UnitIdxVal;
+							Existing->NetID = NetFrag->NetID;
+							Reg->Registry.MarkItemDirty(*Existing);
+						}
+						else
+						{
+							const int32 NewIdx2 = Reg->Registry.Items.AddDefaulted();
+							Reg->Registry.Items[NewIdx2].OwnerName = OwnerName;
+							Reg->Registry.Items[NewIdx2].UnitIndex = UnitIdxVal;
+							Reg->Registry.Items[NewIdx2].NetID = NetFrag->NetID;
+							Reg->Registry.MarkItemDirty(Reg->Registry.Items[NewIdx2]);
+						}
+						Reg->RequestRegistryNetUpdate();
 					}
 				}
 			}
 		}
 	}
-	
-	return NewMassEntityHandle;
-	
 }
 
-
 bool UMassActorBindingComponent::BuildArchetypeAndSharedValuesForBuilding(FMassArchetypeHandle& OutArchetype,
                                                                FMassArchetypeSharedFragmentValues& OutSharedValues)
 {
@@ -852,6 +971,7 @@ bool UMassActorBindingComponent::BuildArchetypeAndSharedValuesForBuilding(FMassA
 		FUnitMassTag::StaticStruct(),                   // Your custom tag
 		FMassPatrolFragment::StaticStruct(), 
 		//FUnitNavigationPathFragment::StaticStruct(),    // ** REQUIRED: Used by your UnitMovementProcessor for path state **
+		FUnitNavPolyFragment::StaticStruct(),
     
     	
 		FMassAIStateFragment::StaticStruct(),
@@ -859,6 +979,7 @@ bool UMassActorBindingComponent::BuildArchetypeAndSharedValuesForBuilding(FMassA
 		FMassAITargetFragment::StaticStruct(), 
 		FMassCombatStatsFragment::StaticStruct(), 
 		FMassAgentCharacteristicsFragment::StaticStruct(), 
+		FMassUnitVisibilityFragment::StaticStruct(),
 
 		//FMassWorkerStatsFragment::StaticStruct(),
 		// Actor Representation & Sync
@@ -941,12 +1062,23 @@ bool UMassActorBindingComponent::BuildArchetypeAndSharedValuesForBuilding(FMassA
 void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityManager& EntityManager,
 	FMassEntityHandle EntityHandle, AActor* OwnerActor)
 {
-	 // --- Get Owner References (Replace Placeholders) ---
-    // We assume OwnerActor is valid as it's checked before calling this function
-    AUnitBase* UnitOwner = Cast<AUnitBase>(OwnerActor); // <<< REPLACE AUnitBase
-    UAttributeSetBase* UnitAttributes = nullptr; // <<< REPLACE UUnitAttributesComponent
+	InitOwnerAbilitySystem(OwnerActor);
+
+	// Resolved after the GAS setup, which may run abilities against this entity
+	FMassNewEntityFragments Fragments;
+	Fragments.CombatStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(EntityHandle);
+	Fragments.Characteristics = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(EntityHandle);
+	Fragments.AIState = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(EntityHandle);
+	Fragments.Patrol = EntityManager.GetFragmentDataPtr<FMassPatrolFragment>(EntityHandle);
+	Fragments.AgentRadius = EntityManager.GetFragmentDataPtr<FAgentRadiusFragment>(EntityHandle);
+	Fragments.AvoidanceCollider = EntityManager.GetFragmentDataPtr<FMassAvoidanceColliderFragment>(EntityHandle);
+	Fragments.AITarget = EntityManager.GetFragmentDataPtr<FMassAITargetFragment>(EntityHandle);
+	InitializeMassEntityStatsFromOwner(Fragments, OwnerActor);
+}
 
-    if (UnitOwner)
+void UMassActorBindingComponent::InitOwnerAbilitySystem(AActor* OwnerActor)
+{
+    if (AUnitBase* UnitOwner = Cast<AUnitBase>(OwnerActor))
     {
     	UnitOwner->AbilitySystemComponent->InitAbilityActorInfo(UnitOwner, UnitOwner);
     	UnitOwner->InitializeAttributes();
@@ -954,7 +1086,6 @@ void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityM
     	UnitOwner->SetupAbilitySystemDelegates();
     	UnitOwner->GetAbilitiesArrays();
     	UnitOwner->AutoAbility();
-        UnitAttributes = UnitOwner->Attributes; // <<< REPLACE UUnitAttributesComponent
 		/*
     	if (UnitOwner->GetCharacterMovement())
     	{
@@ -963,6 +1094,19 @@ void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityM
     		UnitOwner->GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Walking);
     	} */
     }
+}
+
+void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(const FMassNewEntityFragments& Fragments, AActor* OwnerActor)
+{
+	 // --- Get Owner References (Replace Placeholders) ---
+    // We assume OwnerActor is valid as it's checked before calling this function
+    AUnitBase* UnitOwner = Cast<AUnitBase>(OwnerActor); // <<< REPLACE AUnitBase
+    UAttributeSetBase* UnitAttributes = nullptr; // <<< REPLACE UUnitAttributesComponent
+
+    if (UnitOwner)
+    {
+        UnitAttributes = UnitOwner->Attributes; // <<< REPLACE UUnitAttributesComponent
+    }
     else
     {
         //UE_LOG(LogTemp, Warning, TEXT("InitializeMassEntityStatsFromOwner: Owner %s is not of expected type 'AUnitBase'. Using default stats."), *OwnerActor->GetName());
@@ -978,7 +1122,7 @@ void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityM
     // --- INITIALIZE NEW FRAGMENTS ---
 
     // 1. Combat Stats Fragment
-    if (FMassCombatStatsFragment* CombatStatsFrag = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(EntityHandle))
+    if (FMassCombatStatsFragment* CombatStatsFrag = Fragments.CombatStats)
     {
         if (UnitOwner && UnitAttributes) // Use data from Actor/Attributes if available
         {
@@ -1016,7 +1160,7 @@ void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityM
     }
 
     // 2. Agent Characteristics Fragment
-    if (FMassAgentCharacteristicsFragment* CharFrag = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(EntityHandle))
+    if (FMassAgentCharacteristicsFragment* CharFrag = Fragments.Characteristics)
     {
         if (UnitOwner) // Use data from Actor if available
         {
@@ -1063,7 +1207,7 @@ void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityM
              *CharFrag = FMassAgentCharacteristicsFragment(); // Initialize with struct defaults
         }
     }
-	if (FMassAIStateFragment* StateFragment = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(EntityHandle))
+	if (FMassAIStateFragment* StateFragment = Fragments.AIState)
 	{
 		if (UnitOwner) // Use data from Actor if available
 		{
@@ -1114,7 +1258,7 @@ void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityM
 	}
 	
     // 3. Patrol Fragment
-    if (FMassPatrolFragment* PatrolFrag = EntityManager.GetFragmentDataPtr<FMassPatrolFragment>(EntityHandle))
+    if (FMassPatrolFragment* PatrolFrag = Fragments.Patrol)
     {
         if (UnitOwner && UnitOwner->NextWaypoint) // Use config from Actor if available
         {
@@ -1141,18 +1285,18 @@ void UMassActorBindingComponent::InitializeMassEntityStatsFromOwner(FMassEntityM
 
     // --- Initialize Radius/Avoidance Fragments USING the calculated AgentRadius ---
     // (Moved here as it depends on CombatStats)
-    if(FAgentRadiusFragment* RadiusFrag = EntityManager.GetFragmentDataPtr<FAgentRadiusFragment>(EntityHandle))
+    if(FAgentRadiusFragment* RadiusFrag = Fragments.AgentRadius)
     {
        RadiusFrag->Radius = UnitOwner->GetCapsuleComponent()->GetUnscaledCapsuleRadius() + AdditionalCapsuleRadius;
     }
 
-    if(FMassAvoidanceColliderFragment* AvoidanceFrag = EntityManager.GetFragmentDataPtr<FMassAvoidanceColliderFragment>(EntityHandle))
+    if(FMassAvoidanceColliderFragment* AvoidanceFrag = Fragments.AvoidanceCollider)
     {
        // Make sure collider type matches expectations (Circle assumed here)
        *AvoidanceFrag = FMassAvoidanceColliderFragment(FMassCircleCollider(UnitOwner->GetCapsuleComponent()->GetScaledCapsuleRadius() + AdditionalCapsuleRadius));
     }
 
-	if(FMassAITargetFragment* TargetFrag = EntityManager.GetFragmentDataPtr<FMassAITargetFragment>(EntityHandle))
+	if(FMassAITargetFragment* TargetFrag = Fragments.AITarget)
 	{
 		TargetFrag->FollowRadius = FollowRadius;
 		TargetFrag->FollowOffset = FollowOffset;
@@ -0,0 +1,85 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/Projectiles/ProjectileSimulationProcessor.h"
+
+#include "MassExecutionContext.h"
+#include "MassCommonFragments.h"
+#include "MassActorSubsystem.h"
+#include "Mass/UnitMassTag.h"
+#include "Characters/Unit/UnitBase.h"
+#include "Components/CapsuleComponent.h"
+#include "EngineUtils.h"
+
+UProjectileSimulationProcessor::UProjectileSimulationProcessor()
+	: UnitQuery()
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Tasks;
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	bAutoRegisterWithProcessingPhases = true;
+	// Impacts touch actors, attributes and RPCs
+	bRequiresGameThreadExecution = true;
+}
+
+void UProjectileSimulationProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	UnitQuery.Initialize(EntityManager);
+	UnitQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	UnitQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly);
+	UnitQuery.AddRequirement<FMassActorFragment>(EMassFragmentAccess::ReadOnly);
+	// Dead units stay in: overlaps with them consume a pierce, like AProjectile::OnOverlapBegin
+	UnitQuery.RegisterWithProcessor(*this);
+}
+
+void UProjectileSimulationProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	Super::InitializeInternal(Owner, EntityManager);
+	if (UWorld* World = Owner.GetWorld())
+	{
+		ProjectileSubsystem = World->GetSubsystem<UProjectileSimulationSubsystem>();
+	}
+}
+
+void UProjectileSimulationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	if (!ProjectileSubsystem || !ProjectileSubsystem->HasActiveProjectiles())
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ProjectileSimulationProcessor_Execute);
+
+	if (ProjectileSubsystem->NeedsHitGrid())
+	{
+		TActorGridIndex<AUnitBase>& HitIndex = ProjectileSubsystem->GetHitIndexMutable();
+		HitIndex.Reset();
+
+		UnitQuery.ForEachEntityChunk(EntityManager, Context, [&HitIndex](FMassExecutionContext& ChunkContext)
+		{
+			const TConstArrayView<FTransformFragment> TransformList = ChunkContext.GetFragmentView<FTransformFragment>();
+			const TConstArrayView<FMassAgentCharacteristicsFragment> CharList = ChunkContext.GetFragmentView<FMassAgentCharacteristicsFragment>();
+			const TConstArrayView<FMassActorFragment> ActorList = ChunkContext.GetFragmentView<FMassActorFragment>();
+
+			const int32 NumEntities = ChunkContext.GetNumEntities();
+			for (int32 i = 0; i < NumEntities; ++i)
+			{
+				if (AUnitBase* Unit = Cast<AUnitBase>(ActorList[i].GetMutable()))
+				{
+					HitIndex.Add(Unit, TransformList[i].GetTransform().GetLocation(), CharList[i].CapsuleRadius, CharList[i].CapsuleHeight);
+				}
+			}
+		});
+
+		// Actor AI units (AUnitControllerBase) have no entity, take them from their capsule
+		for (TActorIterator<AUnitBase> It(EntityManager.GetWorld()); It; ++It)
+		{
+			AUnitBase* Unit = *It;
+			const UCapsuleComponent* Capsule = Unit->GetCapsuleComponent();
+			if (!Unit->bIsMassUnit && Capsule)
+			{
+				HitIndex.Add(Unit, Unit->GetActorLocation(), Capsule->GetScaledCapsuleRadius(), Capsule->GetScaledCapsuleHalfHeight());
+			}
+		}
+	}
+
+	ProjectileSubsystem->Advance(Context.GetDeltaTimeSeconds());
+}
@@ -0,0 +1,919 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/Projectiles/ProjectileSimulationSubsystem.h"
+
+#include "Actors/Projectile.h"
+#include "Characters/Unit/UnitBase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_Projectiles_PooledSimulation(
+	TEXT("net.RTS.Projectiles.PooledSimulation"),
+	1,
+	TEXT("1 = projectile classes with bUsePooledSimulation are simulated by UProjectileSimulationSubsystem, 0 = always spawn AProjectile actors."),
+	ECVF_Default);
+
+namespace
+{
+	AUnitBase* GetNextUnitInRange(AUnitBase* ShootingUnit, AUnitBase* UnitToHit)
+	{
+		float Range = 9999999.f;
+		AUnitBase* RUnit = nullptr;
+		for (AUnitBase* Unit : ShootingUnit->UnitsToChase)
+		{
+			if (Unit && Unit != UnitToHit)
+			{
+				const float Distance = FVector::Dist(Unit->GetActorLocation(), ShootingUnit->GetActorLocation());
+				if (Distance <= Range)
+				{
+					Range = Distance;
+					RUnit = Unit;
+				}
+			}
+		}
+		return RUnit;
+	}
+
+	bool IsProjectileVisibleFor(const AUnitBase* ShootingUnit, const AUnitBase* TargetUnit)
+	{
+		// Same rule as AProjectile::SetProjectileVisibility
+		const bool bShootingVisible = ShootingUnit ? ((ShootingUnit->IsVisibleEnemy || ShootingUnit->IsMyTeam) ? true : (!ShootingUnit->EnableFog)) : false;
+		const bool bTargetVisible   = TargetUnit ? ((TargetUnit->IsVisibleEnemy  || TargetUnit->IsMyTeam)  ? true : (!TargetUnit->EnableFog))   : false;
+		return bShootingVisible || bTargetVisible;
+	}
+
+	FTransform MakeNiagaraWorldTransform(const FTransform& InstanceTransform, const FTransform& StartTransform)
+	{
+		// Keep the component's relative offset, like AProjectile::Multicast_UpdateISMTransform
+		const FVector WorldOffset = InstanceTransform.GetRotation().RotateVector(StartTransform.GetLocation());
+		const FQuat WorldRotation = InstanceTransform.GetRotation() * StartTransform.GetRotation();
+		return FTransform(WorldRotation, InstanceTransform.GetLocation() + WorldOffset, StartTransform.GetScale3D());
+	}
+}
+
+void UProjectileSimulationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	// Collision radii are small, so finer cells than the work area indices
+	HitIndex.SetCellSize(500.f);
+}
+
+void UProjectileSimulationSubsystem::Deinitialize()
+{
+	ResetSystem();
+	Super::Deinitialize();
+}
+
+bool UProjectileSimulationSubsystem::IsPooledSimulationEnabled(TSubclassOf<AProjectile> ProjectileClass)
+{
+	if (!ProjectileClass || CVarRTS_Projectiles_PooledSimulation.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+	const AProjectile* CDO = ProjectileClass->GetDefaultObject<AProjectile>();
+	return CDO && CDO->bUsePooledSimulation;
+}
+
+void UProjectileSimulationSubsystem::ResetSystem()
+{
+	if (VisualHost)
+	{
+		VisualHost->Destroy();
+		VisualHost = nullptr;
+	}
+	ClassConfigs.Reset();
+
+	Ids.Reset();
+	ClassIndices.Reset();
+	Shooters.Reset();
+	Targets.Reset();
+	TeamIds.Reset();
+	Transforms.Reset();
+	FlightDirections.Reset();
+	TargetLocations.Reset();
+	ArcStartLocations.Reset();
+	Speeds.Reset();
+	Damages.Reset();
+	LifeTimes.Reset();
+	ArcTravelTimes.Reset();
+	OverlapTimers.Reset();
+	DestroyTimers.Reset();
+	PiercedCounts.Reset();
+	PiercedUnits.Reset();
+	InstanceIndices.Reset();
+	NiagaraAComponents.Reset();
+	NiagaraBComponents.Reset();
+	AuthorityFlags.Reset();
+	BouncedBackFlags.Reset();
+	VisibleFlags.Reset();
+	SlotById.Reset();
+	SlotsPendingRemoval.Reset();
+	PendingFollowUps.Reset();
+	HitIndex.Reset();
+}
+
+int32 UProjectileSimulationSubsystem::FindOrAddClassConfig(TSubclassOf<AProjectile> ProjectileClass)
+{
+	for (int32 i = 0; i < ClassConfigs.Num(); ++i)
+	{
+		if (ClassConfigs[i].ProjectileClass == ProjectileClass)
+		{
+			return i;
+		}
+	}
+
+	const AProjectile* CDO = ProjectileClass->GetDefaultObject<AProjectile>();
+
+	FProjectileClassConfig& Config = ClassConfigs.AddDefaulted_GetRef();
+	Config.ProjectileClass = ProjectileClass;
+	Config.ImpactVFX = CDO->ImpactVFX;
+	Config.ImpactSound = CDO->ImpactSound;
+	Config.ProjectileEffect = CDO->ProjectileEffect;
+	Config.ScaleImpactVFX = CDO->ScaleImpactVFX;
+	Config.ScaleImpactSound = CDO->ScaleImpactSound;
+	Config.RotationSpeed = CDO->RotationSpeed;
+	Config.ArcHeight = CDO->ArcHeight;
+	Config.ArcHeightDistanceFactor = CDO->ArcHeightDistanceFactor;
+	Config.MaxLifeTime = CDO->MaxLifeTime;
+	Config.CollisionRadius = CDO->CollisionRadius;
+	Config.OverlapCheckInterval = CDO->OverlapCheckInterval;
+	Config.DestructionDelayTime = CDO->DestructionDelayTime;
+	Config.MaxPiercedTargets = CDO->MaxPiercedTargets;
+	Config.bFollowTarget = CDO->FollowTarget;
+	Config.bRotateMesh = CDO->RotateMesh;
+	Config.bIsHealing = CDO->IsHealing;
+	Config.bIsBouncingBack = CDO->IsBouncingBack;
+	Config.bIsBouncingNext = CDO->IsBouncingNext;
+	Config.bUseAttributeDamage = CDO->UseAttributeDamage;
+
+	// Dedicated servers never render, so they keep no visual pools at all
+	if (GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return ClassConfigs.Num() - 1;
+	}
+
+	if (CDO->Niagara_A)
+	{
+		Config.NiagaraA = CDO->Niagara_A->GetAsset();
+		Config.NiagaraAStart = CDO->Niagara_A->GetRelativeTransform();
+	}
+	if (CDO->Niagara_B)
+	{
+		Config.NiagaraB = CDO->Niagara_B->GetAsset();
+		Config.NiagaraBStart = CDO->Niagara_B->GetRelativeTransform();
+	}
+
+	if (CDO->ISMComponent && CDO->ISMComponent->GetStaticMesh())
+	{
+		AActor* Host = GetOrCreateVisualHost();
+		UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(Host);
+		ISM->SetStaticMesh(CDO->ISMComponent->GetStaticMesh());
+		for (int32 MatIdx = 0; MatIdx < CDO->ISMComponent->GetNumMaterials(); ++MatIdx)
+		{
+			ISM->SetMaterial(MatIdx, CDO->ISMComponent->GetMaterial(MatIdx));
+		}
+		ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		ISM->SetCastShadow(CDO->ISMComponent->CastShadow);
+		ISM->SetupAttachment(Host->GetRootComponent());
+		ISM->RegisterComponent();
+		Config.ISM = ISM;
+	}
+
+	return ClassConfigs.Num() - 1;
+}
+
+AActor* UProjectileSimulationSubsystem::GetOrCreateVisualHost()
+{
+	if (VisualHost)
+	{
+		return VisualHost;
+	}
+
+	FActorSpawnParameters Params;
+	Params.ObjectFlags |= RF_Transient;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	VisualHost = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+
+	// Root stays at the origin so instance transforms can be written in world space
+	USceneComponent* Root = NewObject<USceneComponent>(VisualHost);
+	VisualHost->SetRootComponent(Root);
+	Root->RegisterComponent();
+	return VisualHost;
+}
+
+void UProjectileSimulationSubsystem::SpawnFromEvent(const FProjectileSpawnEvent& Event, AUnitBase* Shooter, bool bAuthority)
+{
+	if (!Event.ProjectileClass || !Shooter)
+	{
+		return;
+	}
+
+	const int32 Slot = Ids.Num();
+	const int32 ClassIdx = FindOrAddClassConfig(Event.ProjectileClass);
+
+	Ids.Add(Event.ProjectileId);
+	ClassIndices.Add(ClassIdx);
+	Shooters.Add(Shooter);
+	Targets.Add(Event.Target);
+	TeamIds.Add(Shooter->TeamId);
+	Transforms.Add(FTransform(Event.Rotation, Event.Origin, Event.Scale));
+	FlightDirections.Add((FVector(Event.TargetLocation) - FVector(Event.Origin)).GetSafeNormal());
+	TargetLocations.Add(Event.TargetLocation);
+	ArcStartLocations.Add(Event.ArcOrigin);
+	Speeds.Add(Event.Speed);
+	Damages.Add(Shooter->Attributes ? Shooter->Attributes->GetAttackDamage() : Event.ProjectileClass->GetDefaultObject<AProjectile>()->Damage);
+	LifeTimes.Add(0.f);
+	ArcTravelTimes.Add(0.f);
+	OverlapTimers.Add(0.f);
+	DestroyTimers.Add(-1.f);
+	PiercedCounts.Add(0);
+	PiercedUnits.AddDefaulted();
+	InstanceIndices.Add(INDEX_NONE);
+	NiagaraAComponents.AddDefaulted();
+	NiagaraBComponents.AddDefaulted();
+	AuthorityFlags.Add(bAuthority ? 1 : 0);
+	BouncedBackFlags.Add(0);
+	VisibleFlags.Add(IsProjectileVisibleFor(Shooter, Event.Target) ? 1 : 0);
+
+	SlotById.Add(Event.ProjectileId, Slot);
+
+	AcquireVisuals(Slot);
+	UpdateVisuals(Slot);
+}
+
+void UProjectileSimulationSubsystem::RetargetProjectile(int32 ProjectileId, AUnitBase* NewTarget, const FVector& NewTargetLocation, bool bBouncedBack)
+{
+	const int32* SlotPtr = SlotById.Find(ProjectileId);
+	if (!SlotPtr)
+	{
+		return;
+	}
+	const int32 Slot = *SlotPtr;
+
+	Targets[Slot] = NewTarget;
+	TargetLocations[Slot] = NewTargetLocation;
+	FlightDirections[Slot] = (NewTargetLocation - Transforms[Slot].GetLocation()).GetSafeNormal();
+	if (bBouncedBack)
+	{
+		BouncedBackFlags[Slot] = 1;
+	}
+}
+
+void UProjectileSimulationSubsystem::ReleaseProjectile(int32 ProjectileId)
+{
+	if (const int32* SlotPtr = SlotById.Find(ProjectileId))
+	{
+		DestroyWithDelay(*SlotPtr);
+	}
+}
+
+void UProjectileSimulationSubsystem::ApplyFollowUps(const TArray<FProjectileFollowUpEvent>& Events)
+{
+	for (const FProjectileFollowUpEvent& Event : Events)
+	{
+		if (Event.bRelease)
+		{
+			ReleaseProjectile(Event.ProjectileId);
+		}
+		else
+		{
+			RetargetProjectile(Event.ProjectileId, Event.NewTarget, Event.NewTargetLocation, Event.bBouncedBack);
+		}
+	}
+}
+
+void UProjectileSimulationSubsystem::QueueFollowUp(int32 Slot, AUnitBase* NewTarget, const FVector& NewTargetLocation, bool bBouncedBack, bool bRelease)
+{
+	const int32 ProjectileId = Ids[Slot];
+	if (bRelease)
+	{
+		ReleaseProjectile(ProjectileId);
+	}
+	else
+	{
+		RetargetProjectile(ProjectileId, NewTarget, NewTargetLocation, bBouncedBack);
+	}
+
+	if (GetWorld()->GetNetMode() == NM_Standalone || !Shooters[Slot].IsValid())
+	{
+		return;
+	}
+
+	FProjectileFollowUpEvent& Event = PendingFollowUps.FindOrAdd(Shooters[Slot]).AddDefaulted_GetRef();
+	Event.ProjectileId = ProjectileId;
+	Event.NewTarget = NewTarget;
+	Event.NewTargetLocation = NewTargetLocation;
+	Event.bBouncedBack = bBouncedBack;
+	Event.bRelease = bRelease;
+}
+
+void UProjectileSimulationSubsystem::FlushFollowUps()
+{
+	// Unreliable: a lost retarget or release only leaves the client copy flying until MaxLifeTime
+	for (TPair<TWeakObjectPtr<AUnitBase>, TArray<FProjectileFollowUpEvent>>& Pair : PendingFollowUps)
+	{
+		if (AUnitBase* Shooter = Pair.Key.Get())
+		{
+			Shooter->Multicast_PooledProjectileFollowUps(Pair.Value);
+		}
+	}
+	PendingFollowUps.Reset();
+}
+
+bool UProjectileSimulationSubsystem::NeedsHitGrid() const
+{
+	for (int32 Slot = 0; Slot < Ids.Num(); ++Slot)
+	{
+		const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+		const bool bIsArc = Config.ArcHeight > 0.f || Config.ArcHeightDistanceFactor > 0.f;
+		if (DestroyTimers[Slot] < 0.f && (bIsArc || !Targets[Slot].IsValid()))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UProjectileSimulationSubsystem::Advance(float DeltaTime)
+{
+	SlotsPendingRemoval.Reset();
+
+	for (int32 Slot = 0; Slot < Ids.Num(); ++Slot)
+	{
+		// Finished projectiles linger for DestructionDelayTime, like DestroyProjectileWithDelay
+		if (DestroyTimers[Slot] >= 0.f)
+		{
+			DestroyTimers[Slot] -= DeltaTime;
+			if (DestroyTimers[Slot] <= 0.f)
+			{
+				SlotsPendingRemoval.Add(Slot);
+			}
+			continue;
+		}
+
+		const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+		LifeTimes[Slot] += DeltaTime;
+
+		if (Config.bRotateMesh)
+		{
+			const FRotator RotationDelta(Config.RotationSpeed.X * DeltaTime, Config.RotationSpeed.Y * DeltaTime, Config.RotationSpeed.Z * DeltaTime);
+			Transforms[Slot].ConcatenateRotation(RotationDelta.Quaternion());
+		}
+
+		if (LifeTimes[Slot] > Config.MaxLifeTime)
+		{
+			if (AuthorityFlags[Slot])
+			{
+				ResetShooterTarget(Slot);
+			}
+			SlotsPendingRemoval.Add(Slot);
+			continue;
+		}
+
+		if (Config.ArcHeight > 0.f || Config.ArcHeightDistanceFactor > 0.f)
+		{
+			FlyInArc(Slot, DeltaTime);
+		}
+		else if (Targets[Slot].IsValid())
+		{
+			FlyToUnitTarget(Slot, DeltaTime);
+		}
+		else
+		{
+			FlyToLocationTarget(Slot, DeltaTime);
+		}
+
+		UpdateVisuals(Slot);
+	}
+
+	// Slots are ascending; removing from the back keeps the remaining indices valid
+	for (int32 i = SlotsPendingRemoval.Num() - 1; i >= 0; --i)
+	{
+		RemoveSlot(SlotsPendingRemoval[i]);
+	}
+
+	FlushFollowUps();
+	FlushInstanceUpdates();
+}
+
+void UProjectileSimulationSubsystem::FlyToUnitTarget(int32 Slot, float DeltaTime)
+{
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	AUnitBase* UnitTarget = Targets[Slot].Get();
+	const FVector CurrentLocation = Transforms[Slot].GetLocation();
+
+	if (Config.bFollowTarget)
+	{
+		if (UnitTarget->GetUnitState() != UnitData::Dead)
+		{
+			TargetLocations[Slot] = UnitTarget->GetMassActorLocation();
+		}
+		FlightDirections[Slot] = (TargetLocations[Slot] - CurrentLocation).GetSafeNormal();
+	}
+
+	const float FrameSpeed = Speeds[Slot] * DeltaTime * 10.f;
+	Transforms[Slot].AddToTranslation(FlightDirections[Slot] * FrameSpeed);
+
+	const float Distance = FVector::Dist(Transforms[Slot].GetLocation(), TargetLocations[Slot]);
+	if (Distance <= FrameSpeed + Config.CollisionRadius)
+	{
+		ResolveImpact(Slot, UnitTarget);
+	}
+}
+
+void UProjectileSimulationSubsystem::FlyToLocationTarget(int32 Slot, float DeltaTime)
+{
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	const FVector CurrentLocation = Transforms[Slot].GetLocation();
+
+	if (FlightDirections[Slot].IsNearlyZero(0.1f))
+	{
+		FlightDirections[Slot] = (TargetLocations[Slot] - CurrentLocation).GetSafeNormal();
+		if (FlightDirections[Slot].IsNearlyZero(0.1f) && Shooters[Slot].IsValid())
+		{
+			FlightDirections[Slot] = Shooters[Slot]->GetActorForwardVector();
+		}
+	}
+
+	Transforms[Slot].AddToTranslation(FlightDirections[Slot] * Speeds[Slot] * DeltaTime * 10.f);
+
+	OverlapTimers[Slot] += DeltaTime;
+	if (OverlapTimers[Slot] < Config.OverlapCheckInterval)
+	{
+		return;
+	}
+	OverlapTimers[Slot] = 0.f;
+
+	AUnitBase* ShootingUnit = Shooters[Slot].Get();
+	TArray<AUnitBase*, TInlineAllocator<8>> HitUnits;
+	HitIndex.GatherInSphere(Transforms[Slot].GetLocation(), Config.CollisionRadius, HitUnits);
+
+	for (AUnitBase* HitUnit : HitUnits)
+	{
+		if (DestroyTimers[Slot] >= 0.f)
+		{
+			break;
+		}
+		if (HitUnit != ShootingUnit)
+		{
+			ResolveOverlap(Slot, HitUnit);
+		}
+	}
+}
+
+void UProjectileSimulationSubsystem::FlyInArc(int32 Slot, float DeltaTime)
+{
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	AUnitBase* ShootingUnit = Shooters[Slot].Get();
+
+	if (ShootingUnit && TargetLocations[Slot].IsNearlyZero(0.1f))
+	{
+		TargetLocations[Slot] = ArcStartLocations[Slot] + ShootingUnit->GetActorForwardVector() * 10000.f;
+	}
+
+	if (Config.bFollowTarget && Targets[Slot].IsValid() && Targets[Slot]->GetUnitState() != UnitData::Dead)
+	{
+		TargetLocations[Slot] = Targets[Slot]->GetMassActorLocation();
+	}
+
+	const float TotalDistance = FVector::Dist(ArcStartLocations[Slot], TargetLocations[Slot]);
+	const float TotalTravelTime = Speeds[Slot] > 0 ? TotalDistance / Speeds[Slot] : 1.0f;
+
+	ArcTravelTimes[Slot] += DeltaTime * 10.f;
+	const float Alpha = FMath::Clamp(ArcTravelTimes[Slot] / TotalTravelTime, 0.f, 1.f);
+
+	FVector NewLocation = FMath::Lerp(ArcStartLocations[Slot], TargetLocations[Slot], Alpha);
+	const float CurrentArcHeight = Config.ArcHeight + (TotalDistance * Config.ArcHeightDistanceFactor);
+	NewLocation.Z += FMath::Sin(Alpha * PI) * CurrentArcHeight;
+
+	if (Alpha < 0.99f)
+	{
+		const FVector Direction = (NewLocation - Transforms[Slot].GetLocation()).GetSafeNormal();
+		if (!Direction.IsNearlyZero())
+		{
+			Transforms[Slot].SetRotation(Direction.Rotation().Quaternion());
+		}
+	}
+	Transforms[Slot].SetLocation(NewLocation);
+
+	OverlapTimers[Slot] += DeltaTime;
+	if (OverlapTimers[Slot] >= Config.OverlapCheckInterval)
+	{
+		OverlapTimers[Slot] = 0.f;
+
+		TArray<AUnitBase*, TInlineAllocator<8>> HitUnits;
+		HitIndex.GatherInSphere(NewLocation, Config.CollisionRadius, HitUnits);
+
+		for (AUnitBase* HitUnit : HitUnits)
+		{
+			if (HitUnit != ShootingUnit)
+			{
+				ResolveImpact(Slot, HitUnit);
+				return;
+			}
+		}
+	}
+
+	if (Alpha >= 1.0f)
+	{
+		DestroyWithDelay(Slot);
+	}
+}
+
+void UProjectileSimulationSubsystem::ResolveOverlap(int32 Slot, AUnitBase* UnitToHit)
+{
+	// Same branches as AProjectile::OnOverlapBegin
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	const bool bSameTeam = UnitToHit->TeamId == TeamIds[Slot];
+	const bool bBouncedBack = BouncedBackFlags[Slot] != 0;
+
+	if (UnitToHit->GetUnitState() == UnitData::Dead || (bSameTeam && bBouncedBack && !Config.bIsHealing))
+	{
+		if (AuthorityFlags[Slot] && Shooters[Slot].IsValid())
+		{
+			AProjectile::FireImpactEffects(Shooters[Slot].Get(), UnitToHit, Config.ImpactVFX, Config.ImpactSound, Config.ScaleImpactVFX, Config.ScaleImpactSound, Transforms[Slot].GetLocation().Z);
+		}
+		DestroyWhenMaxPierced(Slot);
+	}
+	else if (bSameTeam && Config.bIsHealing)
+	{
+		ResolveImpactHeal(Slot, UnitToHit);
+	}
+	else if (!bSameTeam && !Config.bIsHealing)
+	{
+		ResolveImpact(Slot, UnitToHit);
+		if (AuthorityFlags[Slot])
+		{
+			AProjectile::ApplyIsAttacked(GetWorld(), UnitToHit);
+		}
+	}
+}
+
+void UProjectileSimulationSubsystem::ResolveImpact(int32 Slot, AUnitBase* UnitToHit)
+{
+	if (PiercedUnits[Slot].Contains(UnitToHit))
+	{
+		return;
+	}
+
+	AUnitBase* ShootingUnit = Shooters[Slot].Get();
+	if (!ShootingUnit)
+	{
+		DestroyWithDelay(Slot);
+		return;
+	}
+
+	if (!UnitToHit || !UnitToHit->IsUnitDetectable())
+	{
+		if (AuthorityFlags[Slot])
+		{
+			ShootingUnit->ResetTarget();
+			ShootingUnit->UnitToChase = nullptr;
+		}
+		return;
+	}
+
+	PiercedUnits[Slot].Add(UnitToHit);
+
+	// Clients only mirror the flight; damage, effects and bounce decisions stay on the server
+	if (!AuthorityFlags[Slot])
+	{
+		ContinueAfterImpact(Slot, UnitToHit);
+		return;
+	}
+
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	const float NewDamage = AProjectile::CalculateImpactDamage(ShootingUnit, UnitToHit, Damages[Slot], Config.bUseAttributeDamage);
+
+	if (UnitToHit->Attributes->GetShield() <= 0)
+		UnitToHit->SetHealth_Implementation(UnitToHit->Attributes->GetHealth() - NewDamage);
+	else
+		UnitToHit->SetShield_Implementation(UnitToHit->Attributes->GetShield() - NewDamage);
+
+	if (UnitToHit->GetUnitState() != UnitData::Dead && UnitToHit->TeamId != TeamIds[Slot])
+	{
+		UnitToHit->ApplyInvestmentEffect(Config.ProjectileEffect);
+		ShootingUnit->IncreaseExperience();
+	}
+
+	if (UnitToHit->DefensiveAbilityID != EGASAbilityInputID::None)
+	{
+		UnitToHit->ActivateAbilityByInputID(UnitToHit->DefensiveAbilityID, UnitToHit->DefensiveAbilities);
+	}
+
+	AProjectile::FireImpactEffects(ShootingUnit, UnitToHit, Config.ImpactVFX, Config.ImpactSound, Config.ScaleImpactVFX, Config.ScaleImpactSound, Transforms[Slot].GetLocation().Z);
+	ContinueAfterImpact(Slot, UnitToHit);
+}
+
+void UProjectileSimulationSubsystem::ResolveImpactHeal(int32 Slot, AUnitBase* UnitToHit)
+{
+	AUnitBase* ShootingUnit = Shooters[Slot].Get();
+	if (!ShootingUnit)
+	{
+		DestroyWithDelay(Slot);
+		return;
+	}
+
+	if (!UnitToHit->IsUnitDetectable())
+	{
+		if (AuthorityFlags[Slot])
+		{
+			ShootingUnit->ResetTarget();
+			ShootingUnit->UnitToChase = nullptr;
+		}
+		return;
+	}
+
+	if (!AuthorityFlags[Slot])
+	{
+		ContinueAfterImpact(Slot, UnitToHit);
+		return;
+	}
+
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	const float NewHeal = Config.bUseAttributeDamage ? ShootingUnit->Attributes->GetAttackDamage() : Damages[Slot];
+
+	if (UnitToHit->Attributes->GetShield() <= 0)
+		UnitToHit->SetHealth_Implementation(UnitToHit->Attributes->GetHealth() + NewHeal);
+	else
+		UnitToHit->SetShield_Implementation(UnitToHit->Attributes->GetShield() + NewHeal);
+
+	if (UnitToHit->GetUnitState() != UnitData::Dead)
+	{
+		UnitToHit->ApplyInvestmentEffect(Config.ProjectileEffect);
+	}
+
+	if (UnitToHit->DefensiveAbilityID != EGASAbilityInputID::None)
+	{
+		UnitToHit->ActivateAbilityByInputID(UnitToHit->DefensiveAbilityID, UnitToHit->DefensiveAbilities);
+	}
+
+	AProjectile::FireImpactEffects(ShootingUnit, UnitToHit, Config.ImpactVFX, Config.ImpactSound, Config.ScaleImpactVFX, Config.ScaleImpactSound, Transforms[Slot].GetLocation().Z);
+	ContinueAfterImpact(Slot, UnitToHit);
+}
+
+void UProjectileSimulationSubsystem::ContinueAfterImpact(int32 Slot, AUnitBase* UnitToHit)
+{
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	const bool bBouncing = Config.bIsBouncingNext || Config.bIsBouncingBack;
+
+	// Bounce targets are picked by the server and arrive through Multicast_PooledProjectileFollowUps
+	if (bBouncing && AuthorityFlags[Slot])
+	{
+		AUnitBase* ShootingUnit = Shooters[Slot].Get();
+		SetNextBouncing(Slot, ShootingUnit, UnitToHit);
+		SetBackBouncing(Slot, ShootingUnit);
+	}
+
+	const bool bShouldPierceAndContinue = PiercedCounts[Slot] < Config.MaxPiercedTargets - 1 && !bBouncing;
+	if (bShouldPierceAndContinue && (Targets[Slot] == UnitToHit || !Targets[Slot].IsValid()))
+	{
+		const FVector NewDirection(FlightDirections[Slot].X, FlightDirections[Slot].Y, 0.f);
+		TargetLocations[Slot] = Transforms[Slot].GetLocation() + NewDirection * 10000.f;
+		Targets[Slot] = nullptr;
+	}
+
+	if (bBouncing && !AuthorityFlags[Slot])
+	{
+		// Count the hit, but leave the final release to the server
+		++PiercedCounts[Slot];
+		return;
+	}
+
+	DestroyWhenMaxPierced(Slot);
+}
+
+void UProjectileSimulationSubsystem::SetNextBouncing(int32 Slot, AUnitBase* ShootingUnit, AUnitBase* UnitToHit)
+{
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	if (!Config.bIsBouncingNext || !ShootingUnit)
+	{
+		return;
+	}
+
+	AUnitBase* NewTarget = GetNextUnitInRange(ShootingUnit, UnitToHit);
+	if (!NewTarget)
+	{
+		QueueFollowUp(Slot, nullptr, FVector::ZeroVector, false, true);
+		return;
+	}
+
+	QueueFollowUp(Slot, NewTarget, NewTarget->GetActorLocation(), false, false);
+}
+
+void UProjectileSimulationSubsystem::SetBackBouncing(int32 Slot, AUnitBase* ShootingUnit)
+{
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	if (!Config.bIsBouncingBack || !ShootingUnit)
+	{
+		return;
+	}
+
+	const bool bLastBounce = Config.bIsBouncingNext && PiercedCounts[Slot] == (Config.MaxPiercedTargets - 1);
+	if (bLastBounce || PiercedCounts[Slot] < Config.MaxPiercedTargets)
+	{
+		QueueFollowUp(Slot, ShootingUnit, ShootingUnit->GetActorLocation(), true, false);
+	}
+}
+
+void UProjectileSimulationSubsystem::DestroyWhenMaxPierced(int32 Slot)
+{
+	const FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+	++PiercedCounts[Slot];
+	if (PiercedCounts[Slot] >= Config.MaxPiercedTargets)
+	{
+		if (AuthorityFlags[Slot] && (Config.bIsBouncingNext || Config.bIsBouncingBack) && Shooters[Slot].IsValid())
+		{
+			QueueFollowUp(Slot, nullptr, FVector::ZeroVector, false, true);
+		}
+		DestroyWithDelay(Slot);
+	}
+}
+
+void UProjectileSimulationSubsystem::DestroyWithDelay(int32 Slot)
+{
+	if (DestroyTimers[Slot] < 0.f)
+	{
+		DestroyTimers[Slot] = FMath::Max(ClassConfigs[ClassIndices[Slot]].DestructionDelayTime, KINDA_SMALL_NUMBER);
+	}
+}
+
+void UProjectileSimulationSubsystem::ResetShooterTarget(int32 Slot)
+{
+	AUnitBase* ShootingUnit = Shooters[Slot].Get();
+	if (!ShootingUnit || !Targets[Slot].IsValid())
+	{
+		return;
+	}
+
+	if (!Targets[Slot]->IsUnitDetectable())
+	{
+		ShootingUnit->ResetTarget();
+		ShootingUnit->UnitToChase = nullptr;
+	}
+}
+
+void UProjectileSimulationSubsystem::AcquireVisuals(int32 Slot)
+{
+	if (GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+
+	if (Config.ISM)
+	{
+		if (Config.FreeInstances.Num() > 0)
+		{
+			InstanceIndices[Slot] = Config.FreeInstances.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			InstanceIndices[Slot] = Config.ISM->AddInstance(Transforms[Slot], /*bWorldSpace=*/true);
+		}
+	}
+
+	auto AcquireNiagara = [this, &Config](UNiagaraSystem* Asset, TArray<TObjectPtr<UNiagaraComponent>>& FreeList) -> UNiagaraComponent*
+	{
+		if (!Asset)
+		{
+			return nullptr;
+		}
+		UNiagaraComponent* Component = FreeList.Num() > 0 ? FreeList.Pop(EAllowShrinking::No).Get() : nullptr;
+		if (!Component)
+		{
+			AActor* Host = GetOrCreateVisualHost();
+			Component = NewObject<UNiagaraComponent>(Host);
+			Component->SetAutoActivate(false);
+			Component->SetAsset(Asset);
+			Component->SetupAttachment(Host->GetRootComponent());
+			Component->RegisterComponent();
+		}
+		Component->SetUsingAbsoluteLocation(true);
+		Component->SetUsingAbsoluteRotation(true);
+		Component->SetUsingAbsoluteScale(true);
+		return Component;
+	};
+
+	const bool bVisible = VisibleFlags[Slot] != 0;
+	if (UNiagaraComponent* NiagaraA = AcquireNiagara(Config.NiagaraA, Config.FreeNiagaraA))
+	{
+		NiagaraA->SetWorldTransform(MakeNiagaraWorldTransform(Transforms[Slot], Config.NiagaraAStart), false, nullptr, ETeleportType::ResetPhysics);
+		NiagaraA->SetVisibility(bVisible);
+		NiagaraA->Activate(true);
+		NiagaraAComponents[Slot] = NiagaraA;
+	}
+	if (UNiagaraComponent* NiagaraB = AcquireNiagara(Config.NiagaraB, Config.FreeNiagaraB))
+	{
+		NiagaraB->SetWorldTransform(MakeNiagaraWorldTransform(Transforms[Slot], Config.NiagaraBStart), false, nullptr, ETeleportType::ResetPhysics);
+		NiagaraB->SetVisibility(bVisible);
+		NiagaraB->Activate(true);
+		NiagaraBComponents[Slot] = NiagaraB;
+	}
+}
+
+void UProjectileSimulationSubsystem::ReleaseVisuals(int32 Slot)
+{
+	FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+
+	if (Config.ISM && InstanceIndices[Slot] != INDEX_NONE)
+	{
+		// Hide by zero scale and keep the instance for the next shot; avoids ISM index shuffling
+		FTransform Hidden = Transforms[Slot];
+		Hidden.SetScale3D(FVector::ZeroVector);
+		Config.ISM->UpdateInstanceTransform(InstanceIndices[Slot], Hidden, /*bWorldSpace=*/true, /*bMarkRenderStateDirty=*/false, /*bTeleport=*/true);
+		Config.FreeInstances.Add(InstanceIndices[Slot]);
+		Config.bInstancesDirty = true;
+		InstanceIndices[Slot] = INDEX_NONE;
+	}
+
+	if (UNiagaraComponent* NiagaraA = NiagaraAComponents[Slot].Get())
+	{
+		NiagaraA->DeactivateImmediate();
+		Config.FreeNiagaraA.Add(NiagaraA);
+	}
+	if (UNiagaraComponent* NiagaraB = NiagaraBComponents[Slot].Get())
+	{
+		NiagaraB->DeactivateImmediate();
+		Config.FreeNiagaraB.Add(NiagaraB);
+	}
+	NiagaraAComponents[Slot].Reset();
+	NiagaraBComponents[Slot].Reset();
+}
+
+void UProjectileSimulationSubsystem::UpdateVisuals(int32 Slot)
+{
+	FProjectileClassConfig& Config = ClassConfigs[ClassIndices[Slot]];
+
+	if (Config.ISM && InstanceIndices[Slot] != INDEX_NONE)
+	{
+		FTransform InstanceTransform = Transforms[Slot];
+		if (!VisibleFlags[Slot])
+		{
+			InstanceTransform.SetScale3D(FVector::ZeroVector);
+		}
+		Config.ISM->UpdateInstanceTransform(InstanceIndices[Slot], InstanceTransform, /*bWorldSpace=*/true, /*bMarkRenderStateDirty=*/false, /*bTeleport=*/true);
+		Config.bInstancesDirty = true;
+	}
+
+	if (UNiagaraComponent* NiagaraA = NiagaraAComponents[Slot].Get())
+	{
+		NiagaraA->SetWorldTransform(MakeNiagaraWorldTransform(Transforms[Slot], Config.NiagaraAStart), false, nullptr, ETeleportType::TeleportPhysics);
+	}
+	if (UNiagaraComponent* NiagaraB = NiagaraBComponents[Slot].Get())
+	{
+		NiagaraB->SetWorldTransform(MakeNiagaraWorldTransform(Transforms[Slot], Config.NiagaraBStart), false, nullptr, ETeleportType::TeleportPhysics);
+	}
+}
+
+void UProjectileSimulationSubsystem::FlushInstanceUpdates()
+{
+	// One render state update per class and frame instead of one per projectile
+	for (FProjectileClassConfig& Config : ClassConfigs)
+	{
+		if (Config.bInstancesDirty && Config.ISM)
+		{
+			Config.ISM->MarkRenderStateDirty();
+		}
+		Config.bInstancesDirty = false;
+	}
+}
+
+void UProjectileSimulationSubsystem::RemoveSlot(int32 Slot)
+{
+	ReleaseVisuals(Slot);
+	SlotById.Remove(Ids[Slot]);
+
+	const int32 LastSlot = Ids.Num() - 1;
+	if (Slot != LastSlot)
+	{
+		SlotById.Add(Ids[LastSlot], Slot);
+	}
+
+	Ids.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	ClassIndices.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Shooters.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Targets.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	TeamIds.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Transforms.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	FlightDirections.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	TargetLocations.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	ArcStartLocations.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Speeds.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Damages.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	LifeTimes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	ArcTravelTimes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	OverlapTimers.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	DestroyTimers.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	PiercedCounts.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	PiercedUnits.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	InstanceIndices.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	NiagaraAComponents.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	NiagaraBComponents.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	AuthorityFlags.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BouncedBackFlags.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	VisibleFlags.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+}
@@ -37,6 +37,14 @@ void URTSWorldCacheSubsystem::ClearAll()
 	BindingByOwnerName.Reset();
 	BindingByUnitIndex.Reset();
 	LastBindingRebuildTime = -1000.0;
+	UnitArchetypes.Reset();
+}
+
+void URTSWorldCacheSubsystem::AddUnitArchetype(const FMassUnitArchetypeKey& Key, const FMassArchetypeHandle& Archetype, const FMassArchetypeSharedFragmentValues& SharedValues)
+{
+	FMassUnitArchetypeEntry& Entry = UnitArchetypes.FindOrAdd(Key);
+	Entry.Archetype = Archetype;
+	Entry.SharedValues = SharedValues;
 }
 
 AUnitRegistryReplicator* URTSWorldCacheSubsystem::GetRegistry(bool bAllowSpawnOnServer)
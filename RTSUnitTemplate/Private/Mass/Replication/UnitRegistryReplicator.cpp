@@ -73,6 +73,29 @@ void AUnitRegistryReplicator::ResetNetIDCounter()
 	QuarantinedNetIDs.Empty();
 }
 
+void AUnitRegistryReplicator::RequestRegistryNetUpdate()
+{
+	if (bRegistryNetUpdatePending)
+	{
+		return;
+	}
+	UWorld* W = GetWorld();
+	if (!W)
+	{
+		FlushRegistryNetUpdate();
+		return;
+	}
+	bRegistryNetUpdatePending = true;
+	W->GetTimerManager().SetTimerForNextTick(this, &AUnitRegistryReplicator::FlushRegistryNetUpdate);
+}
+
+void AUnitRegistryReplicator::FlushRegistryNetUpdate()
+{
+	bRegistryNetUpdatePending = false;
+	Registry.MarkArrayDirty();
+	ForceNetUpdate();
+}
+
 uint32 AUnitRegistryReplicator::GetNextNetID()
 {
 	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
@@ -3,6 +3,97 @@
 
 #include "Mass/Signals/MassUnitSpawnerSubsystem.h"
 #include "Characters/Unit/UnitBase.h"
+#include "MassEntitySubsystem.h"
+#include "MassEntityManager.h"
+#include "MassExecutionContext.h"
+#include "MassEntityUtils.h"
+#include "MassCommonFragments.h"
+#include "MassMovementFragments.h"
+#include "MassNavigationFragments.h"
+#include "MassRepresentationFragments.h"
+#include "MassActorSubsystem.h"
+#include "Avoidance/MassAvoidanceFragments.h"
+#include "Mass/MassActorBindingComponent.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_Spawn_ValidateBatchFill(
+	TEXT("net.RTS.Spawn.ValidateBatchFill"),
+	0,
+	TEXT("Debug: after the chunk fill in CreateEntitiesBatched, re-run the per-entity fill into scratch fragments and log every fragment that differs."),
+	ECVF_Default);
+
+namespace
+{
+	template<typename FragmentType>
+	void CompareBatchFilledFragment(const FragmentType& Expected, const FragmentType* Actual, const AActor* Owner)
+	{
+		if (!Actual || !FragmentType::StaticStruct()->CompareScriptStruct(&Expected, Actual, PPF_None))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Spawn] Batch fill mismatch in %s for %s"),
+				*FragmentType::StaticStruct()->GetName(), *GetNameSafe(Owner));
+		}
+	}
+
+	// Compares the chunk-filled fragments against what the per-entity path (LinkOwnerToNewMassEntity) writes
+	void ValidateBatchFill(FMassEntityManager& EM, UMassActorBindingComponent* Binding, FMassEntityHandle Entity)
+	{
+		AActor* Owner = Binding->GetOwner();
+
+		FTransformFragment Transform;
+		FMassVelocityFragment Velocity;
+		FMassMoveTargetFragment MoveTarget;
+		FMassCombatStatsFragment CombatStats;
+		FMassAgentCharacteristicsFragment Characteristics;
+		FMassAIStateFragment AIState;
+		FMassPatrolFragment Patrol;
+		FAgentRadiusFragment AgentRadius;
+		FMassAvoidanceColliderFragment AvoidanceCollider;
+		FMassAITargetFragment AITarget;
+
+		FMassNewEntityFragments Expected;
+		Expected.Transform = &Transform;
+		Expected.Velocity = &Velocity;
+		Expected.MoveTarget = &MoveTarget;
+		Expected.CombatStats = &CombatStats;
+		Expected.Characteristics = &Characteristics;
+		Expected.AIState = &AIState;
+		Expected.Patrol = &Patrol;
+		Expected.AgentRadius = &AgentRadius;
+		Expected.AvoidanceCollider = &AvoidanceCollider;
+		Expected.AITarget = &AITarget;
+		Binding->InitTransform(Expected);
+		Binding->InitMovementFragments(Expected);
+		Binding->InitializeMassEntityStatsFromOwner(Expected, Owner);
+
+		const FMassNewEntityFragments Actual = FMassNewEntityFragments::FromEntity(EM, Entity);
+		CompareBatchFilledFragment(Transform, Actual.Transform, Owner);
+		CompareBatchFilledFragment(Velocity, Actual.Velocity, Owner);
+		CompareBatchFilledFragment(MoveTarget, Actual.MoveTarget, Owner);
+		CompareBatchFilledFragment(CombatStats, Actual.CombatStats, Owner);
+		CompareBatchFilledFragment(Characteristics, Actual.Characteristics, Owner);
+		CompareBatchFilledFragment(AIState, Actual.AIState, Owner);
+		CompareBatchFilledFragment(Patrol, Actual.Patrol, Owner);
+		CompareBatchFilledFragment(AgentRadius, Actual.AgentRadius, Owner);
+		CompareBatchFilledFragment(AvoidanceCollider, Actual.AvoidanceCollider, Owner);
+		CompareBatchFilledFragment(AITarget, Actual.AITarget, Owner);
+
+		if (!Actual.Actor || Actual.Actor->Get() != Owner)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Spawn] Batch fill mismatch in FMassActorFragment for %s"), *GetNameSafe(Owner));
+		}
+		if (!Actual.RepresentationLOD || Actual.RepresentationLOD->LOD != EMassLOD::High || Actual.RepresentationLOD->PrevLOD != EMassLOD::Max)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[Spawn] Batch fill mismatch in FMassRepresentationLODFragment for %s"), *GetNameSafe(Owner));
+		}
+	}
+
+	struct FPendingCreationGroup
+	{
+		FMassArchetypeHandle Archetype;
+		FMassArchetypeSharedFragmentValues SharedValues;
+		bool bBuilding = false;
+		TArray<UMassActorBindingComponent*, TInlineAllocator<32>> Bindings;
+	};
+}
 
 void UMassUnitSpawnerSubsystem::RegisterUnitForMassCreation(AUnitBase* NewUnit)
 {
@@ -16,4 +107,186 @@ void UMassUnitSpawnerSubsystem::GetAndClearPendingUnits(TArray<AUnitBase*>& OutP
 		if(UnitPtr.Get()) { OutPendingUnits.Add(UnitPtr.Get()); }
 	}
 	PendingUnits.Empty();
-}
\ No newline at end of file
+}
+
+int32 UMassUnitSpawnerSubsystem::CreateEntitiesBatched(TArray<TObjectPtr<AUnitBase>>& InOutUnits, int32 MaxToCreate)
+{
+	UMassEntitySubsystem* EntitySubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMassEntitySubsystem>() : nullptr;
+	if (!EntitySubsystem || InOutUnits.IsEmpty())
+	{
+		return 0;
+	}
+	FMassEntityManager& EM = EntitySubsystem->GetMutableEntityManager();
+
+	const int32 NumToTake = MaxToCreate > 0 ? FMath::Min(MaxToCreate, InOutUnits.Num()) : InOutUnits.Num();
+
+	// Group in queue order so the result does not depend on archetype hashing
+	TArray<FPendingCreationGroup, TInlineAllocator<8>> Groups;
+	for (int32 i = 0; i < NumToTake; ++i)
+	{
+		AUnitBase* Unit = InOutUnits[i].Get();
+		UMassActorBindingComponent* Binding = IsValid(Unit) ? Unit->MassActorBindingComponent : nullptr;
+		if (!Binding)
+		{
+			continue;
+		}
+
+		FMassArchetypeHandle Archetype;
+		FMassArchetypeSharedFragmentValues SharedValues;
+		if (!Binding->PrepareBatchedEntityCreation(Archetype, SharedValues))
+		{
+			continue;
+		}
+
+		const bool bBuilding = !Binding->bNeedsMassUnitSetup && Binding->bNeedsMassBuildingSetup;
+		FPendingCreationGroup* Group = Groups.FindByPredicate([&](const FPendingCreationGroup& G)
+		{
+			return G.bBuilding == bBuilding && G.Archetype == Archetype && G.SharedValues.IsEquivalent(SharedValues);
+		});
+		if (!Group)
+		{
+			Group = &Groups.AddDefaulted_GetRef();
+			Group->Archetype = Archetype;
+			Group->SharedValues = SharedValues;
+			Group->bBuilding = bBuilding;
+		}
+		Group->Bindings.Add(Binding);
+	}
+
+	int32 Created = 0;
+	TArray<FMassEntityHandle> Entities;
+	TArray<FMassEntityHandle> LinkedEntities;
+	TMap<FMassEntityHandle, UMassActorBindingComponent*> BindingByEntity;
+	for (FPendingCreationGroup& Group : Groups)
+	{
+		Entities.Reset();
+		// The creation context is released right away, so observers run before linking, same as CreateEntity
+		EM.BatchCreateEntities(Group.Archetype, Group.SharedValues, Group.Bindings.Num(), Entities);
+
+		if (Group.bBuilding)
+		{
+			for (int32 i = 0; i < Entities.Num() && i < Group.Bindings.Num(); ++i)
+			{
+				if (Entities[i].IsValid())
+				{
+					Group.Bindings[i]->LinkBuildingToNewMassEntity(EM, Entities[i]);
+					++Created;
+				}
+			}
+			continue;
+		}
+
+		// Units: LinkOwnerToNewMassEntity with the fragment fill done per chunk instead of per entity lookups
+		LinkedEntities.Reset();
+		BindingByEntity.Reset();
+		for (int32 i = 0; i < Entities.Num() && i < Group.Bindings.Num(); ++i)
+		{
+			if (Entities[i].IsValid())
+			{
+				Group.Bindings[i]->BeginLinkOwnerToNewMassEntity(EM, Entities[i]);
+				LinkedEntities.Add(Entities[i]);
+				BindingByEntity.Add(Entities[i], Group.Bindings[i]);
+			}
+		}
+
+		// Same order as the per-entity path: transform and movement first, GAS setup, then the fragments read from GAS
+		ForEachNewUnitInChunks(EM, LinkedEntities, [&BindingByEntity](FMassEntityHandle Entity, const FMassNewEntityFragments& Fragments)
+		{
+			UMassActorBindingComponent* Binding = BindingByEntity.FindChecked(Entity);
+			Binding->InitTransform(Fragments);
+			Binding->InitMovementFragments(Fragments);
+		});
+		for (const FMassEntityHandle& Entity : LinkedEntities)
+		{
+			UMassActorBindingComponent* Binding = BindingByEntity.FindChecked(Entity);
+			Binding->InitOwnerAbilitySystem(Binding->GetOwner());
+		}
+		ForEachNewUnitInChunks(EM, LinkedEntities, [&BindingByEntity](FMassEntityHandle Entity, const FMassNewEntityFragments& Fragments)
+		{
+			UMassActorBindingComponent* Binding = BindingByEntity.FindChecked(Entity);
+			Binding->InitializeMassEntityStatsFromOwner(Fragments, Binding->GetOwner());
+			Binding->InitRepresentation(Fragments, Entity);
+		});
+
+		const bool bValidate = CVarRTS_Spawn_ValidateBatchFill.GetValueOnGameThread() != 0;
+		for (const FMassEntityHandle& Entity : LinkedEntities)
+		{
+			UMassActorBindingComponent* Binding = BindingByEntity.FindChecked(Entity);
+			if (bValidate)
+			{
+				ValidateBatchFill(EM, Binding, Entity);
+			}
+			Binding->FinishLinkOwnerToNewMassEntity(EM, Entity);
+			++Created;
+		}
+	}
+
+	InOutUnits.RemoveAt(0, NumToTake, EAllowShrinking::No);
+	return Created;
+}
+
+void UMassUnitSpawnerSubsystem::ForEachNewUnitInChunks(FMassEntityManager& EM, TConstArrayView<FMassEntityHandle> Entities,
+	TFunctionRef<void(FMassEntityHandle, const FMassNewEntityFragments&)> Fill)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_MassUnitSpawner_ChunkFill);
+
+	if (!bNewUnitQueryInitialized)
+	{
+		NewUnitQuery.Initialize(EM.AsShared());
+		NewUnitQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassVelocityFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassMoveTargetFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassCombatStatsFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassAIStateFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassPatrolFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FAgentRadiusFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassAvoidanceColliderFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassAITargetFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassActorFragment>(EMassFragmentAccess::ReadWrite);
+		NewUnitQuery.AddRequirement<FMassRepresentationLODFragment>(EMassFragmentAccess::ReadWrite);
+		bNewUnitQueryInitialized = true;
+	}
+
+	// Collections are rebuilt per call: the startup freeze or the GAS setup may have moved entities to another archetype
+	TArray<FMassArchetypeEntityCollection> Collections;
+	UE::Mass::Utils::CreateEntityCollections(EM, Entities, FMassArchetypeEntityCollection::NoDuplicates, Collections);
+
+	FMassExecutionContext ExecutionContext(EM);
+	for (const FMassArchetypeEntityCollection& Collection : Collections)
+	{
+		NewUnitQuery.ForEachEntityChunkInCollection(Collection, ExecutionContext, [&Fill](FMassExecutionContext& ChunkContext)
+		{
+			const TArrayView<FTransformFragment> TransformList = ChunkContext.GetMutableFragmentView<FTransformFragment>();
+			const TArrayView<FMassVelocityFragment> VelocityList = ChunkContext.GetMutableFragmentView<FMassVelocityFragment>();
+			const TArrayView<FMassMoveTargetFragment> MoveTargetList = ChunkContext.GetMutableFragmentView<FMassMoveTargetFragment>();
+			const TArrayView<FMassCombatStatsFragment> CombatStatsList = ChunkContext.GetMutableFragmentView<FMassCombatStatsFragment>();
+			const TArrayView<FMassAgentCharacteristicsFragment> CharacteristicsList = ChunkContext.GetMutableFragmentView<FMassAgentCharacteristicsFragment>();
+			const TArrayView<FMassAIStateFragment> AIStateList = ChunkContext.GetMutableFragmentView<FMassAIStateFragment>();
+			const TArrayView<FMassPatrolFragment> PatrolList = ChunkContext.GetMutableFragmentView<FMassPatrolFragment>();
+			const TArrayView<FAgentRadiusFragment> AgentRadiusList = ChunkContext.GetMutableFragmentView<FAgentRadiusFragment>();
+			const TArrayView<FMassAvoidanceColliderFragment> AvoidanceList = ChunkContext.GetMutableFragmentView<FMassAvoidanceColliderFragment>();
+			const TArrayView<FMassAITargetFragment> AITargetList = ChunkContext.GetMutableFragmentView<FMassAITargetFragment>();
+			const TArrayView<FMassActorFragment> ActorList = ChunkContext.GetMutableFragmentView<FMassActorFragment>();
+			const TArrayView<FMassRepresentationLODFragment> LODList = ChunkContext.GetMutableFragmentView<FMassRepresentationLODFragment>();
+
+			for (int32 i = 0; i < ChunkContext.GetNumEntities(); ++i)
+			{
+				FMassNewEntityFragments Fragments;
+				Fragments.Transform = &TransformList[i];
+				Fragments.Velocity = &VelocityList[i];
+				Fragments.MoveTarget = &MoveTargetList[i];
+				Fragments.CombatStats = &CombatStatsList[i];
+				Fragments.Characteristics = &CharacteristicsList[i];
+				Fragments.AIState = &AIStateList[i];
+				Fragments.Patrol = &PatrolList[i];
+				Fragments.AgentRadius = &AgentRadiusList[i];
+				Fragments.AvoidanceCollider = &AvoidanceList[i];
+				Fragments.AITarget = &AITargetList[i];
+				Fragments.Actor = &ActorList[i];
+				Fragments.RepresentationLOD = &LODList[i];
+				Fill(ChunkContext.GetEntity(i), Fragments);
+			}
+		});
+	}
+}
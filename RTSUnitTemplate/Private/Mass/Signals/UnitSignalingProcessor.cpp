@@ -45,6 +45,11 @@ static TAutoConsoleVariable<float> CVarRTS_UnitSignaling_CreationStartDelay(
     3.0f,
     TEXT("Seconds to wait after world start before creating/linking Mass entities. If on server, also respects GameMode's GatherControllerTimer."),
     ECVF_Default);
+static TAutoConsoleVariable<int32> CVarRTS_UnitSignaling_MaxCreatesPerFrame(
+    TEXT("net.RTS.UnitSignaling.MaxCreatesPerFrame"),
+    256,
+    TEXT("Max Mass entities created per frame from the pending unit queue (<= 0 = unlimited). Larger waves spill over to following frames in spawn order."),
+    ECVF_Default);
 static TAutoConsoleVariable<float> CVarRTS_UnitSignaling_RegistryWaitTimeout(
     TEXT("net.RTS.UnitSignaling.RegistryWaitTimeout"),
     3.0f,
@@ -270,31 +275,9 @@ void UUnitSignalingProcessor::CreatePendingEntities(const float DeltaTime)
     }
 	
     // It is now SAFE to call synchronous creation functions.
-    for (AUnitBase* Unit : ActorsToCreateThisFrame)
+    // Units are created in archetype batches; anything over the per-frame cap stays queued for the next phase.
+    if (SpawnerSubsystem)
     {
-        if (IsValid(Unit))
-        {
-            UMassActorBindingComponent* BindingComp = Unit->MassActorBindingComponent;
-
-            if (BindingComp)
-            {
-                //BindingComp->CreateAndLinkOwnerToMassEntity();
-            }
-
-
-           if (BindingComp && BindingComp->bNeedsMassUnitSetup) // !BindingComp->GetEntityHandle().IsValid())
-           {
-                // We call your original, working function from the binding component.
-              BindingComp->CreateAndLinkOwnerToMassEntity();
-           }else if (BindingComp && BindingComp->bNeedsMassBuildingSetup) // !BindingComp->GetEntityHandle().IsValid())
-           {
-                // We call your original, working function from the binding component.
-              BindingComp->CreateAndLinkBuildingToMassEntity();
-           }
-            
-        }
+        SpawnerSubsystem->CreateEntitiesBatched(ActorsToCreateThisFrame, CVarRTS_UnitSignaling_MaxCreatesPerFrame.GetValueOnGameThread());
     }
-
-    // Clear the queue for the next frame.
-    ActorsToCreateThisFrame.Empty();
 }
@@ -48,6 +48,39 @@
 #include "Characters/Unit/BuildingBase.h"
 #include "Components/CapsuleComponent.h"
 #include "Actors/Waypoint.h"
+#include "System/UnitAttributeSyncSubsystem.h"
+
+DECLARE_STATS_GROUP(TEXT("RTS Unit Signals"), STATGROUP_RTSUnitSignals, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Game Thread Tasks"), STAT_RTSUnitSignals_GameThreadTasks, STATGROUP_RTSUnitSignals);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Signal Batches"), STAT_RTSUnitSignals_Batches, STATGROUP_RTSUnitSignals);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Entities"), STAT_RTSUnitSignals_BatchedEntities, STATGROUP_RTSUnitSignals);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Duplicate Entities Dropped"), STAT_RTSUnitSignals_DuplicatesDropped, STATGROUP_RTSUnitSignals);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Events"), STAT_RTSUnitSignals_DamageEvents, STATGROUP_RTSUnitSignals);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Targets"), STAT_RTSUnitSignals_DamageTargets, STATGROUP_RTSUnitSignals);
+
+static TAutoConsoleVariable<int32> CVarRTS_Signals_BatchHandlers(
+	TEXT("net.RTS.Signals.BatchHandlers"),
+	1,
+	TEXT("1 = UUnitStateProcessor signal handlers queue their entities into per-signal batches that are flushed by one game thread task per frame, 0 = one game thread task per signal delivery."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_Signals_ValidateStateOrder(
+	TEXT("net.RTS.Signals.ValidateStateOrder"),
+	0,
+	TEXT("When 1, every state change delivery is logged and each flush checks the queued state changes against that unbatched per-delivery sequence: per entity every delivered signal must run, in delivery order, ending with the last delivered one. Mismatches are logged."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_States_LogTransitions(
+	TEXT("net.RTS.States.LogTransitions"),
+	0,
+	TEXT("When 1, every state change applied by SwitchState is logged as frame, entity, from and to state. Run once with net.RTS.States.Fused 0 and once with 1 and diff the logs (sorted per frame) to compare both paths."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_Combat_BatchDamage(
+	TEXT("net.RTS.Combat.BatchDamage"),
+	1,
+	TEXT("1 = melee hits of a frame are resolved together, grouped by target, with one health/shield update per target, 0 = every hit is resolved on its own."),
+	ECVF_Default);
 
 namespace
 {
@@ -460,6 +493,268 @@ void UUnitStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecut
 
 }
 
+/*
+ * Ordering of batched signal handlers:
+ * - Batches run in the order their signal (and handler) was first delivered since the last flush.
+ * - Inside a batch every entity is handled once, in the order of first delivery.
+ * - State change signals (ChangeUnitState) do not batch per signal. They share one queue in delivery order
+ *   and an entity keeps only its last state change, so Idle, Chase, Idle for one entity ends in Idle.
+ *   The queue runs at the position of its first delivery among the batches.
+ * - Signals delivered while the flush runs go into the next flush.
+ * - Melee damage events queued by UnitMeeleAttack are resolved before the first batch.
+ * With net.RTS.Signals.BatchHandlers=0 every delivery is its own game thread task, as before.
+ */
+void UUnitStateProcessor::QueueSignalBatch(FName SignalName, const TArray<FMassEntityHandle>& Entities, FSignalBatchHandler Handler)
+{
+	if (bIsShuttingDown || Entities.Num() == 0)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UUnitStateProcessor> WeakThis(this);
+
+	if (CVarRTS_Signals_BatchHandlers.GetValueOnAnyThread() <= 0)
+	{
+		INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, SignalName, Handler, EntitiesCopy = Entities]() mutable
+			{
+				UUnitStateProcessor* StrongThis = WeakThis.Get();
+				if (StrongThis && !StrongThis->bIsShuttingDown)
+				{
+					(StrongThis->*Handler)(SignalName, EntitiesCopy);
+				}
+			});
+		return;
+	}
+
+	bool bScheduleFlush = false;
+	{
+		FScopeLock Lock(&PendingSignalBatchesCS);
+
+		FPendingSignalBatch* Batch = PendingSignalBatches.FindByPredicate([SignalName, Handler](const FPendingSignalBatch& Pending)
+			{
+				return Pending.SignalName == SignalName && Pending.Handler == Handler;
+			});
+
+		if (!Batch)
+		{
+			Batch = &PendingSignalBatches.AddDefaulted_GetRef();
+			Batch->SignalName = SignalName;
+			Batch->Handler = Handler;
+		}
+
+		for (const FMassEntityHandle& Entity : Entities)
+		{
+			bool bAlreadyQueued = false;
+			Batch->QueuedEntities.Add(Entity, &bAlreadyQueued);
+			if (bAlreadyQueued)
+			{
+				INC_DWORD_STAT(STAT_RTSUnitSignals_DuplicatesDropped);
+				continue;
+			}
+			Batch->Entities.Add(Entity);
+		}
+
+		bScheduleFlush = !bSignalBatchFlushScheduled;
+		bSignalBatchFlushScheduled = true;
+	}
+
+	if (bScheduleFlush)
+	{
+		ScheduleSignalFlush();
+	}
+}
+
+void UUnitStateProcessor::QueueStateChanges(FName SignalName, const TArray<FMassEntityHandle>& Entities)
+{
+	if (bIsShuttingDown || Entities.Num() == 0)
+	{
+		return;
+	}
+
+	if (CVarRTS_Signals_BatchHandlers.GetValueOnAnyThread() <= 0)
+	{
+		QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::ChangeUnitState_GameThread);
+		return;
+	}
+
+	const bool bValidate = CVarRTS_Signals_ValidateStateOrder.GetValueOnAnyThread() > 0;
+
+	bool bScheduleFlush = false;
+	{
+		FScopeLock Lock(&PendingSignalBatchesCS);
+
+		if (PendingStateChanges.Num() == 0)
+		{
+			// Placeholder batch, keeps the position of the state change queue among the other batches
+			PendingSignalBatches.AddDefaulted();
+		}
+
+		for (const FMassEntityHandle& Entity : Entities)
+		{
+			if (bValidate)
+			{
+				StateChangeDeliveryLog.Add({ Entity, SignalName });
+			}
+
+			// A, A runs once; A, B, A still runs all three so every transition and the final state match unbatched delivery
+			FName& LastSignal = PendingLastStateChange.FindOrAdd(Entity);
+			if (LastSignal == SignalName)
+			{
+				INC_DWORD_STAT(STAT_RTSUnitSignals_DuplicatesDropped);
+				continue;
+			}
+			LastSignal = SignalName;
+			PendingStateChanges.Add({ Entity, SignalName });
+		}
+
+		bScheduleFlush = !bSignalBatchFlushScheduled;
+		bSignalBatchFlushScheduled = true;
+	}
+
+	if (bScheduleFlush)
+	{
+		ScheduleSignalFlush();
+	}
+}
+
+void UUnitStateProcessor::ScheduleSignalFlush()
+{
+	INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
+	TWeakObjectPtr<UUnitStateProcessor> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+		{
+			if (UUnitStateProcessor* StrongThis = WeakThis.Get())
+			{
+				StrongThis->FlushSignalBatches();
+			}
+		});
+}
+
+void UUnitStateProcessor::FlushSignalBatches()
+{
+	check(IsInGameThread());
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitStateProcessor_FlushSignalBatches);
+
+	TArray<FPendingSignalBatch> Batches;
+	TArray<FPendingStateChange> StateChanges;
+	TArray<FPendingStateChange> DeliveryLog;
+	TArray<FPendingDamageEvent> DamageEvents;
+	{
+		FScopeLock Lock(&PendingSignalBatchesCS);
+		Batches = MoveTemp(PendingSignalBatches);
+		PendingSignalBatches.Reset();
+		StateChanges = MoveTemp(PendingStateChanges);
+		PendingStateChanges.Reset();
+		PendingLastStateChange.Reset();
+		DeliveryLog = MoveTemp(StateChangeDeliveryLog);
+		StateChangeDeliveryLog.Reset();
+		DamageEvents = MoveTemp(PendingDamageEvents);
+		PendingDamageEvents.Reset();
+		bSignalBatchFlushScheduled = false;
+	}
+
+	if (bIsShuttingDown || !EntitySubsystem)
+	{
+		return;
+	}
+
+	// Damage first, so state changes of this flush already see the new health
+	ResolveDamageEvents(DamageEvents);
+
+	for (FPendingSignalBatch& Batch : Batches)
+	{
+		if (!Batch.Handler)
+		{
+			RunStateChanges(StateChanges, DeliveryLog);
+			continue;
+		}
+
+		INC_DWORD_STAT(STAT_RTSUnitSignals_Batches);
+		INC_DWORD_STAT_BY(STAT_RTSUnitSignals_BatchedEntities, Batch.Entities.Num());
+
+		(this->*Batch.Handler)(Batch.SignalName, Batch.Entities);
+	}
+}
+
+void UUnitStateProcessor::RunStateChanges(const TArray<FPendingStateChange>& StateChanges, const TArray<FPendingStateChange>& DeliveryLog)
+{
+	if (DeliveryLog.Num() > 0)
+	{
+		// Reference is the unbatched sequence: per entity, every delivery in order
+		TMap<FMassEntityHandle, TArray<FName>> Delivered;
+		TMap<FMassEntityHandle, TArray<FName>> Queued;
+		for (const FPendingStateChange& Delivery : DeliveryLog)
+		{
+			Delivered.FindOrAdd(Delivery.Entity).Add(Delivery.SignalName);
+		}
+		for (const FPendingStateChange& StateChange : StateChanges)
+		{
+			Queued.FindOrAdd(StateChange.Entity).Add(StateChange.SignalName);
+		}
+
+		for (const TPair<FMassEntityHandle, TArray<FName>>& Pair : Delivered)
+		{
+			const TArray<FName>& Signals = Pair.Value;
+			const TArray<FName>* QueuedSignals = Queued.Find(Pair.Key);
+			if (!QueuedSignals || QueuedSignals->Last() != Signals.Last())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[UnitSignals] State change mismatch Entity %d: ends in %s, unbatched delivery ends in %s"),
+					Pair.Key.Index, QueuedSignals ? *QueuedSignals->Last().ToString() : TEXT("none"), *Signals.Last().ToString());
+				continue;
+			}
+
+			// Queued must be the deliveries in order, skipping only repeats of the signal run just before
+			int32 QueuedIndex = 0;
+			FName Previous;
+			for (const FName& Signal : Signals)
+			{
+				if (Signal == Previous)
+				{
+					continue;
+				}
+				Previous = Signal;
+				if (!QueuedSignals->IsValidIndex(QueuedIndex) || (*QueuedSignals)[QueuedIndex] != Signal)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[UnitSignals] State change mismatch Entity %d: delivered %s is missing or out of order at %d"),
+						Pair.Key.Index, *Signal.ToString(), QueuedIndex);
+					break;
+				}
+				++QueuedIndex;
+			}
+		}
+		if (Queued.Num() != Delivered.Num())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[UnitSignals] State change entity count mismatch: queued %d, delivered %d"), Queued.Num(), Delivered.Num());
+		}
+	}
+
+	// Consecutive entries with the same signal form one call
+	TArray<FMassEntityHandle> Run;
+	FName RunSignal;
+	auto FlushRun = [this, &Run, &RunSignal]()
+	{
+		if (Run.Num() > 0)
+		{
+			INC_DWORD_STAT(STAT_RTSUnitSignals_Batches);
+			INC_DWORD_STAT_BY(STAT_RTSUnitSignals_BatchedEntities, Run.Num());
+			ChangeUnitState_GameThread(RunSignal, Run);
+			Run.Reset();
+		}
+	};
+
+	for (const FPendingStateChange& StateChange : StateChanges)
+	{
+		if (StateChange.SignalName != RunSignal)
+		{
+			FlushRun();
+			RunSignal = StateChange.SignalName;
+		}
+		Run.Add(StateChange.Entity);
+	}
+	FlushRun();
+}
+
 void UUnitStateProcessor::HandleUpdateFollowMovement(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
 	// Deprecated: Follow movement is now handled directly by state processors via FriendlyTargetEntity.
@@ -500,6 +795,13 @@ void UUnitStateProcessor::SwitchState(FName SignalName, FMassEntityHandle& Entit
 
 			if (UnitBase)
 			{
+				if (CVarRTS_States_LogTransitions.GetValueOnGameThread() > 0)
+				{
+					UE_LOG(LogTemp, Log, TEXT("[StateTransition] Frame %llu Entity %d:%d %s -> %s"),
+						(uint64)GFrameCounter, Entity.Index, Entity.SerialNumber,
+						*UEnum::GetValueAsString(UnitBase->GetUnitState()), *SignalName.ToString());
+				}
+
 				// *** Mass Tag Modifications MUST be inside the Game Thread Task ***
 				// --- Remove old tags ---
 				// Note: Using EntityManager directly here, NOT a separate command buffer object usually.
@@ -823,56 +1125,54 @@ void UUnitStateProcessor::IdlePatrolSwitcher(FName SignalName, TArray<FMassEntit
 		return;
 	}
 
-	// Kopie der Entities für sichere asynchrone Verarbeitung
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::IdlePatrolSwitcher_GameThread);
+}
 
-	// An den Game Thread senden, da NavSys verwendet wird
-	AsyncTask(ENamedThreads::GameThread, [this, EntitiesCopy]() mutable
-		{
-			// --- Dieser Code läuft garantiert im Game Thread ---
+void UUnitStateProcessor::IdlePatrolSwitcher_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	// --- Dieser Code läuft garantiert im Game Thread ---
 
-			if (!EntitySubsystem) { return; }
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager(); // Mutable für Fragment-Zugriff
-			UWorld* World = EntitySubsystem->GetWorld();
-			if (!World) { return; }
+	if (!EntitySubsystem) { return; }
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager(); // Mutable für Fragment-Zugriff
+	UWorld* World = EntitySubsystem->GetWorld();
+	if (!World) { return; }
 
-			// Hole Subsysteme sicher im Game Thread
-			UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(World);
-			if (!NavSys) { return; }
-			UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
-			if (!SignalSubsystem) { return; }
+	// Hole Subsysteme sicher im Game Thread
+	UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(World);
+	if (!NavSys) { return; }
+	UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
+	if (!SignalSubsystem) { return; }
 
-			for (const FMassEntityHandle& Entity : EntitiesCopy)
-			{
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
+	for (const FMassEntityHandle& Entity : Entities)
+	{
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
 
-				// --- Hole benötigte Fragmente für DIESE Entity ---
-				FMassAIStateFragment* StateFragPtr = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
-				FMassPatrolFragment* PatrolFragPtr = EntityManager.GetFragmentDataPtr<FMassPatrolFragment>(Entity);
-				FMassMoveTargetFragment* MoveTargetPtr = EntityManager.GetFragmentDataPtr<FMassMoveTargetFragment>(Entity);
-				const FMassCombatStatsFragment* StatsFragPtr = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Entity);
+		// --- Hole benötigte Fragmente für DIESE Entity ---
+		FMassAIStateFragment* StateFragPtr = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		FMassPatrolFragment* PatrolFragPtr = EntityManager.GetFragmentDataPtr<FMassPatrolFragment>(Entity);
+		FMassMoveTargetFragment* MoveTargetPtr = EntityManager.GetFragmentDataPtr<FMassMoveTargetFragment>(Entity);
+		const FMassCombatStatsFragment* StatsFragPtr = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Entity);
 
-				// Prüfe, ob alle nötigen Fragmente vorhanden sind
-				if (!StateFragPtr || !PatrolFragPtr || !MoveTargetPtr || !StatsFragPtr)
-				{
-					continue;
-				}
+		// Prüfe, ob alle nötigen Fragmente vorhanden sind
+		if (!StateFragPtr || !PatrolFragPtr || !MoveTargetPtr || !StatsFragPtr)
+		{
+			continue;
+		}
 
-				// Dereferenziere Pointer für einfacheren Zugriff
-				FMassAIStateFragment& StateFrag = *StateFragPtr;
-				FMassPatrolFragment& PatrolFrag = *PatrolFragPtr; // Mutable Referenz
-				FMassMoveTargetFragment& MoveTarget = *MoveTargetPtr; // Mutable Referenz
-				const FMassCombatStatsFragment& StatsFrag = *StatsFragPtr;
+		// Dereferenziere Pointer für einfacheren Zugriff
+		FMassAIStateFragment& StateFrag = *StateFragPtr;
+		FMassPatrolFragment& PatrolFrag = *PatrolFragPtr; // Mutable Referenz
+		FMassMoveTargetFragment& MoveTarget = *MoveTargetPtr; // Mutable Referenz
+		const FMassCombatStatsFragment& StatsFrag = *StatsFragPtr;
 
 
-				SetNewRandomPatrolTarget(PatrolFrag, MoveTarget, StateFragPtr, NavSys, World, StatsFrag.RunSpeed);
-				SignalSubsystem->SignalEntity(UnitSignals::PatrolRandom, Entity);
-				StateFrag.StateTimer = 0.f;
-			} // Ende for each entity
-		}); // Ende AsyncTask Lambda
+		SetNewRandomPatrolTarget(PatrolFrag, MoveTarget, StateFragPtr, NavSys, World, StatsFrag.RunSpeed);
+		SignalSubsystem->SignalEntity(UnitSignals::PatrolRandom, Entity);
+		StateFrag.StateTimer = 0.f;
+	} // Ende for each entity
 }
 
 void UUnitStateProcessor::ForceSetPatrolRandomTarget(FMassEntityHandle& Entity)
@@ -886,6 +1186,7 @@ void UUnitStateProcessor::ForceSetPatrolRandomTarget(FMassEntityHandle& Entity)
 
 
 	// An den Game Thread senden, da NavSys verwendet wird
+	INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
 	AsyncTask(ENamedThreads::GameThread, [this, Entity]() mutable
 		{
 			// --- Dieser Code läuft garantiert im Game Thread ---
@@ -949,40 +1250,49 @@ void UUnitStateProcessor::ChangeUnitState(FName SignalName, TArray<FMassEntityHa
 		return;
 	}
 
+	QueueStateChanges(SignalName, Entities);
+}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
-
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			// Re-check EntitySubsystem just in case? Usually fine if 'this' is valid.
-			if (!EntitySubsystem)
-			{
-				// UE_LOG(LogTemp, Error, TEXT("ChangeUnitState (GameThread): EntitySubsystem became null!"));
-				return;
-			}
+void UUnitStateProcessor::ChangeUnitState_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	// Re-check EntitySubsystem just in case? Usually fine if 'this' is valid.
+	if (!EntitySubsystem)
+	{
+		// UE_LOG(LogTemp, Error, TEXT("ChangeUnitState (GameThread): EntitySubsystem became null!"));
+		return;
+	}
 
-			const FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	const FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
-			{
+	for (FMassEntityHandle& Entity : Entities)
+	{
 
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
 
-				SwitchState(SignalName, Entity, EntityManager);
+		SwitchState(SignalName, Entity, EntityManager);
 
-				FMassAIStateFragment* State = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		FMassAIStateFragment* State = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
 
-				if (!DoesEntityHaveTag(EntityManager, Entity, FMassStateDeadTag::StaticStruct()))
-					State->StateTimer = 0.f;
-			} // End For loop
-		}); // End AsyncTask Lambda
+		if (!DoesEntityHaveTag(EntityManager, Entity, FMassStateDeadTag::StaticStruct()))
+			State->StateTimer = 0.f;
+	} // End For loop
 }
 
 void UUnitStateProcessor::SyncUnitBase(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		return;
+	}
+
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::SyncUnitBase_GameThread);
+}
+
+void UUnitStateProcessor::SyncUnitBase_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
 	// Gehe durch alle Entities, die mit dem Signal übergeben wurden
 
@@ -1030,14 +1340,14 @@ FVector FindGroundLocationForActor(const UObject* WorldContextObject, AActor* Ta
 
 void UUnitStateProcessor::SynchronizeStatsFromActorToFragment(FMassEntityHandle Entity)
 {
-	// --- Vorab-Checks außerhalb des AsyncTasks ---
+	// --- Vorab-Checks ---
 	if (!EntitySubsystem)
 	{
 		//UE_LOG(LogTemp, Error, TEXT("SynchronizeStatsFromActorToFragment: EntitySubsystem ist null!"));
 		return;
 	}
 
-	// Const EntityManager für Read-Only Checks vor dem Task
+	// Const EntityManager für Read-Only Checks
 	const FMassEntityManager& EntityManager = EntitySubsystem->GetEntityManager();
 
 	if (!EntityManager.IsEntityValid(Entity))
@@ -1058,168 +1368,156 @@ void UUnitStateProcessor::SynchronizeStatsFromActorToFragment(FMassEntityHandle
 	}
 
 
-	TWeakObjectPtr<AUnitBase> WeakUnitActor(const_cast<AUnitBase*>(UnitActor));
-	FMassEntityHandle CapturedEntity = Entity; // Handle per Wert kopieren
+	// Runs inline on the game thread (signal batch flush or worker movement update), no task per entity
+	AUnitBase* StrongUnitActor = const_cast<AUnitBase*>(UnitActor);
+	const FMassEntityHandle CapturedEntity = Entity;
+	FMassEntityManager& GTEntityManager = EntitySubsystem->GetMutableEntityManager();
+
+	if (StrongUnitActor && GTEntityManager.IsEntityValid(CapturedEntity))
+	{
+		// Das MUTABLE Combat Stats Fragment holen
+		FMassCombatStatsFragment* CombatStatsFrag = GTEntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(CapturedEntity);
+		FMassPatrolFragment* PatrolFrag = GTEntityManager.GetFragmentDataPtr<FMassPatrolFragment>(CapturedEntity);
+		FMassWorkerStatsFragment* WorkerStats = GTEntityManager.GetFragmentDataPtr<FMassWorkerStatsFragment>(CapturedEntity);
+		FMassAIStateFragment* AIStateFragment = GTEntityManager.GetFragmentDataPtr<FMassAIStateFragment>(CapturedEntity);
+		FMassAgentCharacteristicsFragment* CharFragment = GTEntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(CapturedEntity);
+
+		UAttributeSetBase* AttributeSet = StrongUnitActor->Attributes;
 
-	// --- AsyncTask an den GameThread senden ---
-	AsyncTask(ENamedThreads::GameThread, [this, WeakUnitActor, CapturedEntity]() mutable
+		if (StrongUnitActor && CharFragment)
 		{
+			CharFragment->bIsFlying = StrongUnitActor->IsFlying;
+			CharFragment->FlyHeight = StrongUnitActor->FlyHeight;
+			CharFragment->bCanOnlyAttackFlying = StrongUnitActor->CanOnlyAttackFlying;
+			CharFragment->bCanOnlyAttackGround = StrongUnitActor->CanOnlyAttackGround;
+			CharFragment->bCanDetectInvisible = StrongUnitActor->CanDetectInvisible;
+		}
 
-			// --- Code in dieser Lambda läuft jetzt im GameThread ---
-			AUnitBase* StrongUnitActor = WeakUnitActor.Get();
+		if (StrongUnitActor && AIStateFragment && CharFragment)
+		{
+			AIStateFragment->CanMove = StrongUnitActor->CanMove;
+			bool bHasDeadTag = DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateDeadTag::StaticStruct());
 
-			// Subsystem-Validität im GameThread prüfen
-			if (!EntitySubsystem)
+			if (DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateDisableNavManipulationTag::StaticStruct()) || bHasDeadTag)
 			{
-				//UE_LOG(LogTemp, Error, TEXT("SynchronizeStatsFromActorToFragment (GameThread): EntitySubsystem wurde null!"));
-				return;
+				if (StrongUnitActor->HasAuthority() && StrongUnitActor->NavObstacleProxy) StrongUnitActor->Multicast_UnregisterObstacle();
+			}
+			else if (AIStateFragment->CanMove && !bHasDeadTag)
+			{
+				GTEntityManager.Defer().RemoveTag<FMassStateStopMovementTag>(CapturedEntity);
+				if (StrongUnitActor->HasAuthority() && StrongUnitActor->NavObstacleProxy) StrongUnitActor->Multicast_UnregisterObstacle();
+			}
+			else if (!AIStateFragment->CanMove && !bHasDeadTag && CharFragment->CanManipulateNavMesh)
+			{
+				GTEntityManager.Defer().AddTag<FMassStateStopMovementTag>(CapturedEntity);
+				if (StrongUnitActor->HasAuthority() && !StrongUnitActor->NavObstacleProxy) StrongUnitActor->Multicast_RegisterBuildingAsObstacle();
 			}
-			// Mutable EntityManager holen, um Fragment schreiben zu können
-			FMassEntityManager& GTEntityManager = EntitySubsystem->GetMutableEntityManager();
+			AIStateFragment->CanAttack = StrongUnitActor->CanAttack;
+
+			AIStateFragment->IsInitialized = StrongUnitActor->IsInitialized;
+			AIStateFragment->HoldPosition = StrongUnitActor->bHoldPosition;
+		}
 
-			// Actor- und Entity-Validität erneut im GameThread prüfen
-			if (StrongUnitActor && GTEntityManager.IsEntityValid(CapturedEntity))
+		if (CombatStatsFrag && AttributeSet)
+		{
+			// With attribute sync the unit is registered at spawn, load and level-up; values arrive through change events
+			if (!UUnitAttributeSyncSubsystem::IsEnabled())
 			{
-				// Das MUTABLE Combat Stats Fragment holen
-				FMassCombatStatsFragment* CombatStatsFrag = GTEntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(CapturedEntity);
-				FMassPatrolFragment* PatrolFrag = GTEntityManager.GetFragmentDataPtr<FMassPatrolFragment>(CapturedEntity);
-				FMassWorkerStatsFragment* WorkerStats = GTEntityManager.GetFragmentDataPtr<FMassWorkerStatsFragment>(CapturedEntity);
-				FMassAIStateFragment* AIStateFragment = GTEntityManager.GetFragmentDataPtr<FMassAIStateFragment>(CapturedEntity);
-				FMassAgentCharacteristicsFragment* CharFragment = GTEntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(CapturedEntity);
+				CombatStatsFrag->Health = AttributeSet->GetHealth();
+				CombatStatsFrag->Shield = AttributeSet->GetShield();
+				CombatStatsFrag->MaxHealth = AttributeSet->GetMaxHealth();
+				CombatStatsFrag->MaxShield = AttributeSet->GetMaxHealth();
+				CombatStatsFrag->AttackDamage = AttributeSet->GetAttackDamage();
+				CombatStatsFrag->AttackRange = AttributeSet->GetRange();
+				CombatStatsFrag->RunSpeed = AttributeSet->GetRunSpeed();
+				CombatStatsFrag->Armor = AttributeSet->GetArmor();
+				CombatStatsFrag->MagicResistance = AttributeSet->GetMagicResistance();
+			}
 
-				UAttributeSetBase* AttributeSet = StrongUnitActor->Attributes;
+			CombatStatsFrag->PauseDuration = StrongUnitActor->PauseDuration;// We need to add this to Attributes i guess;
+			CombatStatsFrag->AttackDuration = StrongUnitActor->AttackDuration;
+			CombatStatsFrag->bUseProjectile = StrongUnitActor->UseProjectile; // Assuming UsesProjectile() on Attributes
+			CombatStatsFrag->CastTime = StrongUnitActor->CastTime;
+			CombatStatsFrag->IsInitialized = StrongUnitActor->IsInitialized;
 
-				if (StrongUnitActor && CharFragment)
-				{
-					CharFragment->bIsFlying = StrongUnitActor->IsFlying;
-					CharFragment->FlyHeight = StrongUnitActor->FlyHeight;
-					CharFragment->bCanOnlyAttackFlying = StrongUnitActor->CanOnlyAttackFlying;
-					CharFragment->bCanOnlyAttackGround = StrongUnitActor->CanOnlyAttackGround;
-					CharFragment->bCanDetectInvisible = StrongUnitActor->CanDetectInvisible;
-				}
+			if (StrongUnitActor->MassActorBindingComponent)
+			{
+				CombatStatsFrag->SightRadius = StrongUnitActor->MassActorBindingComponent->SightRadius;
+				CombatStatsFrag->LoseSightRadius = StrongUnitActor->MassActorBindingComponent->LoseSightRadius;
+			}
 
-				if (StrongUnitActor && AIStateFragment && CharFragment)
+			if (StrongUnitActor && StrongUnitActor->NextWaypoint) // Use config from Actor if available
+			{
+				if (PatrolFrag->TargetWaypointLocation != StrongUnitActor->NextWaypoint->GetActorLocation())
 				{
-					AIStateFragment->CanMove = StrongUnitActor->CanMove;
-					bool bHasDeadTag = DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateDeadTag::StaticStruct());
+					PatrolFrag->bLoopPatrol = StrongUnitActor->NextWaypoint->PatrolCloseToWaypoint; // Assuming direct property access
+					PatrolFrag->RandomPatrolMinIdleTime = StrongUnitActor->NextWaypoint->PatrolCloseMinInterval;
+					PatrolFrag->RandomPatrolMaxIdleTime = StrongUnitActor->NextWaypoint->PatrolCloseMaxInterval;
+					PatrolFrag->TargetWaypointLocation = StrongUnitActor->NextWaypoint->GetActorLocation();
+					PatrolFrag->RandomPatrolRadius = (StrongUnitActor->NextWaypoint->PatrolCloseOffset.X + StrongUnitActor->NextWaypoint->PatrolCloseOffset.Y) / 2.f;
+					PatrolFrag->IdleChance = StrongUnitActor->NextWaypoint->PatrolCloseIdlePercentage;
+				}
+			}
 
-					if (DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateDisableNavManipulationTag::StaticStruct()) || bHasDeadTag)
-					{
-						if (StrongUnitActor->HasAuthority() && StrongUnitActor->NavObstacleProxy) StrongUnitActor->Multicast_UnregisterObstacle();
-					}
-					else if (AIStateFragment->CanMove && !bHasDeadTag)
-					{
-						GTEntityManager.Defer().RemoveTag<FMassStateStopMovementTag>(CapturedEntity);
-						if (StrongUnitActor->HasAuthority() && StrongUnitActor->NavObstacleProxy) StrongUnitActor->Multicast_UnregisterObstacle();
-					}
-					else if (!AIStateFragment->CanMove && !bHasDeadTag && CharFragment->CanManipulateNavMesh)
-					{
-						GTEntityManager.Defer().AddTag<FMassStateStopMovementTag>(CapturedEntity);
-						if (StrongUnitActor->HasAuthority() && !StrongUnitActor->NavObstacleProxy) StrongUnitActor->Multicast_RegisterBuildingAsObstacle();
-					}
-					AIStateFragment->CanAttack = StrongUnitActor->CanAttack;
+			if (StrongUnitActor && StrongUnitActor->IsWorker) // Use config from Actor if available
+			{
 
-					AIStateFragment->IsInitialized = StrongUnitActor->IsInitialized;
-					AIStateFragment->HoldPosition = StrongUnitActor->bHoldPosition;
+				if (ResourceGameMode && !StrongUnitActor->Base)
+				{
+					StrongUnitActor->Base = ResourceGameMode->GetClosestBaseFromArray(StrongUnitActor, ResourceGameMode->WorkAreaGroups.BaseAreas);
 				}
 
-				if (CombatStatsFrag && AttributeSet)
+				if (StrongUnitActor->Base && StrongUnitActor->Base->GetUnitState() != UnitData::Dead)
+					WorkerStats->BaseAvailable = true;
+				else
+					WorkerStats->BaseAvailable = false;
+
+				if (StrongUnitActor->Base)
 				{
-					CombatStatsFrag->Health = AttributeSet->GetHealth();
-					CombatStatsFrag->Shield = AttributeSet->GetShield();
-					CombatStatsFrag->MaxHealth = AttributeSet->GetMaxHealth();
-					CombatStatsFrag->MaxShield = AttributeSet->GetMaxHealth();
-					CombatStatsFrag->AttackDamage = AttributeSet->GetAttackDamage();
-					CombatStatsFrag->AttackRange = AttributeSet->GetRange();
-					CombatStatsFrag->RunSpeed = AttributeSet->GetRunSpeed();
-					CombatStatsFrag->Armor = AttributeSet->GetArmor();
-					CombatStatsFrag->MagicResistance = AttributeSet->GetMagicResistance();
+					WorkerStats->BasePosition = FindGroundLocationForActor(this, StrongUnitActor->Base, { StrongUnitActor, StrongUnitActor->Base }); //StrongUnitActor->Base->GetActorLocation();
+					FVector Origin, BoxExtent;
 
-					CombatStatsFrag->PauseDuration = StrongUnitActor->PauseDuration;// We need to add this to Attributes i guess;
-					CombatStatsFrag->AttackDuration = StrongUnitActor->AttackDuration;
-					CombatStatsFrag->bUseProjectile = StrongUnitActor->UseProjectile; // Assuming UsesProjectile() on Attributes
-					CombatStatsFrag->CastTime = StrongUnitActor->CastTime;
-					CombatStatsFrag->IsInitialized = StrongUnitActor->IsInitialized;
+					StrongUnitActor->Base->GetActorBounds(true, Origin, BoxExtent);
+					WorkerStats->BaseArrivalDistance = BoxExtent.Size() / 2 + 170.f;
+				}
 
-					if (StrongUnitActor->MassActorBindingComponent)
-					{
-						CombatStatsFrag->SightRadius = StrongUnitActor->MassActorBindingComponent->SightRadius;
-						CombatStatsFrag->LoseSightRadius = StrongUnitActor->MassActorBindingComponent->LoseSightRadius;
-					}
+				WorkerStats->BuildingAreaAvailable = StrongUnitActor->BuildArea ? true : false;
+				if (StrongUnitActor->BuildArea)
+				{
+					WorkerStats->BuildAreaArrivalDistance = StrongUnitActor->BuildArea->GetArriveDistance();
+					WorkerStats->BuildingAvailable = StrongUnitActor->BuildArea->Building ? true : false;
+					WorkerStats->BuildAreaPosition = FindGroundLocationForActor(this, StrongUnitActor->BuildArea, { StrongUnitActor, StrongUnitActor->BuildArea }); // StrongUnitActor->BuildArea->GetActorLocation();
+					WorkerStats->BuildTime = StrongUnitActor->BuildArea->BuildTime;
+				}
 
-					if (StrongUnitActor && StrongUnitActor->NextWaypoint) // Use config from Actor if available
-					{
-						if (PatrolFrag->TargetWaypointLocation != StrongUnitActor->NextWaypoint->GetActorLocation())
-						{
-							PatrolFrag->bLoopPatrol = StrongUnitActor->NextWaypoint->PatrolCloseToWaypoint; // Assuming direct property access
-							PatrolFrag->RandomPatrolMinIdleTime = StrongUnitActor->NextWaypoint->PatrolCloseMinInterval;
-							PatrolFrag->RandomPatrolMaxIdleTime = StrongUnitActor->NextWaypoint->PatrolCloseMaxInterval;
-							PatrolFrag->TargetWaypointLocation = StrongUnitActor->NextWaypoint->GetActorLocation();
-							PatrolFrag->RandomPatrolRadius = (StrongUnitActor->NextWaypoint->PatrolCloseOffset.X + StrongUnitActor->NextWaypoint->PatrolCloseOffset.Y) / 2.f;
-							PatrolFrag->IdleChance = StrongUnitActor->NextWaypoint->PatrolCloseIdlePercentage;
-						}
-					}
+				WorkerStats->ResourceAvailable = StrongUnitActor->ResourcePlace ? true : false;
+				if (StrongUnitActor->ResourcePlace && StrongUnitActor->ResourcePlace->AvailableResourceAmount <= 0.f)
+				{
+					WorkerStats->ResourceAvailable = false;
+				}
 
-					if (StrongUnitActor && StrongUnitActor->IsWorker) // Use config from Actor if available
-					{
+				if (StrongUnitActor->ResourcePlace)
+				{
+					FVector Origin, BoxExtent;
+					StrongUnitActor->ResourcePlace->GetActorBounds(false, Origin, BoxExtent);
+					WorkerStats->ResourceArrivalDistance = BoxExtent.Size() / 2 + 50.f;
+					WorkerStats->ResourcePosition = FindGroundLocationForActor(this, StrongUnitActor->ResourcePlace, { StrongUnitActor, StrongUnitActor->ResourcePlace });
+				}
 
-						if (ResourceGameMode && !StrongUnitActor->Base)
-						{
-							StrongUnitActor->Base = ResourceGameMode->GetClosestBaseFromArray(StrongUnitActor, ResourceGameMode->WorkAreaGroups.BaseAreas);
-						}
+				WorkerStats->ResourceExtractionTime = StrongUnitActor->ResourceExtractionTime;
 
-						if (StrongUnitActor->Base && StrongUnitActor->Base->GetUnitState() != UnitData::Dead)
-							WorkerStats->BaseAvailable = true;
-						else
-							WorkerStats->BaseAvailable = false;
-
-						if (StrongUnitActor->Base)
-						{
-							WorkerStats->BasePosition = FindGroundLocationForActor(this, StrongUnitActor->Base, { StrongUnitActor, StrongUnitActor->Base }); //StrongUnitActor->Base->GetActorLocation();
-							FVector Origin, BoxExtent;
-
-							StrongUnitActor->Base->GetActorBounds(true, Origin, BoxExtent);
-							WorkerStats->BaseArrivalDistance = BoxExtent.Size() / 2 + 170.f;
-						}
-
-						WorkerStats->BuildingAreaAvailable = StrongUnitActor->BuildArea ? true : false;
-						if (StrongUnitActor->BuildArea)
-						{
-							WorkerStats->BuildAreaArrivalDistance = StrongUnitActor->BuildArea->GetArriveDistance();
-							WorkerStats->BuildingAvailable = StrongUnitActor->BuildArea->Building ? true : false;
-							WorkerStats->BuildAreaPosition = FindGroundLocationForActor(this, StrongUnitActor->BuildArea, { StrongUnitActor, StrongUnitActor->BuildArea }); // StrongUnitActor->BuildArea->GetActorLocation();
-							WorkerStats->BuildTime = StrongUnitActor->BuildArea->BuildTime;
-						}
-
-						WorkerStats->ResourceAvailable = StrongUnitActor->ResourcePlace ? true : false;
-						if (StrongUnitActor->ResourcePlace && StrongUnitActor->ResourcePlace->AvailableResourceAmount <= 0.f)
-						{
-							WorkerStats->ResourceAvailable = false;
-						}
-
-						if (StrongUnitActor->ResourcePlace)
-						{
-							FVector Origin, BoxExtent;
-							StrongUnitActor->ResourcePlace->GetActorBounds(false, Origin, BoxExtent);
-							WorkerStats->ResourceArrivalDistance = BoxExtent.Size() / 2 + 50.f;
-							WorkerStats->ResourcePosition = FindGroundLocationForActor(this, StrongUnitActor->ResourcePlace, { StrongUnitActor, StrongUnitActor->ResourcePlace });
-						}
-
-						WorkerStats->ResourceExtractionTime = StrongUnitActor->ResourceExtractionTime;
-
-						if (WorkerStats->BaseAvailable && WorkerStats->ResourceAvailable)
-						{
-							WorkerStats->AutoMining = StrongUnitActor->AutoMining;
-						}
-						else
-						{
-							WorkerStats->AutoMining = false;
-						}
-					}
-				}
-			}
-		});
-}
+				if (WorkerStats->BaseAvailable && WorkerStats->ResourceAvailable)
+				{
+					WorkerStats->AutoMining = StrongUnitActor->AutoMining;
+				}
+				else
+				{
+					WorkerStats->AutoMining = false;
+				}
+			}
+		}
+	}
+}
 
 void UUnitStateProcessor::SynchronizeUnitState(FMassEntityHandle Entity)
 {
@@ -1246,98 +1544,93 @@ void UUnitStateProcessor::SynchronizeUnitState(FMassEntityHandle Entity)
 		return;
 	}
 
-	TWeakObjectPtr<AUnitBase> WeakUnitActor(const_cast<AUnitBase*>(UnitActor));
+	AUnitBase* StrongUnitActor = const_cast<AUnitBase*>(UnitActor);
 	FMassEntityHandle CapturedEntity = Entity;
 
-	AsyncTask(ENamedThreads::GameThread, [this, WeakUnitActor, CapturedEntity, &EntityManager]() mutable
-		{
-			AUnitBase* StrongUnitActor = WeakUnitActor.Get();
-
-			if (!StrongUnitActor) return;
+	if (!StrongUnitActor) return;
 
-			FMassEntityManager& GTEntityManager = EntitySubsystem->GetMutableEntityManager();
-			if (StrongUnitActor->GetUnitState() != UnitData::Idle && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateIdleTag::StaticStruct())) {
-				StrongUnitActor->SetUnitState(UnitData::Idle);
-			}
+	FMassEntityManager& GTEntityManager = EntitySubsystem->GetMutableEntityManager();
+	if (StrongUnitActor->GetUnitState() != UnitData::Idle && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateIdleTag::StaticStruct())) {
+		StrongUnitActor->SetUnitState(UnitData::Idle);
+	}
 
-			UpdateUnitArrayMovement(CapturedEntity, StrongUnitActor);
+	UpdateUnitArrayMovement(CapturedEntity, StrongUnitActor);
 
 
-			if (StrongUnitActor->GetUnitState() == UnitData::Casting && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateCastingTag::StaticStruct())) {
-				SwitchState(UnitSignals::Casting, CapturedEntity, GTEntityManager);
-			}
+	if (StrongUnitActor->GetUnitState() == UnitData::Casting && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateCastingTag::StaticStruct())) {
+		SwitchState(UnitSignals::Casting, CapturedEntity, GTEntityManager);
+	}
 
-			if (!StrongUnitActor->IsWorker) return;
+	if (!StrongUnitActor->IsWorker) return;
 
-			if (!EntitySubsystem)
-			{
-				//UE_LOG(LogTemp, Error, TEXT("SynchronizeUnitState (GameThread): EntitySubsystem wurde null!"));
-				return;
-			}
+	if (!EntitySubsystem)
+	{
+		//UE_LOG(LogTemp, Error, TEXT("SynchronizeUnitState (GameThread): EntitySubsystem wurde null!"));
+		return;
+	}
 
-			FMassAIStateFragment* State = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(CapturedEntity);
-			FMassWorkerStatsFragment* WorkerStats = GTEntityManager.GetFragmentDataPtr<FMassWorkerStatsFragment>(CapturedEntity);
+	FMassAIStateFragment* State = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(CapturedEntity);
+	FMassWorkerStatsFragment* WorkerStats = GTEntityManager.GetFragmentDataPtr<FMassWorkerStatsFragment>(CapturedEntity);
 
-			TArray<FMassEntityHandle> CapturedEntitys;
-			CapturedEntitys.Emplace(CapturedEntity);
+	TArray<FMassEntityHandle> CapturedEntitys;
+	CapturedEntitys.Emplace(CapturedEntity);
 
-			if (WorkerStats && WorkerStats->AutoMining && !StrongUnitActor->Base->IsFlying
-				&& !StrongUnitActor->FollowUnit
-				&& !StrongUnitActor->bHoldPosition
-				&& ((DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateIdleTag::StaticStruct())
-					&& StrongUnitActor->GetUnitState() == UnitData::Idle) || (DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStatePatrolIdleTag::StaticStruct())))) {
-				StrongUnitActor->SetUnitState(UnitData::GoToResourceExtraction);
-			}
+	if (WorkerStats && WorkerStats->AutoMining && !StrongUnitActor->Base->IsFlying
+		&& !StrongUnitActor->FollowUnit
+		&& !StrongUnitActor->bHoldPosition
+		&& ((DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateIdleTag::StaticStruct())
+			&& StrongUnitActor->GetUnitState() == UnitData::Idle) || (DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStatePatrolIdleTag::StaticStruct())))) {
+		StrongUnitActor->SetUnitState(UnitData::GoToResourceExtraction);
+	}
 
-			if (StrongUnitActor->GetUnitState() == UnitData::GoToBuild && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBuildTag::StaticStruct())) {
-				SwitchState(UnitSignals::GoToBuild, CapturedEntity, GTEntityManager);
-			}
-			else if (StrongUnitActor->GetUnitState() == UnitData::ResourceExtraction && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateResourceExtractionTag::StaticStruct())) {
-				State->StateTimer = 0.f;
-				SwitchState(UnitSignals::ResourceExtraction, CapturedEntity, GTEntityManager);
-			}
-			else if (StrongUnitActor->GetUnitState() == UnitData::Build && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateBuildTag::StaticStruct())) {
-				State->StateTimer = 0.f;
-				SwitchState(UnitSignals::Build, CapturedEntity, GTEntityManager);
-			}
-			else if (StrongUnitActor->GetUnitState() == UnitData::GoToResourceExtraction && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToResourceExtractionTag::StaticStruct())) {
-				SwitchState(UnitSignals::GoToResourceExtraction, CapturedEntity, GTEntityManager);
-			}
-			else if (StrongUnitActor->GetUnitState() == UnitData::GoToBase && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBaseTag::StaticStruct())) {
-				SwitchState(UnitSignals::GoToBase, CapturedEntity, GTEntityManager);
-			}
+	if (StrongUnitActor->GetUnitState() == UnitData::GoToBuild && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBuildTag::StaticStruct())) {
+		SwitchState(UnitSignals::GoToBuild, CapturedEntity, GTEntityManager);
+	}
+	else if (StrongUnitActor->GetUnitState() == UnitData::ResourceExtraction && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateResourceExtractionTag::StaticStruct())) {
+		State->StateTimer = 0.f;
+		SwitchState(UnitSignals::ResourceExtraction, CapturedEntity, GTEntityManager);
+	}
+	else if (StrongUnitActor->GetUnitState() == UnitData::Build && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateBuildTag::StaticStruct())) {
+		State->StateTimer = 0.f;
+		SwitchState(UnitSignals::Build, CapturedEntity, GTEntityManager);
+	}
+	else if (StrongUnitActor->GetUnitState() == UnitData::GoToResourceExtraction && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToResourceExtractionTag::StaticStruct())) {
+		SwitchState(UnitSignals::GoToResourceExtraction, CapturedEntity, GTEntityManager);
+	}
+	else if (StrongUnitActor->GetUnitState() == UnitData::GoToBase && !DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBaseTag::StaticStruct())) {
+		SwitchState(UnitSignals::GoToBase, CapturedEntity, GTEntityManager);
+	}
 
 
-			if (StrongUnitActor->GetUnitState() != UnitData::GoToBuild && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBuildTag::StaticStruct())) {
-				StrongUnitActor->SetUnitState(UnitData::GoToBuild);
-			}
-			else if (StrongUnitActor->GetUnitState() != UnitData::ResourceExtraction && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateResourceExtractionTag::StaticStruct())) {
-				StrongUnitActor->SetUnitState(UnitData::ResourceExtraction);
-			}
-			else if (StrongUnitActor->GetUnitState() != UnitData::Build && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateBuildTag::StaticStruct())) {
-				StrongUnitActor->SetUnitState(UnitData::Build);
-			}
-			else if (StrongUnitActor->GetUnitState() != UnitData::GoToResourceExtraction && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToResourceExtractionTag::StaticStruct())) {
-				StrongUnitActor->SetUnitState(UnitData::GoToResourceExtraction);
-			}
-			else if (StrongUnitActor->GetUnitState() != UnitData::GoToBase && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBaseTag::StaticStruct())) {
-				StrongUnitActor->SetUnitState(UnitData::GoToBase);
-			}
+	if (StrongUnitActor->GetUnitState() != UnitData::GoToBuild && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBuildTag::StaticStruct())) {
+		StrongUnitActor->SetUnitState(UnitData::GoToBuild);
+	}
+	else if (StrongUnitActor->GetUnitState() != UnitData::ResourceExtraction && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateResourceExtractionTag::StaticStruct())) {
+		StrongUnitActor->SetUnitState(UnitData::ResourceExtraction);
+	}
+	else if (StrongUnitActor->GetUnitState() != UnitData::Build && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateBuildTag::StaticStruct())) {
+		StrongUnitActor->SetUnitState(UnitData::Build);
+	}
+	else if (StrongUnitActor->GetUnitState() != UnitData::GoToResourceExtraction && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToResourceExtractionTag::StaticStruct())) {
+		StrongUnitActor->SetUnitState(UnitData::GoToResourceExtraction);
+	}
+	else if (StrongUnitActor->GetUnitState() != UnitData::GoToBase && DoesEntityHaveTag(GTEntityManager, CapturedEntity, FMassStateGoToBaseTag::StaticStruct())) {
+		StrongUnitActor->SetUnitState(UnitData::GoToBase);
+	}
 
 
-			// Debug logging for UnitState, Tags, and BuildArea before movement update
+	// Debug logging for UnitState, Tags, and BuildArea before movement update
 
 
-			UpdateUnitMovement(CapturedEntity, StrongUnitActor);
+	UpdateUnitMovement(CapturedEntity, StrongUnitActor);
 
-			// Log current UnitState at the end of SynchronizeUnitState to trace state changes
-			/*{
-				const UEnum* UnitStateEnum = StaticEnum<UnitData::EState>();
-				const uint8 RawState = (uint8)StrongUnitActor->GetUnitState();
-				const FString StateName = UnitStateEnum ? UnitStateEnum->GetNameStringByValue((int64)RawState) : FString::FromInt(RawState);
-				UE_LOG(LogTemp, Warning, TEXT("[SynchronizeUnitState][END] Unit=%s State=%s (%d)"), *StrongUnitActor->GetName(), *StateName, RawState);
-			}*/
-		}); // Ende AsyncTask Lambda
+	// Log current UnitState at the end of SynchronizeUnitState to trace state changes
+	/*{
+		const UEnum* UnitStateEnum = StaticEnum<UnitData::EState>();
+		const uint8 RawState = (uint8)StrongUnitActor->GetUnitState();
+		const FString StateName = UnitStateEnum ? UnitStateEnum->GetNameStringByValue((int64)RawState) : FString::FromInt(RawState);
+		UE_LOG(LogTemp, Warning, TEXT("[SynchronizeUnitState][END] Unit=%s State=%s (%d)"), *StrongUnitActor->GetName(), *StateName, RawState);
+	}*/
 }
 
 void UUnitStateProcessor::UnitActivateRangedAbilities(FName SignalName, TArray<FMassEntityHandle>& Entities)
@@ -1377,6 +1670,7 @@ void UUnitStateProcessor::UnitActivateRangedAbilities(FName SignalName, TArray<F
 					FMassEntityHandle AttackerEntity = Entity; // Capture for potential signals or logging
 
 					// Dispatch to GameThread for ability activation as it involves Actor UFUNCTIONs
+					INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
 					AsyncTask(ENamedThreads::GameThread, [this, AttackerEntity, WeakAttacker]() mutable
 						{
 							AUnitBase* StrongAttacker = WeakAttacker.Get();
@@ -1434,7 +1728,6 @@ void UUnitStateProcessor::UnitMeeleAttack(FName SignalName, TArray<FMassEntityHa
 		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
 		// Retrieve fragments needed for logic immediately
 		const FMassCombatStatsFragment* AttackerStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Entity);
-		FMassCombatStatsFragment* TargetStatsFrag = nullptr; // Will fetch below
 		FMassAITargetFragment* TargetFrag = EntityManager.GetFragmentDataPtr<FMassAITargetFragment>(Entity);
 
 		if (ActorFragPtr && AttackerStats && TargetFrag && TargetFrag->bHasValidTarget && TargetFrag->TargetEntity.IsSet())
@@ -1444,114 +1737,195 @@ void UUnitStateProcessor::UnitMeeleAttack(FName SignalName, TArray<FMassEntityHa
 
 			if (UnitBase && IsValid(UnitBase->UnitToChase) && !UnitBase->UseProjectile && EntityManager.IsEntityValid(TargetEntity))
 			{
-				// 1. HANDLE MATH & LOGIC HERE (While pointers are valid)
-				TargetStatsFrag = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(TargetEntity);
-				if (!TargetStatsFrag) continue;
+				FPendingDamageEvent DamageEvent;
+				DamageEvent.Attacker = Entity;
+				DamageEvent.Target = TargetEntity;
+				DamageEvent.AttackerUnit = UnitBase;
+				DamageEvent.TargetUnit = UnitBase->UnitToChase;
+				DamageEvent.Damage = AttackerStats->AttackDamage;
+				DamageEvent.bMagicDamage = UnitBase->IsDoingMagicDamage;
+				QueueDamageEvent(DamageEvent);
+			}
+		}
+	}
+}
+
+void UUnitStateProcessor::QueueDamageEvent(const FPendingDamageEvent& DamageEvent)
+{
+	if (bIsShuttingDown)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_RTSUnitSignals_DamageEvents);
+
+	if (CVarRTS_Combat_BatchDamage.GetValueOnAnyThread() <= 0)
+	{
+		INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
+		TWeakObjectPtr<UUnitStateProcessor> WeakThis(this);
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, DamageEvent]()
+			{
+				UUnitStateProcessor* StrongThis = WeakThis.Get();
+				if (StrongThis && !StrongThis->bIsShuttingDown)
+				{
+					TArray<FPendingDamageEvent> SingleHit = { DamageEvent };
+					StrongThis->ResolveDamageEvents(SingleHit);
+				}
+			});
+		return;
+	}
 
-				bool bIsMagicDamage = UnitBase->IsDoingMagicDamage;
-				float BaseDamage = AttackerStats->AttackDamage;
-				float Defense = bIsMagicDamage ? TargetStatsFrag->MagicResistance : TargetStatsFrag->Armor;
-				float DamageAfterDefense = FMath::Max(0.0f, BaseDamage - Defense);
+	bool bScheduleFlush = false;
+	{
+		FScopeLock Lock(&PendingSignalBatchesCS);
+		PendingDamageEvents.Add(DamageEvent);
+		bScheduleFlush = !bSignalBatchFlushScheduled;
+		bSignalBatchFlushScheduled = true;
+	}
 
-				float DamageToApply = DamageAfterDefense;
-				float ShieldDamage = 0.0f;
-				float HealthDamage = 0.0f;
+	if (bScheduleFlush)
+	{
+		ScheduleSignalFlush();
+	}
+}
+
+void UUnitStateProcessor::ResolveDamageEvents(TArray<FPendingDamageEvent>& DamageEvents)
+{
+	if (DamageEvents.Num() == 0 || !EntitySubsystem)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitStateProcessor_ResolveDamageEvents);
+
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+
+	// Hits on the same target become adjacent, attackers keep their signal order
+	DamageEvents.StableSort([](const FPendingDamageEvent& A, const FPendingDamageEvent& B)
+		{
+			return A.Target.Index < B.Target.Index;
+		});
+
+	for (int32 First = 0; First < DamageEvents.Num();)
+	{
+		const FMassEntityHandle TargetEntity = DamageEvents[First].Target;
+		int32 End = First + 1;
+		while (End < DamageEvents.Num() && DamageEvents[End].Target == TargetEntity)
+		{
+			++End;
+		}
+
+		FMassCombatStatsFragment* TargetStatsFrag = EntityManager.IsEntityValid(TargetEntity)
+			? EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(TargetEntity)
+			: nullptr;
+
+		if (TargetStatsFrag)
+		{
+			INC_DWORD_STAT(STAT_RTSUnitSignals_DamageTargets);
+
+			float ShieldDamage = 0.0f;
+			float HealthDamage = 0.0f;
+
+			// Same per hit math as before, only summed up per target
+			for (int32 Index = First; Index < End; ++Index)
+			{
+				const FPendingDamageEvent& Hit = DamageEvents[Index];
+				const float Defense = Hit.bMagicDamage ? TargetStatsFrag->MagicResistance : TargetStatsFrag->Armor;
+				float DamageToApply = FMath::Max(0.0f, Hit.Damage - Defense);
 
-				// Calculate Shield/Health splits
 				if (TargetStatsFrag->Shield > 0)
 				{
-					ShieldDamage = FMath::Min(TargetStatsFrag->Shield, DamageToApply);
-					TargetStatsFrag->Shield -= ShieldDamage;
-					DamageToApply -= ShieldDamage;
+					const float HitShieldDamage = FMath::Min(TargetStatsFrag->Shield, DamageToApply);
+					TargetStatsFrag->Shield -= HitShieldDamage;
+					ShieldDamage += HitShieldDamage;
+					DamageToApply -= HitShieldDamage;
 				}
 				if (DamageToApply > 0)
 				{
-					HealthDamage = FMath::Min(TargetStatsFrag->Health, DamageToApply);
-					TargetStatsFrag->Health -= HealthDamage;
+					const float HitHealthDamage = FMath::Min(TargetStatsFrag->Health, DamageToApply);
+					TargetStatsFrag->Health -= HitHealthDamage;
+					HealthDamage += HitHealthDamage;
 				}
 
-				// Clamp Health
 				TargetStatsFrag->Health = FMath::Max(0.0f, TargetStatsFrag->Health);
+			}
 
-				// 2. PREPARE ASYNC DATA
-				// We capture VALUES (HealthDamage, ShieldDamage), not pointers to fragments.
-				TWeakObjectPtr<AUnitBase> WeakAttacker(UnitBase);
-				TWeakObjectPtr<AUnitBase> WeakTarget(UnitBase->UnitToChase);
-
-				// Capture Tag requirement logic as a bool or ID, don't pass the StateFragment pointer
-				bool bShouldApplyRootReduction = false; // Logic for this needs to stay on game thread or be pre-calculated
-				// Note: Updating StateTimer is complex across threads. It's safer to defer a Command or use a Signal.
+			// One attribute and widget update per target
+			AUnitBase* Target = DamageEvents[First].TargetUnit.Get();
+			if (IsValid(Target) && Target->Attributes)
+			{
+				if (ShieldDamage > 0)
+				{
+					Target->SetShield_Implementation(Target->Attributes->GetShield() - ShieldDamage);
+				}
+				if (HealthDamage > 0)
+				{
+					Target->SetHealth_Implementation(Target->Attributes->GetHealth() - HealthDamage);
+				}
 
-				// 3. DISPATCH GAME THREAD TASK (Visuals & Actor Updates only)
-				AsyncTask(ENamedThreads::GameThread, [WeakAttacker, WeakTarget, HealthDamage, ShieldDamage]()
+				if (Target->HealthWidgetComp)
+				{
+					if (UUnitBaseHealthBar* HealthBarWidget = Cast<UUnitBaseHealthBar>(Target->HealthWidgetComp->GetUserWidgetObject()))
 					{
-						AUnitBase* StrongAttacker = WeakAttacker.Get();
-						AUnitBase* StrongTarget = WeakTarget.Get();
+						HealthBarWidget->UpdateWidget();
+					}
+				}
+			}
 
-						if (StrongAttacker && StrongTarget)
-						{
-							// Update Actor specific attributes (Syncing Mass data to Actor)
-							if (ShieldDamage > 0)
-							{
-								StrongTarget->SetShield_Implementation(StrongTarget->Attributes->GetShield() - ShieldDamage);
-							}
-							if (HealthDamage > 0)
-							{
-								StrongTarget->SetHealth_Implementation(StrongTarget->Attributes->GetHealth() - HealthDamage);
-							}
+			// Attack events, abilities, experience and impact effects stay per hit
+			for (int32 Index = First; Index < End; ++Index)
+			{
+				AUnitBase* Attacker = DamageEvents[Index].AttackerUnit.Get();
+				AUnitBase* HitTarget = DamageEvents[Index].TargetUnit.Get();
+				if (IsValid(Attacker) && IsValid(HitTarget))
+				{
+					ApplyMeleeHitEffects(Attacker, HitTarget);
+				}
+			}
+		}
 
-							// UI Update
-							if (StrongTarget->HealthWidgetComp)
-							{
-								if (UUnitBaseHealthBar* HealthBarWidget = Cast<UUnitBaseHealthBar>(StrongTarget->HealthWidgetComp->GetUserWidgetObject()))
-								{
-									HealthBarWidget->UpdateWidget();
-								}
-							}
+		First = End;
+	}
+}
 
-							// Notify Blueprint
-							StrongTarget->Attacked(StrongAttacker);
+void UUnitStateProcessor::ApplyMeleeHitEffects(AUnitBase* Attacker, AUnitBase* Target)
+{
+	// Notify Blueprint
+	Target->Attacked(Attacker);
 
-							// GAS / Abilities
-							StrongAttacker->ServerStartAttackEvent_Implementation();
+	// GAS / Abilities
+	Attacker->ServerStartAttackEvent_Implementation();
 
-							// --- THIS LINE SHOULD NOW BE SAFE ---
-							// Because we didn't corrupt memory with invalid fragment pointers earlier
-							if (StrongAttacker->AttackAbilityID != EGASAbilityInputID::None && StrongAttacker->AttackAbilities.Num() > 0)
-							{
-								StrongAttacker->ActivateAbilityByInputID(StrongAttacker->AttackAbilityID, StrongAttacker->AttackAbilities);
-							}
+	if (Attacker->AttackAbilityID != EGASAbilityInputID::None && Attacker->AttackAbilities.Num() > 0)
+	{
+		Attacker->ActivateAbilityByInputID(Attacker->AttackAbilityID, Attacker->AttackAbilities);
+	}
 
-							StrongAttacker->ServerMeeleImpactEvent();
+	Attacker->ServerMeeleImpactEvent();
 
-							if (StrongAttacker->TeamId != StrongTarget->TeamId)
-							{
-								StrongAttacker->IncreaseExperience();
-							}
+	if (Attacker->TeamId != Target->TeamId)
+	{
+		Attacker->IncreaseExperience();
+	}
 
-							// Fire melee impact VFX/SFX at the target's location via multicast RPC
-							if (APerformanceUnit* PerfAttacker = Cast<APerformanceUnit>(StrongAttacker))
-							{
-								if (PerfAttacker->HasAuthority())
-								{
-									const FVector ImpactLocation = ComputeImpactSurfaceXY(StrongAttacker, StrongTarget);
-
-									const float KillDelay = 2.0f; // Reasonable lifetime for spawned components
-									PerfAttacker->FireEffectsAtLocation(
-										PerfAttacker->MeleeImpactVFX,
-										PerfAttacker->MeleeImpactSound,
-										PerfAttacker->ScaleImpactVFX,
-										PerfAttacker->ScaleImpactSound,
-										ImpactLocation,
-										KillDelay,
-										PerfAttacker->RotateImpactVFX,
-										PerfAttacker->MeeleImpactVFXDelay,
-										PerfAttacker->MeleeImpactSoundDelay);
-								}
-							}
-						}
-					});
-			}
+	// Fire melee impact VFX/SFX at the target's location via multicast RPC
+	if (APerformanceUnit* PerfAttacker = Cast<APerformanceUnit>(Attacker))
+	{
+		if (PerfAttacker->HasAuthority())
+		{
+			const FVector ImpactLocation = ComputeImpactSurfaceXY(Attacker, Target);
+
+			const float KillDelay = 2.0f; // Reasonable lifetime for spawned components
+			PerfAttacker->FireEffectsAtLocation(
+				PerfAttacker->MeleeImpactVFX,
+				PerfAttacker->MeleeImpactSound,
+				PerfAttacker->ScaleImpactVFX,
+				PerfAttacker->ScaleImpactSound,
+				ImpactLocation,
+				KillDelay,
+				PerfAttacker->RotateImpactVFX,
+				PerfAttacker->MeeleImpactVFXDelay,
+				PerfAttacker->MeleeImpactSoundDelay);
 		}
 	}
 }
@@ -1626,6 +2000,7 @@ void UUnitStateProcessor::UnitRangedAttack(FName SignalName, TArray<FMassEntityH
 				// ONLY because we need to pass the entity handle safely. 
 
 				// 6. DISPATCH VISUAL/GAMEPLAY TASK
+				INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
 				AsyncTask(ENamedThreads::GameThread, [this, Entity, TargetEntity, WeakAttacker, WeakTarget,
 					AttackAbilityID, ThrowAbilityID, OffensiveAbilityID,
 					AttackAbilities, ThrowAbilities, OffensiveAbilities]() mutable
@@ -1745,137 +2120,137 @@ void UUnitStateProcessor::SetUnitToChase(FName SignalName, TArray<FMassEntityHan
 
 void UUnitStateProcessor::HandleStartDead(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleStartDead_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			// **Code inside this lambda now runs on the Game Thread**
+void UUnitStateProcessor::HandleStartDead_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	// **Runs on the Game Thread from the batched signal flush**
 
-			// Re-check EntitySubsystem just in case? Usually fine if 'this' is valid.
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+	// Re-check EntitySubsystem just in case? Usually fine if 'this' is valid.
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
 
-			for (const FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
-			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
+	for (const FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
 
 
-				// Get fragments and actors *on the game thread*
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAgentCharacteristicsFragment* CharFragPtr = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(Entity);
-				if (ActorFragPtr)
+		// Get fragments and actors *on the game thread*
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAgentCharacteristicsFragment* CharFragPtr = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
+			{
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase)
 				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
-					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase)
-						{
-							if (UnitBase->HasAuthority() && UnitBase->NavObstacleProxy) UnitBase->Multicast_UnregisterObstacle();
-							UnitBase->HideHealthWidget(); // Aus deinem Code
-							UnitBase->KillLoadedUnits();
-							UnitBase->CanActivateAbilities = false;
-							UnitBase->GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+					if (UnitBase->HasAuthority() && UnitBase->NavObstacleProxy) UnitBase->Multicast_UnregisterObstacle();
+					UnitBase->HideHealthWidget(); // Aus deinem Code
+					UnitBase->KillLoadedUnits();
+					UnitBase->CanActivateAbilities = false;
+					UnitBase->GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
-							if (UnitBase->WorkResource)
-							{
-								UnitBase->WorkResource->Destroy(true, true);
-								UnitBase->WorkResource = nullptr;
-							}
+					if (UnitBase->WorkResource)
+					{
+						UnitBase->WorkResource->Destroy(true, true);
+						UnitBase->WorkResource = nullptr;
+					}
 
 
-							ARTSGameModeBase* RTSGameMode = Cast<ARTSGameModeBase>(GetWorld()->GetAuthGameMode());
+					ARTSGameModeBase* RTSGameMode = Cast<ARTSGameModeBase>(GetWorld()->GetAuthGameMode());
 
 
-							if (RTSGameMode)
-							{
-								RTSGameMode->AllUnits.Remove(UnitBase);
-							}
-
-							UnitBase->SpawnPickupsArray();
-						}
+					if (RTSGameMode)
+					{
+						RTSGameMode->AllUnits.Remove(UnitBase);
 					}
+
+					UnitBase->SpawnPickupsArray();
 				}
-			} // End For loop
-		}); // End AsyncTask Lambda
+			}
+		}
+	} // End For loop
 }
 
 void UUnitStateProcessor::HandleEndDead(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleEndDead_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			// **Code inside this lambda now runs on the Game Thread**
+void UUnitStateProcessor::HandleEndDead_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	// **Runs on the Game Thread from the batched signal flush**
 
-			// Re-check EntitySubsystem just in case? Usually fine if 'this' is valid.
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+	// Re-check EntitySubsystem just in case? Usually fine if 'this' is valid.
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (const FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	for (const FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+
+		// Get fragments and actors *on the game thread*
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase)
 				{
-					continue;
-				}
 
-				// Get fragments and actors *on the game thread*
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				if (ActorFragPtr)
-				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
+					ABuildingBase* Building = Cast<ABuildingBase>(UnitBase);
+					if (Building && Building->Origin)
 					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase)
-						{
-
-							ABuildingBase* Building = Cast<ABuildingBase>(UnitBase);
-							if (Building && Building->Origin)
-							{
 
-								Building->Origin->Extension = nullptr;
-								SetAbilityEnabledByKey(Building->Origin, "ExtensionAbility", true);
-								// Also Enable ExtensionAbility here from Origin
-							}
+						Building->Origin->Extension = nullptr;
+						SetAbilityEnabledByKey(Building->Origin, "ExtensionAbility", true);
+						// Also Enable ExtensionAbility here from Origin
+					}
 
-							if (UnitBase->DestroyAfterDeath)
-							{
-								UnitBase->Destroy(true, false);
-							}
-						}
+					if (UnitBase->DestroyAfterDeath)
+					{
+						UnitBase->Destroy(true, false);
 					}
 				}
-			} // End For loop
-		}); // End AsyncTask Lambda
+			}
+		}
+	} // End For loop
 }
 
 
@@ -1904,354 +2279,354 @@ void UUnitStateProcessor::SetAbilityEnabledByKey(AUnitBase* UnitBase, const FStr
 
 void UUnitStateProcessor::HandleGetResource(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleGetResource_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+void UUnitStateProcessor::HandleGetResource_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			//HandleGetClosestBaseArea(UnitSignals::GetClosestBase,  EntitiesCopy);
-			for (FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	//HandleGetClosestBaseArea(UnitSignals::GetClosestBase,  Entities);
+	for (FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+		// 4. Call the target method. This is now safe because:
+		//    - We are on the Game Thread.
+		//    - We have validated Worker and Worker->ResourcePlace pointers.
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
-				// 4. Call the target method. This is now safe because:
-				//    - We are on the Game Thread.
-				//    - We have validated Worker and Worker->ResourcePlace pointers.
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				if (ActorFragPtr)
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase && UnitBase->ResourcePlace && IsValid(UnitBase->ResourcePlace) && UnitBase->ResourcePlace->WorkResourceClass)
 				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
-					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase && UnitBase->ResourcePlace && IsValid(UnitBase->ResourcePlace) && UnitBase->ResourcePlace->WorkResourceClass)
-						{
-							WorkAreaData::WorkAreaType PlaceType = UnitBase->ResourcePlace->Type;
-							EResourceType CorrectResourceType = ConvertToResourceType(PlaceType);
-							UnitBase->ExtractingWorkResourceType = CorrectResourceType;
-							SpawnWorkResource(CorrectResourceType, UnitBase->GetActorLocation(), UnitBase->ResourcePlace->WorkResourceClass, UnitBase);
-							SwitchState(UnitSignals::GoToBase, Entity, EntityManager);
-						}
-					}
+					WorkAreaData::WorkAreaType PlaceType = UnitBase->ResourcePlace->Type;
+					EResourceType CorrectResourceType = ConvertToResourceType(PlaceType);
+					UnitBase->ExtractingWorkResourceType = CorrectResourceType;
+					SpawnWorkResource(CorrectResourceType, UnitBase->GetActorLocation(), UnitBase->ResourcePlace->WorkResourceClass, UnitBase);
+					SwitchState(UnitSignals::GoToBase, Entity, EntityManager);
 				}
 			}
-		});
+		}
+	}
 }
 
 void UUnitStateProcessor::HandleReachedBase(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleReachedBase_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+void UUnitStateProcessor::HandleReachedBase_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	for (FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+		// 4. Call the target method. This is now safe because:
+		//    - We are on the Game Thread.
+		//    - We have validated Worker and Worker->ResourcePlace pointers.
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
-				// 4. Call the target method. This is now safe because:
-				//    - We are on the Game Thread.
-				//    - We have validated Worker and Worker->ResourcePlace pointers.
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
-				if (ActorFragPtr)
-				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
-					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
 
-						if (UnitBase && UnitBase->IsWorker)
-						{
-							if (!ResourceGameMode)
-								ResourceGameMode = Cast<AResourceGameMode>(GetWorld()->GetAuthGameMode());
+				if (UnitBase && UnitBase->IsWorker)
+				{
+					if (!ResourceGameMode)
+						ResourceGameMode = Cast<AResourceGameMode>(GetWorld()->GetAuthGameMode());
 
-							bool CanAffordConstruction = false;
+					bool CanAffordConstruction = false;
 
-							if (UnitBase->BuildArea && UnitBase->BuildArea->IsPaid)
-								CanAffordConstruction = true;
-							else
-								CanAffordConstruction = UnitBase->BuildArea ? ResourceGameMode->CanAffordConstruction(UnitBase->BuildArea->ConstructionCost, UnitBase->TeamId) : false; //Worker->BuildArea->CanAffordConstruction(Worker->TeamId, ResourceGameMode->NumberOfTeams,ResourceGameMode->TeamResources) : false;
+					if (UnitBase->BuildArea && UnitBase->BuildArea->IsPaid)
+						CanAffordConstruction = true;
+					else
+						CanAffordConstruction = UnitBase->BuildArea ? ResourceGameMode->CanAffordConstruction(UnitBase->BuildArea->ConstructionCost, UnitBase->TeamId) : false; //Worker->BuildArea->CanAffordConstruction(Worker->TeamId, ResourceGameMode->NumberOfTeams,ResourceGameMode->TeamResources) : false;
 
-							if (UnitBase->Base->IsFlying)
-							{
-								UnitBase->Multicast_SwitchToIdle();
-								return;
-							}
+					if (UnitBase->Base->IsFlying)
+					{
+						UnitBase->Multicast_SwitchToIdle();
+						return;
+					}
 
-							if (ResourceGameMode)
-								UnitBase->Base->HandleBaseArea(UnitBase, ResourceGameMode, CanAffordConstruction);
+					if (ResourceGameMode)
+						UnitBase->Base->HandleBaseArea(UnitBase, ResourceGameMode, CanAffordConstruction);
 
 
-							if (!UnitBase->ResourcePlace)
-							{
-								UnitBase->SwitchEntityTagByState(UnitData::Idle, UnitData::Idle);
-								StateFrag->SwitchingState = false;
-								return;
-							}
+					if (!UnitBase->ResourcePlace)
+					{
+						UnitBase->SwitchEntityTagByState(UnitData::Idle, UnitData::Idle);
+						StateFrag->SwitchingState = false;
+						return;
+					}
 
-							if (UnitBase->WorkResource)
-							{
-								UnitBase->WorkResource = nullptr;
-							}
+					if (UnitBase->WorkResource)
+					{
+						UnitBase->WorkResource = nullptr;
+					}
 
-							UpdateUnitMovement(Entity, UnitBase);
-							//SwitchState( UnitSignals::GoToBase, Entity, EntityManager);
-							UnitBase->SwitchEntityTagByState(UnitBase->UnitState, UnitBase->UnitStatePlaceholder);
-							StateFrag->SwitchingState = false;
+					UpdateUnitMovement(Entity, UnitBase);
+					//SwitchState( UnitSignals::GoToBase, Entity, EntityManager);
+					UnitBase->SwitchEntityTagByState(UnitBase->UnitState, UnitBase->UnitStatePlaceholder);
+					StateFrag->SwitchingState = false;
 
 
-						}
-					}
 				}
 			}
-		});
+		}
+	}
 }
 
 void UUnitStateProcessor::HandleGetClosestBaseArea(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleGetClosestBaseArea_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+void UUnitStateProcessor::HandleGetClosestBaseArea_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (const FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	for (const FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+		// 4. Call the target method. This is now safe because:
+		//    - We are on the Game Thread.
+		//    - We have validated Worker and Worker->ResourcePlace pointers.
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
-				// 4. Call the target method. This is now safe because:
-				//    - We are on the Game Thread.
-				//    - We have validated Worker and Worker->ResourcePlace pointers.
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
-				if (ActorFragPtr)
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase)
 				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
-					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase)
-						{
-							UnitBase->Base = ResourceGameMode->GetClosestBaseFromArray(UnitBase, ResourceGameMode->WorkAreaGroups.BaseAreas);
-							StateFrag->SwitchingState = false;
-						}
-					}
+					UnitBase->Base = ResourceGameMode->GetClosestBaseFromArray(UnitBase, ResourceGameMode->WorkAreaGroups.BaseAreas);
+					StateFrag->SwitchingState = false;
 				}
 			}
-		});
+		}
+	}
 }
 
 
 void UUnitStateProcessor::HandleSpawnBuildingRequest(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleSpawnBuildingRequest_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+void UUnitStateProcessor::HandleSpawnBuildingRequest_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	for (FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+		// 4. Call the target method. This is now safe because:
+		//    - We are on the Game Thread.
+		//    - We have validated Worker and Worker->ResourcePlace pointers.
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAIStateFragment* StateFragment = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
-				// 4. Call the target method. This is now safe because:
-				//    - We are on the Game Thread.
-				//    - We have validated Worker and Worker->ResourcePlace pointers.
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAIStateFragment* StateFragment = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
-				if (ActorFragPtr)
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase && UnitBase->BuildArea)
 				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
+					// Ensure the WorkArea is valid and not already finalized for spawning
+					if (IsValid(UnitBase->BuildArea) && !UnitBase->BuildArea->bFinalBuildingSpawned && !UnitBase->BuildArea->Building)
 					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase && UnitBase->BuildArea)
+						// Mark as spawned to prevent duplicate spawns from multiple workers
+						UnitBase->BuildArea->bFinalBuildingSpawned = true;
+						// If a construction site exists, remove it now
+						float SavedHealth = 0.f;
+						float SavedShield = 0.f;
+						bool bHasSavedStats = false;
+						if (UnitBase->BuildArea->ConstructionUnit)
 						{
-							// Ensure the WorkArea is valid and not already finalized for spawning
-							if (IsValid(UnitBase->BuildArea) && !UnitBase->BuildArea->bFinalBuildingSpawned && !UnitBase->BuildArea->Building)
+							if (UnitBase->BuildArea->ConstructionUnit->Attributes)
 							{
-								// Mark as spawned to prevent duplicate spawns from multiple workers
-								UnitBase->BuildArea->bFinalBuildingSpawned = true;
-								// If a construction site exists, remove it now
-								float SavedHealth = 0.f;
-								float SavedShield = 0.f;
-								bool bHasSavedStats = false;
-								if (UnitBase->BuildArea->ConstructionUnit)
-								{
-									if (UnitBase->BuildArea->ConstructionUnit->Attributes)
-									{
-										SavedHealth = UnitBase->BuildArea->ConstructionUnit->Attributes->GetHealth();
-										SavedShield = UnitBase->BuildArea->ConstructionUnit->Attributes->GetShield();
-										bHasSavedStats = true;
-									}
-									UnitBase->BuildArea->ConstructionUnit->Destroy(false, true);
-									UnitBase->BuildArea->ConstructionUnit = nullptr;
-								}
-								FUnitSpawnParameter SpawnParameter;
-								SpawnParameter.UnitBaseClass = UnitBase->BuildArea->BuildingClass;
-								SpawnParameter.UnitOffset = FVector(0.f, 0.f, UnitBase->BuildArea->BuildZOffset);
-								SpawnParameter.UnitMinRange = FVector(0.f);
-								SpawnParameter.UnitMaxRange = FVector(0.f);
-								SpawnParameter.ServerMeshRotation = UnitBase->BuildArea->ServerMeshRotationBuilding;
-								SpawnParameter.State = UnitData::Idle;
-								SpawnParameter.StatePlaceholder = UnitData::Idle;
-								SpawnParameter.Material = nullptr;
-
-								FVector ActorLocation = UnitBase->BuildArea->GetActorLocation() + FVector(0.f, 0.f, UnitBase->BuildArea->BuildZOffset);
-								/*if(UnitBase->BuildArea && UnitBase->BuildArea->DestroyAfterBuild)
-								{
-									UnitBase->BuildArea->RemoveAreaFromGroup();
-									UnitBase->BuildArea->Destroy(false, true);
-									UnitBase->BuildArea = nullptr;
-								}*/
-
-								if (!ControllerBase)
-								{
-									ControllerBase = Cast<AExtendedControllerBase>(GetWorld()->GetFirstPlayerController());
-								}
-
-								AUnitBase* NewUnit = SpawnSingleUnit(SpawnParameter, ActorLocation, nullptr, UnitBase->TeamId, nullptr);
-
-								// If spawn failed, allow future attempts (keep single-spawn guarantee only on success)
-								if (!NewUnit)
-								{
-									if (UnitBase->BuildArea)
-									{
-										UnitBase->BuildArea->bFinalBuildingSpawned = false;
-									}
-								}
+								SavedHealth = UnitBase->BuildArea->ConstructionUnit->Attributes->GetHealth();
+								SavedShield = UnitBase->BuildArea->ConstructionUnit->Attributes->GetShield();
+								bHasSavedStats = true;
+							}
+							UnitBase->BuildArea->ConstructionUnit->Destroy(false, true);
+							UnitBase->BuildArea->ConstructionUnit = nullptr;
+						}
+						FUnitSpawnParameter SpawnParameter;
+						SpawnParameter.UnitBaseClass = UnitBase->BuildArea->BuildingClass;
+						SpawnParameter.UnitOffset = FVector(0.f, 0.f, UnitBase->BuildArea->BuildZOffset);
+						SpawnParameter.UnitMinRange = FVector(0.f);
+						SpawnParameter.UnitMaxRange = FVector(0.f);
+						SpawnParameter.ServerMeshRotation = UnitBase->BuildArea->ServerMeshRotationBuilding;
+						SpawnParameter.State = UnitData::Idle;
+						SpawnParameter.StatePlaceholder = UnitData::Idle;
+						SpawnParameter.Material = nullptr;
+
+						FVector ActorLocation = UnitBase->BuildArea->GetActorLocation() + FVector(0.f, 0.f, UnitBase->BuildArea->BuildZOffset);
+						/*if(UnitBase->BuildArea && UnitBase->BuildArea->DestroyAfterBuild)
+						{
+							UnitBase->BuildArea->RemoveAreaFromGroup();
+							UnitBase->BuildArea->Destroy(false, true);
+							UnitBase->BuildArea = nullptr;
+						}*/
 
-								// After InitializeAttributes() inside SpawnSingleUnit, apply preserved stats to the spawned building
-								ABuildingBase* SpawnedBuilding = Cast<ABuildingBase>(NewUnit);
+						if (!ControllerBase)
+						{
+							ControllerBase = Cast<AExtendedControllerBase>(GetWorld()->GetFirstPlayerController());
+						}
 
-								if (bHasSavedStats && NewUnit && SpawnedBuilding)
-								{
-									if (SpawnedBuilding->Attributes)
-									{
-										SpawnedBuilding->SetHealth_Implementation(SavedHealth);
-										SpawnedBuilding->SetShield_Implementation(SavedShield);
-									}
-								}
+						AUnitBase* NewUnit = SpawnSingleUnit(SpawnParameter, ActorLocation, nullptr, UnitBase->TeamId, nullptr);
 
-								if (NewUnit && ControllerBase)
-								{
-									NewUnit->IsMyTeam = true;
-									UnitBase->FinishedBuild();
-								}
+						// If spawn failed, allow future attempts (keep single-spawn guarantee only on success)
+						if (!NewUnit)
+						{
+							if (UnitBase->BuildArea)
+							{
+								UnitBase->BuildArea->bFinalBuildingSpawned = false;
+							}
+						}
 
+						// After InitializeAttributes() inside SpawnSingleUnit, apply preserved stats to the spawned building
+						ABuildingBase* SpawnedBuilding = Cast<ABuildingBase>(NewUnit);
 
-								if (NewUnit)
-								{
+						if (bHasSavedStats && NewUnit && SpawnedBuilding)
+						{
+							if (SpawnedBuilding->Attributes)
+							{
+								SpawnedBuilding->SetHealth_Implementation(SavedHealth);
+								SpawnedBuilding->SetShield_Implementation(SavedShield);
+							}
+						}
 
-									if (SpawnedBuilding && UnitBase->BuildArea && UnitBase->BuildArea->NextWaypoint)
-										SpawnedBuilding->NextWaypoint = UnitBase->BuildArea->NextWaypoint;
+						if (NewUnit && ControllerBase)
+						{
+							NewUnit->IsMyTeam = true;
+							UnitBase->FinishedBuild();
+						}
 
-									if (SpawnedBuilding && UnitBase->BuildArea && !UnitBase->BuildArea->DestroyAfterBuild)
-										UnitBase->BuildArea->Building = SpawnedBuilding;
 
-									if (NewUnit->HasAuthority() && !NewUnit->NavObstacleProxy) NewUnit->Multicast_RegisterBuildingAsObstacle();
+						if (NewUnit)
+						{
 
-									if (NewUnit->bUseSkeletalMovement)
-									{
-										NewUnit->InitializeUnitMode();
-									}
+							if (SpawnedBuilding && UnitBase->BuildArea && UnitBase->BuildArea->NextWaypoint)
+								SpawnedBuilding->NextWaypoint = UnitBase->BuildArea->NextWaypoint;
 
-									if (UnitBase->BuildArea->IsExtensionArea && SpawnedBuilding)
-									{
-										SpawnedBuilding->Origin = Cast<ABuildingBase>(UnitBase->BuildArea->Origin);
-										SpawnedBuilding->Origin->Extension = SpawnedBuilding;
+							if (SpawnedBuilding && UnitBase->BuildArea && !UnitBase->BuildArea->DestroyAfterBuild)
+								UnitBase->BuildArea->Building = SpawnedBuilding;
 
-										if (UnitBase->BuildArea->KillOrigin)
-										{
-											SpawnedBuilding->Origin->Destroy(false, true);
-										}
-									}
-								}
+							if (NewUnit->HasAuthority() && !NewUnit->NavObstacleProxy) NewUnit->Multicast_RegisterBuildingAsObstacle();
 
-								if (UnitBase->BuildArea && SpawnedBuilding)
-								{
-									SpawnedBuilding->CanBeSelected = UnitBase->BuildArea->ResultCanBeSelected;
-								}
+							if (NewUnit->bUseSkeletalMovement)
+							{
+								NewUnit->InitializeUnitMode();
+							}
 
-								UnitBase->BuildArea->FinishedBuild();
+							if (UnitBase->BuildArea->IsExtensionArea && SpawnedBuilding)
+							{
+								SpawnedBuilding->Origin = Cast<ABuildingBase>(UnitBase->BuildArea->Origin);
+								SpawnedBuilding->Origin->Extension = SpawnedBuilding;
 
-								if (UnitBase->BuildArea && UnitBase->BuildArea->DestroyAfterBuild && NewUnit)
+								if (UnitBase->BuildArea->KillOrigin)
 								{
-									UnitBase->BuildArea->RemoveAreaFromGroup();
-									UnitBase->BuildArea->Destroy(false, true);
-									UnitBase->BuildArea = nullptr;
+									SpawnedBuilding->Origin->Destroy(false, true);
 								}
 							}
 						}
-						// StateFragment->PlaceholderSignal
-						SwitchState(UnitSignals::GoToBase, Entity, EntityManager);
+
+						if (UnitBase->BuildArea && SpawnedBuilding)
+						{
+							SpawnedBuilding->CanBeSelected = UnitBase->BuildArea->ResultCanBeSelected;
+						}
+
+						UnitBase->BuildArea->FinishedBuild();
+
+						if (UnitBase->BuildArea && UnitBase->BuildArea->DestroyAfterBuild && NewUnit)
+						{
+							UnitBase->BuildArea->RemoveAreaFromGroup();
+							UnitBase->BuildArea->Destroy(false, true);
+							UnitBase->BuildArea = nullptr;
+						}
 					}
 				}
+				// StateFragment->PlaceholderSignal
+				SwitchState(UnitSignals::GoToBase, Entity, EntityManager);
 			}
-		});
+		}
+	}
 }
 
 AUnitBase* UUnitStateProcessor::SpawnSingleUnit(
@@ -2519,208 +2894,208 @@ void UUnitStateProcessor::DespawnWorkResource(AWorkResource* WorkResource)
 
 void UUnitStateProcessor::SyncCastTime(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::SyncCastTime_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			if (!EntitySubsystem)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Early Return 1"));
-				return;
-			}
+void UUnitStateProcessor::SyncCastTime_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Early Return 1"));
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (const FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	for (const FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+		// 4. Call the target method. This is now safe because:
+		//    - We are on the Game Thread.
+		//    - We have validated Worker and Worker->ResourcePlace pointers.
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase)
 				{
-					continue;
-				}
-				// 4. Call the target method. This is now safe because:
-				//    - We are on the Game Thread.
-				//    - We have validated Worker and Worker->ResourcePlace pointers.
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
 
-				if (ActorFragPtr)
-				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
+					UnitBase->UnitControlTimer = StateFrag->StateTimer;
+
+					// Extension path handled via helper when the Mass entity is the ConstructionUnit
+					if (AConstructionUnit* Construction = Cast<AConstructionUnit>(UnitBase))
 					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase)
+						if (HandleExtensionCastForConstructionUnit(EntityManager, Entity, StateFrag, Construction))
 						{
+							continue;
+						}
+					}
 
-							UnitBase->UnitControlTimer = StateFrag->StateTimer;
-
-							// Extension path handled via helper when the Mass entity is the ConstructionUnit
-							if (AConstructionUnit* Construction = Cast<AConstructionUnit>(UnitBase))
-							{
-								if (HandleExtensionCastForConstructionUnit(EntityManager, Entity, StateFrag, Construction))
-								{
-									continue;
-								}
-							}
-
-							// Allow workers in Build state and non-worker buildings in Casting state to progress build
-							if (!UnitBase->IsWorker && (!UnitBase->BuildArea || !DoesEntityHaveTag(EntityManager, Entity, FMassStateCastingTag::StaticStruct())))
-							{
-								continue;
-							}
+					// Allow workers in Build state and non-worker buildings in Casting state to progress build
+					if (!UnitBase->IsWorker && (!UnitBase->BuildArea || !DoesEntityHaveTag(EntityManager, Entity, FMassStateCastingTag::StaticStruct())))
+					{
+						continue;
+					}
 
-							if (!UnitBase->BuildArea || (!DoesEntityHaveTag(EntityManager, Entity, FMassStateBuildTag::StaticStruct()) && !DoesEntityHaveTag(EntityManager, Entity, FMassStateCastingTag::StaticStruct()))) continue;
-							// Worker/building path handled via helper for clean code
-							HandleWorkerOrBuildingCastProgress(EntityManager, Entity, StateFrag, UnitBase);
+					if (!UnitBase->BuildArea || (!DoesEntityHaveTag(EntityManager, Entity, FMassStateBuildTag::StaticStruct()) && !DoesEntityHaveTag(EntityManager, Entity, FMassStateCastingTag::StaticStruct()))) continue;
+					// Worker/building path handled via helper for clean code
+					HandleWorkerOrBuildingCastProgress(EntityManager, Entity, StateFrag, UnitBase);
 
-						}
-					}
 				}
 			}
-		});
+		}
+	}
 }
 
 
 void UUnitStateProcessor::EndCast(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::EndCast_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+void UUnitStateProcessor::EndCast_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	for (FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+		// 4. Call the target method. This is now safe because:
+		//    - We are on the Game Thread.
+		//    - We have validated Worker and Worker->ResourcePlace pointers.
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
-				// 4. Call the target method. This is now safe because:
-				//    - We are on the Game Thread.
-				//    - We have validated Worker and Worker->ResourcePlace pointers.
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
-				if (ActorFragPtr)
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase)
 				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
+					if (UnitBase->ActivatedAbilityInstance)
 					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase)
-						{
-							if (UnitBase->ActivatedAbilityInstance)
-							{
-								UnitBase->ActivatedAbilityInstance->OnAbilityCastComplete();
-
-								// Now clear ActivatedAbilityInstance since the cast has completed
-								// Only clear if the queue is empty (otherwise the queue logic handles it)
-								if (UnitBase->AbilityQueue.IsEmpty())
-								{
-									UE_LOG(LogTemp, Warning, TEXT("SPAWNBUG - EndCast: Queue empty, clearing ActivatedAbilityInstance after OnAbilityCastComplete"));
-									UnitBase->ActivatedAbilityInstance = nullptr;
-									UnitBase->CurrentSnapshot = FQueuedAbility();
-								}
-							}
-							StateFrag->StateTimer = 0.f;
-							UnitBase->UnitControlTimer = 0.f;
+						UnitBase->ActivatedAbilityInstance->OnAbilityCastComplete();
 
-							// Stop ConstructionUnit pulsation when casting ends
-							if (UnitBase->BuildArea && UnitBase->BuildArea->ConstructionUnit)
-							{
-								if (AConstructionUnit* CU_Stop = Cast<AConstructionUnit>(UnitBase->BuildArea->ConstructionUnit))
-								{
-									CU_Stop->MulticastPulsateScale(CU_Stop->PulsateMinMultiplier, CU_Stop->PulsateMaxMultiplier, CU_Stop->PulsateTimeMinToMax, false);
-								}
-							}
+						// Now clear ActivatedAbilityInstance since the cast has completed
+						// Only clear if the queue is empty (otherwise the queue logic handles it)
+						if (UnitBase->AbilityQueue.IsEmpty())
+						{
+							UE_LOG(LogTemp, Warning, TEXT("SPAWNBUG - EndCast: Queue empty, clearing ActivatedAbilityInstance after OnAbilityCastComplete"));
+							UnitBase->ActivatedAbilityInstance = nullptr;
+							UnitBase->CurrentSnapshot = FQueuedAbility();
+						}
+					}
+					StateFrag->StateTimer = 0.f;
+					UnitBase->UnitControlTimer = 0.f;
 
-							// If this was a non-worker building casting to build an extension, trigger final spawn now
-							if (!UnitBase->IsWorker && UnitBase->BuildArea && DoesEntityHaveTag(EntityManager, Entity, FMassStateCastingTag::StaticStruct()))
-							{
-								if (SignalSubsystem)
-								{
-									SignalSubsystem->SignalEntity(UnitSignals::SpawnBuildingRequest, Entity);
-								}
-							}
+					// Stop ConstructionUnit pulsation when casting ends
+					if (UnitBase->BuildArea && UnitBase->BuildArea->ConstructionUnit)
+					{
+						if (AConstructionUnit* CU_Stop = Cast<AConstructionUnit>(UnitBase->BuildArea->ConstructionUnit))
+						{
+							CU_Stop->MulticastPulsateScale(CU_Stop->PulsateMinMultiplier, CU_Stop->PulsateMaxMultiplier, CU_Stop->PulsateTimeMinToMax, false);
+						}
+					}
 
-							SwitchState(StateFrag->PlaceholderSignal, Entity, EntityManager);
+					// If this was a non-worker building casting to build an extension, trigger final spawn now
+					if (!UnitBase->IsWorker && UnitBase->BuildArea && DoesEntityHaveTag(EntityManager, Entity, FMassStateCastingTag::StaticStruct()))
+					{
+						if (SignalSubsystem)
+						{
+							SignalSubsystem->SignalEntity(UnitSignals::SpawnBuildingRequest, Entity);
 						}
 					}
+
+					SwitchState(StateFrag->PlaceholderSignal, Entity, EntityManager);
 				}
 			}
-		});
+		}
+	}
 }
 
 
 void UUnitStateProcessor::SetToUnitStatePlaceholder(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-	// **Keep initial checks outside AsyncTask if possible and thread-safe**
+	// **Keep initial checks outside the game thread batch if possible and thread-safe**
 	if (!EntitySubsystem)
 	{
 		// Log error - This check itself is generally safe
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::SetToUnitStatePlaceholder_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [this, SignalName, EntitiesCopy]() mutable // mutable if you modify captures (not needed here)
-		{
-			if (!EntitySubsystem)
-			{
-				return;
-			}
+void UUnitStateProcessor::SetToUnitStatePlaceholder_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem)
+	{
+		return;
+	}
 
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-			for (FMassEntityHandle& Entity : EntitiesCopy) // Iterate the captured copy
+	for (FMassEntityHandle& Entity : Entities)
+	{
+		// Check entity validity *on the game thread*
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+		// 4. Call the target method. This is now safe because:
+		//    - We are on the Game Thread.
+		//    - We have validated Worker and Worker->ResourcePlace pointers.
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		if (ActorFragPtr)
+		{
+			AActor* Actor = ActorFragPtr->GetMutable();
+			if (IsValid(Actor))
 			{
-				// Check entity validity *on the game thread*
-				if (!EntityManager.IsEntityValid(Entity))
-				{
-					continue;
-				}
-				// 4. Call the target method. This is now safe because:
-				//    - We are on the Game Thread.
-				//    - We have validated Worker and Worker->ResourcePlace pointers.
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
-				if (ActorFragPtr)
+				AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
+				if (UnitBase)
 				{
-					AActor* Actor = ActorFragPtr->GetMutable();
-					if (IsValid(Actor))
-					{
-						AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-						if (UnitBase)
-						{
-							StateFrag->StateTimer = 0.f;
-							UnitBase->UnitControlTimer = 0.f;
+					StateFrag->StateTimer = 0.f;
+					UnitBase->UnitControlTimer = 0.f;
 
-							SwitchState(StateFrag->PlaceholderSignal, Entity, EntityManager);
-						}
-					}
+					SwitchState(StateFrag->PlaceholderSignal, Entity, EntityManager);
 				}
 			}
-		});
+		}
+	}
 }
 
 void UUnitStateProcessor::HandleSightSignals(FName /*SignalName*/, TArray<FMassEntityHandle>& /*Entities*/)
@@ -2748,13 +3123,19 @@ void UUnitStateProcessor::HandleUpdateFogMask(FName SignalName, TArray<FMassEnti
 	if (!CustomPC) return;
 
 	// Must be run on GameThread to access UObjects
-	TArray<FMassEntityHandle> CopiedEntities = Entities;
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleUpdateFogMask_GameThread);
+}
 
-	AsyncTask(ENamedThreads::GameThread, [CustomPC, CopiedEntities = MoveTemp(CopiedEntities)]()
-		{
-			CustomPC->UpdateFogMaskWithCircles(CopiedEntities);
-			CustomPC->UpdateMinimap(CopiedEntities);
-		});
+void UUnitStateProcessor::HandleUpdateFogMask_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!World) return;
+
+	// One redraw with every fog source signalled this frame
+	if (ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(World->GetFirstPlayerController()))
+	{
+		CustomPC->UpdateFogMaskWithCircles(Entities);
+		CustomPC->UpdateMinimap(Entities);
+	}
 }
 
 
@@ -2768,12 +3149,18 @@ void UUnitStateProcessor::HandleUpdateSelectionCircle(FName SignalName, TArray<F
 	ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(PC);
 	if (!CustomPC) return;
 
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::HandleUpdateSelectionCircle_GameThread);
+}
 
+void UUnitStateProcessor::HandleUpdateSelectionCircle_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!World) return;
 
-	AsyncTask(ENamedThreads::GameThread, [CustomPC]()
-		{
-			CustomPC->UpdateSelectionCircles();
-		});
+	// Redraws all circles, so several signals in one frame need only one call
+	if (ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(World->GetFirstPlayerController()))
+	{
+		CustomPC->UpdateSelectionCircles();
+	}
 }
 
 void UUnitStateProcessor::HandleUnitSpawnedSignal(
@@ -2810,6 +3197,11 @@ void UUnitStateProcessor::HandleUnitSpawnedSignal(
 
 				if (!Unit || !IsValid(TargetActor)) return;
 
+				if (UUnitAttributeSyncSubsystem* AttributeSync = UUnitAttributeSyncSubsystem::IsEnabled() ? World->GetSubsystem<UUnitAttributeSyncSubsystem>() : nullptr)
+				{
+					AttributeSync->RegisterUnit(Unit);
+					AttributeSync->QueueFullSync(Unit);
+				}
 
 				// --- Hole benötigte Fragmente für DIESE Entity ---
 				FMassAIStateFragment* StateFragPtr = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(E);
@@ -2972,6 +3364,7 @@ void UUnitStateProcessor::UpdateWorkerMovement(FName SignalName, TArray<FMassEnt
 	auto SendSignalSafe = [this](const FName InSignal, const FMassEntityHandle InEntity)
 		{
 			TWeakObjectPtr<UMassSignalSubsystem> WeakSignal = SignalSubsystem;
+			INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
 			AsyncTask(ENamedThreads::GameThread, [WeakSignal, InSignal, InEntity]()
 				{
 					if (UMassSignalSubsystem* Strong = WeakSignal.Get())
@@ -3070,6 +3463,7 @@ void UUnitStateProcessor::UpdateUnitArrayMovement(FMassEntityHandle& Entity, AUn
 	auto SendSignalSafe = [this](const FName InSignal, const FMassEntityHandle InEntity)
 		{
 			TWeakObjectPtr<UMassSignalSubsystem> WeakSignal = SignalSubsystem;
+			INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
 			AsyncTask(ENamedThreads::GameThread, [WeakSignal, InSignal, InEntity]()
 				{
 					if (UMassSignalSubsystem* Strong = WeakSignal.Get())
@@ -3130,6 +3524,7 @@ void UUnitStateProcessor::UpdateUnitMovement(FMassEntityHandle& Entity, AUnitBas
 	auto SendSignalSafe = [this](const FName InSignal, const FMassEntityHandle InEntity)
 		{
 			TWeakObjectPtr<UMassSignalSubsystem> WeakSignal = SignalSubsystem;
+			INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
 			AsyncTask(ENamedThreads::GameThread, [WeakSignal, InSignal, InEntity]()
 				{
 					if (UMassSignalSubsystem* Strong = WeakSignal.Get())
@@ -3147,6 +3542,7 @@ void UUnitStateProcessor::UpdateUnitMovement(FMassEntityHandle& Entity, AUnitBas
 			{
 			//UE_LOG(LogTemp, Warning, TEXT("[RTS.Replication] UpdateUnitMovement: Invalid Mass entity or UnitBase for %s on client. Destroying local actor to clean up zombie."), *UnitBase->GetName());
 			TWeakObjectPtr<AUnitBase> WeakUnit(UnitBase);
+			INC_DWORD_STAT(STAT_RTSUnitSignals_GameThreadTasks);
 			AsyncTask(ENamedThreads::GameThread, [WeakUnit]()
 				{
 					if (AUnitBase* Strong = WeakUnit.Get())
@@ -3220,94 +3616,95 @@ void UUnitStateProcessor::SyncRepairTime(FName SignalName, TArray<FMassEntityHan
 		return;
 	}
 
-	TArray<FMassEntityHandle> EntitiesCopy = Entities;
-	AsyncTask(ENamedThreads::GameThread, [this, EntitiesCopy]() mutable
-		{
-			if (!EntitySubsystem) { return; }
-			FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	QueueSignalBatch(SignalName, Entities, &UUnitStateProcessor::SyncRepairTime_GameThread);
+}
 
-			for (const FMassEntityHandle& Entity : EntitiesCopy)
-			{
-				if (!EntityManager.IsEntityValid(Entity)) { continue; }
-				FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
-				FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
-				if (!ActorFragPtr || !StateFrag) { continue; }
+void UUnitStateProcessor::SyncRepairTime_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities)
+{
+	if (!EntitySubsystem) { return; }
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-				AUnitBase* UnitBase = Cast<AUnitBase>(ActorFragPtr->GetMutable());
-				if (!UnitBase) { continue; }
+	for (const FMassEntityHandle& Entity : Entities)
+	{
+		if (!EntityManager.IsEntityValid(Entity)) { continue; }
+		FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		FMassAIStateFragment* StateFrag = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(Entity);
+		if (!ActorFragPtr || !StateFrag) { continue; }
 
-				// Only workers can repair
-				if (!UnitBase->IsWorker) { continue; }
+		AUnitBase* UnitBase = Cast<AUnitBase>(ActorFragPtr->GetMutable());
+		if (!UnitBase) { continue; }
 
-				// Require a valid repair target and not building
-				if (UnitBase->BuildArea || !UnitBase->FollowUnit || !UnitBase->CanRepair || !UnitBase->FollowUnit->CanBeRepaired)
-				{
-					continue;
-				}
+		// Only workers can repair
+		if (!UnitBase->IsWorker) { continue; }
 
-				AUnitBase* Target = UnitBase->FollowUnit;
-				float MyRadius = 0.f, TargetRadius = 0.f;
-				if (UCapsuleComponent* MyCapsule = UnitBase->GetCapsuleComponent()) MyRadius = MyCapsule->GetScaledCapsuleRadius();
-				if (UCapsuleComponent* TRCapsule = Target->GetCapsuleComponent()) TargetRadius = TRCapsule->GetScaledCapsuleRadius();
-				const AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(UnitBase);
-				const float RepairReach = MyRadius + TargetRadius + (Worker ? Worker->RepairDistance : 50.f);
-				const float Dist2D = FVector::Dist2D(UnitBase->GetMassActorLocation(), Target->GetMassActorLocation());
+		// Require a valid repair target and not building
+		if (UnitBase->BuildArea || !UnitBase->FollowUnit || !UnitBase->CanRepair || !UnitBase->FollowUnit->CanBeRepaired)
+		{
+			continue;
+		}
 
-				// If out of range while repairing, go back to GoToRepair to re-approach (with hysteresis)
-				const float ExitBuffer = 40.f;
-				if (Dist2D > (RepairReach + ExitBuffer))
-				{
-					FMassEntityHandle MutableEntity = Entity;
-					SwitchState(UnitSignals::GoToRepair, MutableEntity, EntityManager);
-					continue;
-				}
+		AUnitBase* Target = UnitBase->FollowUnit;
+		float MyRadius = 0.f, TargetRadius = 0.f;
+		if (UCapsuleComponent* MyCapsule = UnitBase->GetCapsuleComponent()) MyRadius = MyCapsule->GetScaledCapsuleRadius();
+		if (UCapsuleComponent* TRCapsule = Target->GetCapsuleComponent()) TargetRadius = TRCapsule->GetScaledCapsuleRadius();
+		const AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(UnitBase);
+		const float RepairReach = MyRadius + TargetRadius + (Worker ? Worker->RepairDistance : 50.f);
+		const float Dist2D = FVector::Dist2D(UnitBase->GetMassActorLocation(), Target->GetMassActorLocation());
 
-				// Compute CastTime and progress from target health
-				const float RepairRate = FMath::Max((Worker ? Worker->RepairHealth : 10.f), 0.001f);
-				if (Target->Attributes)
-				{
-					const float MaxHP = Target->Attributes->GetMaxHealth();
-					if (MaxHP > 0.f)
-					{
-						UnitBase->CastTime = MaxHP / RepairRate;
-						if (FMassCombatStatsFragment* StatsFrag = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Entity))
-						{
-							StatsFrag->CastTime = UnitBase->CastTime;
-						}
-					}
-					const float CurrHPNow = Target->Attributes->GetHealth();
-					const float Elapsed = CurrHPNow / RepairRate;
-					UnitBase->UnitControlTimer = Elapsed;
-					StateFrag->StateTimer = Elapsed;
-				}
+		// If out of range while repairing, go back to GoToRepair to re-approach (with hysteresis)
+		const float ExitBuffer = 40.f;
+		if (Dist2D > (RepairReach + ExitBuffer))
+		{
+			FMassEntityHandle MutableEntity = Entity;
+			SwitchState(UnitSignals::GoToRepair, MutableEntity, EntityManager);
+			continue;
+		}
 
-				// Apply heal once per second
-				static TMap<AUnitBase*, float> LastRepairTick;
-				const float Now = World ? World->GetTimeSeconds() : 0.f;
-				float& LastTick = LastRepairTick.FindOrAdd(UnitBase);
-				if (World && (Now - LastTick) >= 1.0f)
+		// Compute CastTime and progress from target health
+		const float RepairRate = FMath::Max((Worker ? Worker->RepairHealth : 10.f), 0.001f);
+		if (Target->Attributes)
+		{
+			const float MaxHP = Target->Attributes->GetMaxHealth();
+			if (MaxHP > 0.f)
+			{
+				UnitBase->CastTime = MaxHP / RepairRate;
+				if (FMassCombatStatsFragment* StatsFrag = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Entity))
 				{
-					LastTick = Now;
-					if (Target->Attributes)
-					{
-						const float MaxHP = Target->Attributes->GetMaxHealth();
-						const float CurrHP = Target->Attributes->GetHealth();
-						const float HealAmt = Worker ? Worker->RepairHealth : 10.f;
-						const float NewHP = FMath::Clamp(CurrHP + HealAmt, 0.f, MaxHP);
-						Target->SetHealth(NewHP);
-					}
+					StatsFrag->CastTime = UnitBase->CastTime;
 				}
+			}
+			const float CurrHPNow = Target->Attributes->GetHealth();
+			const float Elapsed = CurrHPNow / RepairRate;
+			UnitBase->UnitControlTimer = Elapsed;
+			StateFrag->StateTimer = Elapsed;
+		}
 
-				// If target fully repaired: clear follow and return to Idle
-				if (!Target->Attributes || Target->Attributes->GetHealth() >= Target->Attributes->GetMaxHealth())
-				{
-					UnitBase->FollowUnit = nullptr;
-					FMassEntityHandle MutableEntity = Entity;
-					SwitchState(UnitSignals::GoToBase, MutableEntity, EntityManager);
-					continue;
-				}
+		// Apply heal once per second
+		static TMap<AUnitBase*, float> LastRepairTick;
+		const float Now = World ? World->GetTimeSeconds() : 0.f;
+		float& LastTick = LastRepairTick.FindOrAdd(UnitBase);
+		if (World && (Now - LastTick) >= 1.0f)
+		{
+			LastTick = Now;
+			if (Target->Attributes)
+			{
+				const float MaxHP = Target->Attributes->GetMaxHealth();
+				const float CurrHP = Target->Attributes->GetHealth();
+				const float HealAmt = Worker ? Worker->RepairHealth : 10.f;
+				const float NewHP = FMath::Clamp(CurrHP + HealAmt, 0.f, MaxHP);
+				Target->SetHealth(NewHP);
 			}
-		});
+		}
+
+		// If target fully repaired: clear follow and return to Idle
+		if (!Target->Attributes || Target->Attributes->GetHealth() >= Target->Attributes->GetMaxHealth())
+		{
+			UnitBase->FollowUnit = nullptr;
+			FMassEntityHandle MutableEntity = Entity;
+			SwitchState(UnitSignals::GoToBase, MutableEntity, EntityManager);
+			continue;
+		}
+	}
 }
 
 
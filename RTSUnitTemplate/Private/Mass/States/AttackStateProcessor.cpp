@@ -18,10 +18,11 @@
 #include "Controller\PlayerController\CustomControllerBase.h"
 
 
-UAttackStateProcessor::UAttackStateProcessor(): EntityQuery()
+UAttackStateProcessor::UAttackStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -55,20 +56,18 @@ void UAttackStateProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager
     EntityQuery.RegisterWithProcessor(*this);
 }
 
-void UAttackStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UAttackStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     // Ensure the member SignalSubsystem is valid (initialized in Initialize)
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
     UWorld* World = Context.GetWorld(); // Use Context to get World
-    if (!World) return;
-    EntityQuery.ForEachEntityChunk(Context,
+    if (!World) return false;
+    OutChunkFunction =
         // Use deferred signaling via ChunkContext; do NOT dispatch AsyncTask here
         [this, World, &EntityManager](FMassExecutionContext& ChunkContext)
     {
@@ -83,6 +82,11 @@ void UAttackStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
  
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i]; // State modification stays here
             const FMassAITargetFragment& TargetFrag = TargetList[i];
             const FMassCombatStatsFragment& Stats = StatsList[i];
@@ -156,7 +160,8 @@ void UAttackStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
                 }
       
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 
 }
\ No newline at end of file
@@ -12,7 +12,7 @@
 #include "MassCommonFragments.h"
 
 
-UCastingStateProcessor::UCastingStateProcessor(): EntityQuery()
+UCastingStateProcessor::UCastingStateProcessor()
 {
 	ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Client | (int32)EProcessorExecutionFlags::Standalone;
 	ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
@@ -63,40 +63,37 @@ void UCastingStateProcessor::BeginDestroy()
 }
 
 
-void UCastingStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UCastingStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     // QUICK_SCOPE_CYCLE_COUNTER(STAT_UCastingStateProcessor_Execute);
 
     TimeSinceLastRun += Context.GetDeltaTimeSeconds();
     if (TimeSinceLastRun < ExecutionInterval)
     {
-        return;
+        return false;
     }
     TimeSinceLastRun -= ExecutionInterval;
 
     UWorld* World = Context.GetWorld();
     if (!World)
     {
-        return;
+        return false;
     }
 
     if (World->IsNetMode(NM_Client))
     {
-        ExecuteClient(EntityManager, Context);
-    }
-    else
-    {
-        ExecuteServer(EntityManager, Context);
+        return PrepareClientChunkFunction(EntityManager, Context, OutChunkFunction);
     }
+    return PrepareServerChunkFunction(EntityManager, Context, OutChunkFunction);
 }
 
-void UCastingStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UCastingStateProcessor::PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     // Mirror server checks on client and update local-only flags/state
     UWorld* World = Context.GetWorld();
-    if (!World) return;
+    if (!World) return false;
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, &EntityManager](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -137,7 +134,8 @@ void UCastingStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FM
                 continue;
             }
         }
-    });
+    }; // End chunk function
+    return true;
 }
 
 void UCastingStateProcessor::HandleClientSetToPlaceholder(FName SignalName, TArray<FMassEntityHandle>& Entities)
@@ -229,15 +227,15 @@ void UCastingStateProcessor::HandleClientSetToPlaceholder(FName SignalName, TArr
     });
 }
 
-void UCastingStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UCastingStateProcessor::PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     // Get World and Signal Subsystem once before the loop
     UWorld* World = EntityManager.GetWorld(); // Use EntityManager to get World
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -283,5 +281,6 @@ void UCastingStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FM
                 continue;
             }
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 }
@@ -20,10 +20,11 @@
 #include "Controller\PlayerController\CustomControllerBase.h"
 
 
-UChaseStateProcessor::UChaseStateProcessor(): EntityQuery()
+UChaseStateProcessor::UChaseStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Client | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -85,34 +86,32 @@ FVector CalculateChaseOffset(const FMassEntityHandle& Entity, float MinRadius =
                    0.0f);
 }
 
-void UChaseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UChaseStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
-        ExecuteClient(EntityManager, Context);
+        return PrepareClientChunkFunction(EntityManager, Context, OutChunkFunction);
     }
     else
     {
-        ExecuteServer(EntityManager, Context);
+        return PrepareServerChunkFunction(EntityManager, Context, OutChunkFunction);
     }
 }
 
-void UChaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UChaseStateProcessor::PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     UWorld* World = Context.GetWorld();
     if (!World)
     {
-        return;
+        return false;
     }
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, &EntityManager](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -122,6 +121,11 @@ void UChaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMas
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassAITargetFragment& TargetFrag = TargetList[i];
             const FMassCombatStatsFragment& Stats = StatsList[i];
@@ -187,19 +191,20 @@ void UChaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMas
                 }
             }
         }
-    });
+    };
+    return true;
 }
 
-void UChaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UChaseStateProcessor::PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     UWorld* World = Context.GetWorld(); // Use Context to get World
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
     // Using Mass deferred command buffer for thread-safe signaling; no manual PendingSignals array needed.
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         // Use Mass deferred command buffer via ChunkContext.Defer() for thread-safe signaling.
         // Do NOT access SignalSubsystem directly from worker threads.
         [this, World, &EntityManager](FMassExecutionContext& ChunkContext)
@@ -215,6 +220,11 @@ void UChaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMas
             
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i]; // Keep reference if State needs updates
             const FMassAITargetFragment& TargetFrag = TargetList[i];
             const FTransform& Transform = TransformList[i].GetTransform();
@@ -297,5 +307,6 @@ void UChaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMas
 
            UpdateMoveTarget(MoveTarget, TargetLocation, Stats.RunSpeed, World);
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 }
@@ -19,7 +19,7 @@
 #include "Hud/HUDBase.h"
 
 
-UDeathStateProcessor::UDeathStateProcessor(): EntityQuery()
+UDeathStateProcessor::UDeathStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::All;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
@@ -125,30 +125,27 @@ void UDeathStateProcessor::HandleRemoveDeadUnit(FName SignalName, TArray<FMassEn
     });
 }
 
-void UDeathStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UDeathStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     TimeSinceLastRun += Context.GetDeltaTimeSeconds();
     if (TimeSinceLastRun < ExecutionInterval)
     {
-        return; 
+        return false; 
     }
     TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
-        ExecuteClient(EntityManager, Context);
-    }
-    else
-    {
-        ExecuteServer(EntityManager, Context);
+        return PrepareClientChunkFunction(EntityManager, Context, OutChunkFunction);
     }
+    return PrepareServerChunkFunction(EntityManager, Context, OutChunkFunction);
 }
 
-void UDeathStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UDeathStateProcessor::PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -167,14 +164,15 @@ void UDeathStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMas
                 SignalSubsystem->SignalEntityDeferred(ChunkContext, UnitSignals::RemoveDeadUnit, Entity);
             }
         }
-    });
+    }; // End chunk function
+    return true;
 }
 
-void UDeathStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UDeathStateProcessor::PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -205,5 +203,6 @@ void UDeathStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMas
                 SignalSubsystem->SignalEntityDeferred(ChunkContext, UnitSignals::EndDead, Entity);
             }
         }
-    });
+    }; // End chunk function
+    return true;
 }
@@ -0,0 +1,180 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/States/FusedStateProcessor.h"
+#include "MassExecutionContext.h"
+#include "MassEntityManager.h"
+#include "MassEntityUtils.h"
+#include "MassCommonFragments.h"
+#include "MassMovementFragments.h"
+#include "MassNavigationFragments.h"
+#include "Misc/ScopeLock.h"
+#include "Mass/UnitMassTag.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
+
+DECLARE_STATS_GROUP(TEXT("RTS Fused States"), STATGROUP_RTSFusedStates, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Chunks"), STAT_RTSFusedStates_Chunks, STATGROUP_RTSFusedStates);
+DECLARE_DWORD_COUNTER_STAT(TEXT("State Dispatches"), STAT_RTSFusedStates_Dispatches, STATGROUP_RTSFusedStates);
+
+static TAutoConsoleVariable<int32> CVarRTS_States_Fused(
+	TEXT("net.RTS.States.Fused"),
+	0,
+	TEXT("1 = UFusedStateProcessor iterates all unit chunks once and dispatches them to the time sliced state processors, 0 = every state processor runs its own query."),
+	ECVF_Default);
+
+namespace
+{
+	// State processors per entity manager; written on initialization / destruction only
+	struct FStateProcessorRegistry
+	{
+		FCriticalSection Lock;
+		TMap<const FMassEntityManager*, TArray<TWeakObjectPtr<UTimeSlicedStateProcessor>>> ByEntityManager;
+		int32 Version = 0;
+	};
+
+	FStateProcessorRegistry& GetStateProcessorRegistry()
+	{
+		static FStateProcessorRegistry Registry;
+		return Registry;
+	}
+}
+
+UFusedStateProcessor::UFusedStateProcessor(): EntityQuery()
+{
+	ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Client | (int32)EProcessorExecutionFlags::Standalone;
+	ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	bAutoRegisterWithProcessingPhases = true;
+	bRequiresGameThreadExecution = false;
+}
+
+bool UFusedStateProcessor::IsEnabled()
+{
+	return CVarRTS_States_Fused.GetValueOnAnyThread() > 0;
+}
+
+void UFusedStateProcessor::RegisterStateProcessor(const FMassEntityManager& EntityManager, UTimeSlicedStateProcessor& StateProcessor)
+{
+	// Only states that would run in this world, e.g. the server only states stay out on clients
+	const UWorld* World = EntityManager.GetWorld();
+	if (World && !StateProcessor.ShouldExecute(UE::Mass::Utils::GetProcessorExecutionFlagsForWorld(*World)))
+	{
+		return;
+	}
+
+	FStateProcessorRegistry& Registry = GetStateProcessorRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	Registry.ByEntityManager.FindOrAdd(&EntityManager).AddUnique(&StateProcessor);
+	++Registry.Version;
+}
+
+void UFusedStateProcessor::UnregisterStateProcessor(UTimeSlicedStateProcessor& StateProcessor)
+{
+	FStateProcessorRegistry& Registry = GetStateProcessorRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	for (auto It = Registry.ByEntityManager.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Remove(&StateProcessor) > 0)
+		{
+			++Registry.Version;
+		}
+		if (It.Value().IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UFusedStateProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.Initialize(EntityManager);
+	EntityQuery.AddRequirement<FMassAIStateFragment>(EMassFragmentAccess::ReadWrite);
+
+	// Union of the state processor requirements; each state only reads what its own query guarantees
+	EntityQuery.AddRequirement<FMassAITargetFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassCombatStatsFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassMoveTargetFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassPatrolFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassSightFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassVelocityFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassWorkerStatsFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+
+	EntityQuery.RegisterWithProcessor(*this);
+}
+
+const UFusedStateProcessor::FStateDispatch& UFusedStateProcessor::GetDispatch(const FMassArchetypeHandle& Archetype)
+{
+	if (const FStateDispatch* Dispatch = DispatchByArchetype.Find(Archetype))
+	{
+		return *Dispatch;
+	}
+
+	FStateDispatch Dispatch;
+	for (int32 Index = 0; Index < StateProcessors.Num(); ++Index)
+	{
+		const UTimeSlicedStateProcessor* StateProcessor = StateProcessors[Index].Get();
+		if (StateProcessor && StateProcessor->DoesArchetypeMatch(Archetype))
+		{
+			Dispatch.Add(Index);
+		}
+	}
+	return DispatchByArchetype.Add(Archetype, MoveTemp(Dispatch));
+}
+
+void UFusedStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FusedStateProcessor_Execute);
+
+	{
+		FStateProcessorRegistry& Registry = GetStateProcessorRegistry();
+		FScopeLock Lock(&Registry.Lock);
+		if (Registry.Version != RegistryVersion)
+		{
+			const TArray<TWeakObjectPtr<UTimeSlicedStateProcessor>>* Registered = Registry.ByEntityManager.Find(&EntityManager);
+			StateProcessors = Registered ? *Registered : TArray<TWeakObjectPtr<UTimeSlicedStateProcessor>>();
+			RegistryVersion = Registry.Version;
+			DispatchByArchetype.Reset();
+		}
+	}
+
+	// Time slice gate and per frame setup of every state, in registration order
+	TArray<FMassExecuteFunction, TInlineAllocator<16>> ChunkFunctions;
+	ChunkFunctions.SetNum(StateProcessors.Num());
+	bool bAnyDue = false;
+	for (int32 Index = 0; Index < StateProcessors.Num(); ++Index)
+	{
+		UTimeSlicedStateProcessor* StateProcessor = StateProcessors[Index].Get();
+		if (StateProcessor && StateProcessor->PrepareChunkFunction(EntityManager, Context, ChunkFunctions[Index]))
+		{
+			bAnyDue = true;
+		}
+		else
+		{
+			ChunkFunctions[Index].Reset();
+		}
+	}
+
+	if (!bAnyDue)
+	{
+		return;
+	}
+
+	EntityQuery.ForEachEntityChunk(Context,
+		[this, &ChunkFunctions](FMassExecutionContext& ChunkContext)
+	{
+		INC_DWORD_STAT(STAT_RTSFusedStates_Chunks);
+		for (const int32 Index : GetDispatch(ChunkContext.GetEntityCollection().GetArchetype()))
+		{
+			if (ChunkFunctions[Index])
+			{
+				INC_DWORD_STAT(STAT_RTSFusedStates_Dispatches);
+				ChunkFunctions[Index](ChunkContext);
+			}
+		}
+	});
+}
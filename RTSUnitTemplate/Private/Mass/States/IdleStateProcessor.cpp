@@ -15,10 +15,11 @@
 
 // ...
 
-UIdleStateProcessor::UIdleStateProcessor(): EntityQuery()
+UIdleStateProcessor::UIdleStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -52,30 +53,31 @@ void UIdleStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FM
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UIdleStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
-    // Throttle follow assignment checks to once per second
-    static float FollowAccum = 0.0f;
-    FollowAccum += ExecutionInterval;
-    const bool bFollowTickThisFrame = (FollowAccum >= 1.0f);
-    if (bFollowTickThisFrame)
+    // Throttle follow assignment checks to once per second; the flag is kept for a whole pass over all slices
+    if (TimeSlicer.StartedNewCycle())
     {
-        FollowAccum = 0.0f;
+        FollowTimeSinceLastRun += ExecutionInterval;
+        bFollowTickThisCycle = (FollowTimeSinceLastRun >= 1.0f);
+        if (bFollowTickThisCycle)
+        {
+            FollowTimeSinceLastRun = 0.0f;
+        }
     }
+    const bool bFollowTickThisFrame = bFollowTickThisCycle;
     
     const UWorld* World = EntityManager.GetWorld(); // Use EntityManager consistently
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
     
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
 
         [this, World, &EntityManager, bFollowTickThisFrame](FMassExecutionContext& ChunkContext)
     {
@@ -88,6 +90,11 @@ void UIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecut
             
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             const FTransform& Transform = TransformList[i].GetTransform();
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i]; // Mutable for timer
@@ -198,7 +205,8 @@ void UIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecut
             }
 
         } // End Entity Loop
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 
 }
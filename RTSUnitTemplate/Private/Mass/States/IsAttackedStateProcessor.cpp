@@ -8,7 +8,7 @@
 #include "Core/UnitData.h" //Julien changes// Added for passive stance check
 #include "Async/Async.h"
 
-UIsAttackedStateProcessor::UIsAttackedStateProcessor(): EntityQuery()
+UIsAttackedStateProcessor::UIsAttackedStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
@@ -38,22 +38,22 @@ void UIsAttackedStateProcessor::InitializeInternal(UObject& Owner, const TShared
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UIsAttackedStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UIsAttackedStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     TimeSinceLastRun += Context.GetDeltaTimeSeconds();
     if (TimeSinceLastRun < ExecutionInterval)
     {
-        return; 
+        return false; 
     }
     TimeSinceLastRun -= ExecutionInterval;
     
     UWorld* World = GetWorld();
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -95,6 +95,7 @@ void UIsAttackedStateProcessor::Execute(FMassEntityManager& EntityManager, FMass
             }
             // --- Else: Still in IsAttacked state, do nothing else ---
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 }
@@ -13,7 +13,7 @@
 #include "Core/UnitData.h" //Julien changes// Added for passive stance check
 #include "Async/Async.h"
 
-UPatrolIdleStateProcessor::UPatrolIdleStateProcessor(): EntityQuery()
+UPatrolIdleStateProcessor::UPatrolIdleStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
@@ -49,23 +49,23 @@ void UPatrolIdleStateProcessor::InitializeInternal(UObject& Owner, const TShared
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UPatrolIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UPatrolIdleStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     // --- Throttling Check ---
     TimeSinceLastRun += Context.GetDeltaTimeSeconds();
     if (TimeSinceLastRun < ExecutionInterval)
     {
-        return; 
+        return false; 
     }
     TimeSinceLastRun -= ExecutionInterval;
     
     UWorld* World = EntityManager.GetWorld();
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
 
-    EntityQuery.ForEachEntityChunk(Context, 
+    OutChunkFunction = 
         [this](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -122,7 +122,8 @@ void UPatrolIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMass
                 }
             }
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 
 }
@@ -17,7 +17,7 @@
 #include "Core/UnitData.h" //Julien changes// Added for passive stance check
 #include "Async/Async.h"
 
-UPatrolRandomStateProcessor::UPatrolRandomStateProcessor(): EntityQuery()
+UPatrolRandomStateProcessor::UPatrolRandomStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
@@ -55,25 +55,25 @@ void UPatrolRandomStateProcessor::InitializeInternal(UObject& Owner, const TShar
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UPatrolRandomStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UPatrolRandomStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     // --- Throttling Check ---
     TimeSinceLastRun += Context.GetDeltaTimeSeconds();
     if (TimeSinceLastRun < ExecutionInterval)
     {
-       return;
+       return false;
     }
 
     TimeSinceLastRun -= ExecutionInterval;
 
 
     UWorld* World = Context.GetWorld();
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
     
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
 
         [this, World](FMassExecutionContext& ChunkContext)
     {
@@ -128,7 +128,8 @@ void UPatrolRandomStateProcessor::Execute(FMassEntityManager& EntityManager, FMa
 
 
         } // End Entity Loop
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 
 }
@@ -14,10 +14,11 @@
 #include "Async/Async.h"
 #include "Controller\PlayerController\CustomControllerBase.h"
 
-UPauseStateProcessor::UPauseStateProcessor(): EntityQuery()
+UPauseStateProcessor::UPauseStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -50,23 +51,21 @@ void UPauseStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<F
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UPauseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UPauseStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
 
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     // Get World and Signal Subsystem once
     UWorld* World = EntityManager.GetWorld(); // Use EntityManager to get World
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, World, &EntityManager](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -80,6 +79,11 @@ void UPauseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassAITargetFragment& TargetFrag = TargetList[i];
             const FMassCombatStatsFragment& Stats = StatsList[i];
@@ -156,7 +160,8 @@ void UPauseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
                     }
                 }
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
   
 
     
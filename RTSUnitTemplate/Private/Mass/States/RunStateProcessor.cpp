@@ -11,10 +11,11 @@
 #include "Core/UnitData.h" //Julien changes// Added for passive stance check
 #include "Async/Async.h"
 
-URunStateProcessor::URunStateProcessor(): EntityQuery()
+URunStateProcessor::URunStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Client | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -45,25 +46,24 @@ void URunStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMa
 	SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void URunStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool URunStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
- TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
-    // Throttle follow updates to max once per second (local static accumulator)
-    static float FollowAccum = 0.0f;
-    FollowAccum += ExecutionInterval;
-    const bool bFollowTickThisFrameLocal = (FollowAccum >= 1.0f);
-    if (bFollowTickThisFrameLocal)
+    // Throttle follow updates to max once per second. The flag is kept for a whole pass over all
+    // slices so every entity sees it once; the client and server chunk functions read the member
+    if (TimeSlicer.StartedNewCycle())
     {
-        FollowAccum = 0.0f;
+        FollowTimeSinceLastRun += ExecutionInterval;
+        bFollowTickThisFrame = (FollowTimeSinceLastRun >= FollowExecutionInterval);
+        if (bFollowTickThisFrame)
+        {
+            FollowTimeSinceLastRun = 0.0f;
+        }
     }
-    // propagate to member so ExecuteClient/Server can read it
-    this->bFollowTickThisFrame = bFollowTickThisFrameLocal;
     // Get World and Signal Subsystem once
     
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
@@ -77,25 +77,25 @@ void URunStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecuti
                 UE_LOG(LogTemp, Warning, TEXT("[Client][URunStateProcessor] Execute tick"));
             }
         }
-        ExecuteClient(EntityManager, Context);
+        return PrepareClientChunkFunction(EntityManager, Context, OutChunkFunction);
     }
     else
     {
-        ExecuteServer(EntityManager, Context);
+        return PrepareServerChunkFunction(EntityManager, Context, OutChunkFunction);
     }
 
 }
 
-void URunStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool URunStateProcessor::PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     UWorld* World = Context.GetWorld();
     if (!World)
     {
-        return;
+        return false;
     }
 
     // On client, only check for arrival and switch to Idle locally by adjusting tags via deferred commands.
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, &EntityManager](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -108,6 +108,11 @@ void URunStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassE
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
             const FMassCombatStatsFragment& Stats = StatsList[i];
@@ -162,17 +167,18 @@ void URunStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassE
                 continue;
             }
         }
-    });
+    };
+    return true;
 }
 
-void URunStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool URunStateProcessor::PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
 	UWorld* World = Context.GetWorld(); // Use Context to get World
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
     
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
 
         [this, World, &EntityManager](FMassExecutionContext& ChunkContext)
     {
@@ -186,6 +192,11 @@ void URunStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassE
             
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i]; // Keep reference if State needs updates
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i]; // Mutable for Update/Stop
             const FMassAITargetFragment& TargetFrag = TargetList[i];
@@ -267,6 +278,7 @@ void URunStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassE
             }
             
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 }
@@ -0,0 +1,43 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/States/StateTimeSlicer.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_States_TimeSlices(
+	TEXT("net.RTS.States.TimeSlices"),
+	4,
+	TEXT("Number of slices the time sliced state processors split their entities into. Each slice is processed every ExecutionInterval / TimeSlices, 1 = all entities every ExecutionInterval."),
+	ECVF_Default);
+
+void FMassStateTimeSlicer::SetPhase(FName PhaseName)
+{
+	// Golden ratio scrambling keeps similar names apart
+	PhaseFraction = FMath::Frac(static_cast<float>(GetTypeHash(PhaseName) % 1024u) * 0.61803398875f);
+	NumSlices = 0;
+}
+
+bool FMassStateTimeSlicer::Advance(float DeltaTime, float ExecutionInterval)
+{
+	const int32 DesiredSlices = FMath::Clamp(CVarRTS_States_TimeSlices.GetValueOnGameThread(), 1, MaxSlices);
+	const float SliceInterval = ExecutionInterval / DesiredSlices;
+
+	if (DesiredSlices != NumSlices)
+	{
+		NumSlices = DesiredSlices;
+		NextSlice = 0;
+		TimeSinceLastSlice = PhaseFraction * SliceInterval;
+	}
+
+	DueSliceMask = 0;
+	bStartedNewCycle = false;
+	TimeSinceLastSlice += DeltaTime;
+
+	// A long frame makes several slices due at once, but never more than one full pass
+	for (int32 Step = 0; Step < NumSlices && TimeSinceLastSlice >= SliceInterval; ++Step)
+	{
+		TimeSinceLastSlice -= SliceInterval;
+		bStartedNewCycle |= (NextSlice == 0);
+		DueSliceMask |= 1u << NextSlice;
+		NextSlice = (NextSlice + 1) % NumSlices;
+	}
+
+	return DueSliceMask != 0;
+}
@@ -0,0 +1,31 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/States/TimeSlicedStateProcessor.h"
+#include "MassExecutionContext.h"
+#include "Mass/States/FusedStateProcessor.h"
+
+void UTimeSlicedStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	Super::InitializeInternal(Owner, EntityManager);
+	UFusedStateProcessor::RegisterStateProcessor(EntityManager.Get(), *this);
+}
+
+void UTimeSlicedStateProcessor::BeginDestroy()
+{
+	UFusedStateProcessor::UnregisterStateProcessor(*this);
+	Super::BeginDestroy();
+}
+
+void UTimeSlicedStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	// The fused processor runs our chunk function
+	if (UFusedStateProcessor::IsEnabled())
+	{
+		return;
+	}
+
+	FMassExecuteFunction ChunkFunction;
+	if (PrepareChunkFunction(EntityManager, Context, ChunkFunction))
+	{
+		EntityQuery.ForEachEntityChunk(Context, ChunkFunction);
+	}
+}
@@ -14,10 +14,11 @@
 
 // No Actor includes, no Movement includes needed
 
-UBuildStateProcessor::UBuildStateProcessor(): EntityQuery()
+UBuildStateProcessor::UBuildStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -52,22 +53,20 @@ void UBuildStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<F
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UBuildStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
     const UWorld* World = EntityManager.GetWorld();
 
-    if (!World) { return; } // Early exit if world is invalid
+    if (!World) { return false; } // Early exit if world is invalid
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, World](FMassExecutionContext& Context)
     {
         const TArrayView<FMassAIStateFragment> AIStateList = Context.GetMutableFragmentView<FMassAIStateFragment>();
@@ -78,6 +77,11 @@ void UBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
         //UE_LOG(LogTemp, Log, TEXT("UBuildStateProcessor NumEntities: %d"), NumEntities);
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(Context.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& AIState = AIStateList[i];
             const FMassEntityHandle Entity = Context.GetEntity(i);
             const FMassWorkerStatsFragment WorkerStats = WorkerStatsList[i];
@@ -113,6 +117,7 @@ void UBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
             }
 
         } // End loop through entities
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 }
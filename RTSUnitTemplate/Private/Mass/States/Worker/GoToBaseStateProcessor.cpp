@@ -13,10 +13,11 @@
 
 // No Actor includes needed
 
-UGoToBaseStateProcessor::UGoToBaseStateProcessor(): EntityQuery()
+UGoToBaseStateProcessor::UGoToBaseStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Client | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -56,36 +57,34 @@ void UGoToBaseStateProcessor::InitializeInternal(UObject& Owner, const TSharedRe
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UGoToBaseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UGoToBaseStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return;
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
-        ExecuteClient(EntityManager, Context);
+        return PrepareClientChunkFunction(EntityManager, Context, OutChunkFunction);
     }
     else
     {
-        ExecuteServer(EntityManager, Context);
+        return PrepareServerChunkFunction(EntityManager, Context, OutChunkFunction);
     }
 }
 
-void UGoToBaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UGoToBaseStateProcessor::PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     UWorld* World = Context.GetWorld();
     if (!World)
     {
-        return;
+        return false;
     }
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, World, &EntityManager](FMassExecutionContext& ChunkContext)
     {
         // --- Get Fragment Views ---
@@ -101,6 +100,11 @@ void UGoToBaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, F
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             const FTransform& CurrentTransform = TransformList[i].GetTransform();
             const FMassWorkerStatsFragment& WorkerStats = WorkerStatsList[i];
@@ -138,18 +142,19 @@ void UGoToBaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, F
             // --- 2. Movement Logic ---
             // Use the externally provided helper function
         } // End loop through entities
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 }
 
-void UGoToBaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UGoToBaseStateProcessor::PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     UWorld* World = Context.GetWorld();
     if (!World)
     {
-        return;
+        return false;
     }
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, &EntityManager](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -161,6 +166,11 @@ void UGoToBaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, F
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
             const FMassWorkerStatsFragment& WorkerStats = WorkerStatsList[i];
@@ -213,5 +223,6 @@ void UGoToBaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, F
                 continue;
             }
         }
-    });
+    };
+    return true;
 }
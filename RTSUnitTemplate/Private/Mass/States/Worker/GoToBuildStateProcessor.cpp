@@ -17,10 +17,11 @@
 // No Actor/Component includes needed in this file anymore
 
 
-UGoToBuildStateProcessor::UGoToBuildStateProcessor(): EntityQuery()
+UGoToBuildStateProcessor::UGoToBuildStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -56,26 +57,24 @@ void UGoToBuildStateProcessor::InitializeInternal(UObject& Owner, const TSharedR
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UGoToBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UGoToBuildStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
     UWorld* World = EntityManager.GetWorld();
 
     if (!World)
     {
         //UE_LOG(LogTemp, Error, TEXT("UGoToBuildStateProcessor: Cannot execute without a valid UWorld."));
-        return;
+        return false;
     }
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
     
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, World](FMassExecutionContext& Context)
     {
         // --- Get Fragment Views ---
@@ -91,6 +90,11 @@ void UGoToBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassE
         //UE_LOG(LogTemp, Log, TEXT("UGoToBuildStateProcessor NumEntities: %d"), NumEntities);
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(Context.GetEntity(i)))
+            {
+                continue;
+            }
+
             const FMassEntityHandle Entity = Context.GetEntity(i);
             const FTransform& CurrentTransform = TransformList[i].GetTransform();
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
@@ -126,6 +130,7 @@ void UGoToBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassE
                 continue;
             }
         } // End loop through entities
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 }
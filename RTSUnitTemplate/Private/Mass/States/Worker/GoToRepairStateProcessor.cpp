@@ -10,10 +10,11 @@
 #include "Mass/UnitMassTag.h"
 #include "Mass/Signals/MySignals.h"
 
-UGoToRepairStateProcessor::UGoToRepairStateProcessor(): EntityQuery()
+UGoToRepairStateProcessor::UGoToRepairStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -47,23 +48,21 @@ void UGoToRepairStateProcessor::InitializeInternal(UObject& Owner, const TShared
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UGoToRepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UGoToRepairStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return;
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (!SignalSubsystem)
     {
-        return;
+        return false;
     }
 
     UWorld* World = EntityManager.GetWorld();
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, &EntityManager, World](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -76,6 +75,11 @@ void UGoToRepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMass
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
             const FMassCombatStatsFragment& StatsFrag = StatsList[i];
@@ -134,5 +138,6 @@ void UGoToRepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMass
                 UpdateMoveTarget(MoveTarget, DesiredPos, StatsFrag.RunSpeed, World);
             }
         }
-    });
+    };
+    return true;
 }
@@ -11,10 +11,11 @@
 #include "Mass/Signals/MySignals.h"
 
 
-UGoToResourceExtractionStateProcessor::UGoToResourceExtractionStateProcessor(): EntityQuery()
+UGoToResourceExtractionStateProcessor::UGoToResourceExtractionStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -52,27 +53,25 @@ void UGoToResourceExtractionStateProcessor::InitializeInternal(UObject& Owner, c
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UGoToResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UGoToResourceExtractionStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
     //QUICK_SCOPE_CYCLE_COUNTER(STAT_UGoToResourceExtractionStateProcessor_Execute);
     //TRACE_CPUPROFILER_EVENT_SCOPE(UGoToResourceExtractionStateProcessor_Execute);
     
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
     UWorld* World = Context.GetWorld(); // Get World via Context
-    if (!World) return;
+    if (!World) return false;
 
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
 
     
     // Using deferred signal commands via Context, no manual arrays or AsyncTask dispatch needed
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         // Capture World for helper functions
         [this, World](FMassExecutionContext& ChunkContext)
     {
@@ -87,6 +86,11 @@ void UGoToResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityMa
             //UE_LOG(LogTemp, Log, TEXT("UGoToResourceExtractionStateProcessor NumEntities: %d"), NumEntities);
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& AIState = AIStateList[i];
@@ -133,7 +137,8 @@ void UGoToResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityMa
             }
             
         }
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 
 }
@@ -9,10 +9,11 @@
 #include "Mass/UnitMassTag.h"
 #include "Mass/Signals/MySignals.h"
 
-URepairStateProcessor::URepairStateProcessor(): EntityQuery()
+URepairStateProcessor::URepairStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -41,21 +42,19 @@ void URepairStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void URepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool URepairStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return;
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (!SignalSubsystem)
     {
-        return;
+        return false;
     }
 
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this, &EntityManager](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -68,6 +67,11 @@ void URepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
             const FMassCombatStatsFragment& StatsFrag = StatsList[i];
@@ -123,5 +127,6 @@ void URepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
             // 3) Drive repair-time synchronization each tick
             SignalSubsystem->SignalEntityDeferred(ChunkContext, UnitSignals::SyncRepairTime, Entity);
         }
-    });
+    };
+    return true;
 }
@@ -16,10 +16,11 @@
 // struct FMassSignalPayload { ... }; // No need to redefine if included via UnitFragments.h
 
 
-UResourceExtractionStateProcessor::UResourceExtractionStateProcessor(): EntityQuery()
+UResourceExtractionStateProcessor::UResourceExtractionStateProcessor()
 {
     ExecutionFlags = (int32)EProcessorExecutionFlags::Server | (int32)EProcessorExecutionFlags::Standalone;
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
+    TimeSlicer.SetPhase(GetClass()->GetFName());
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
     bRequiresGameThreadExecution = false;
@@ -58,20 +59,18 @@ void UResourceExtractionStateProcessor::InitializeInternal(UObject& Owner, const
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 }
 
-void UResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+bool UResourceExtractionStateProcessor::PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
 {
    // QUICK_SCOPE_CYCLE_COUNTER(STAT_UResourceExtractionStateProcessor_Execute);
     
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlicer.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return false;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
-    if (!SignalSubsystem) return;
+    if (!SignalSubsystem) return false;
     
-    EntityQuery.ForEachEntityChunk(Context,
+    OutChunkFunction =
         [this](FMassExecutionContext& ChunkContext)
     {
         const int32 NumEntities = ChunkContext.GetNumEntities();
@@ -83,6 +82,11 @@ void UResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityManage
         //UE_LOG(LogTemp, Log, TEXT("UResourceExtractionStateProcessor NumEntities: %d"), NumEntities);
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlicer.ShouldProcess(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
+
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassWorkerStatsFragment& WorkerStatsFrag = WorkerStatsList[i];
@@ -120,6 +124,7 @@ void UResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityManage
             }
         }
             
-    }); // End ForEachEntityChunk
+    }; // End chunk function
+    return true;
 
 }
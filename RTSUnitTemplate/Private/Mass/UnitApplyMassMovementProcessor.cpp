@@ -9,6 +9,154 @@
 #include "Mass/UnitMassTag.h"
 #include "Mass/UnitNavigationFragments.h"
 #include "Steering/MassSteeringFragments.h"
+#include "NavigationSystem.h"
+#include "NavMesh/RecastNavMesh.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_Movement_NavProjectionsPerFrame(
+	TEXT("net.RTS.Movement.NavProjectionsPerFrame"),
+	256,
+	TEXT("Full navmesh projections per frame for units that left their cached nav poly. Units over the budget keep their last result until a later frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_Movement_ValidateNavPolyCache(
+	TEXT("net.RTS.Movement.ValidateNavPolyCache"),
+	0,
+	TEXT("1 = also run the full navmesh projection when the cached nav poly test decides and log every disagreement."),
+	ECVF_Default);
+
+namespace
+{
+	/**
+	 * Decides whether a unit is leaving the navmesh (and needs FMassSoftAvoidanceTag).
+	 * A point-in-poly test against the cached poly and its neighbours replaces the full projection
+	 * while the unit stays in that neighbourhood. Recast projects vertically onto a poly whose footprint
+	 * contains the point, so "inside" is exactly the case the projection accepts with zero 2D distance.
+	 */
+	struct FNavMeshLeaveCheck
+	{
+		UNavigationSystemV1* NavSys = nullptr;
+		const ARecastNavMesh* NavMesh = nullptr;
+		float ZExtent = 0.f;
+		int32 ProjectionBudget = 0;
+		bool bValidate = false;
+
+		TArray<FVector> PolyVerts;
+		TArray<NavNodeRef> Neighbors;
+
+		FNavMeshLeaveCheck(UWorld* World, float InZExtent)
+			: NavSys(UNavigationSystemV1::GetCurrent(World))
+			, ZExtent(InZExtent)
+			, ProjectionBudget(FMath::Max(0, CVarRTS_Movement_NavProjectionsPerFrame.GetValueOnGameThread()))
+			, bValidate(CVarRTS_Movement_ValidateNavPolyCache.GetValueOnGameThread() > 0)
+		{
+			if (NavSys)
+			{
+				NavMesh = Cast<ARecastNavMesh>(NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate));
+			}
+		}
+
+		// The original check: project with a capsule based extent and accept only a hit within 5uu in 2D
+		bool ProjectFull(const FVector& Location, float CapsuleRadius, NavNodeRef& OutPoly) const
+		{
+			const FVector ProjectionExtent(CapsuleRadius * 4.0f, CapsuleRadius * 4.0f, ZExtent);
+
+			FNavLocation ProjectedLocation;
+			if (!NavSys->ProjectPointToNavigation(Location, ProjectedLocation, ProjectionExtent) ||
+				FVector::DistSquared2D(Location, ProjectedLocation.Location) > FMath::Square(5.f))
+			{
+				OutPoly = INVALID_NAVNODEREF;
+				return true;
+			}
+			OutPoly = ProjectedLocation.NodeRef;
+			return false;
+		}
+
+		bool IsInsidePoly(NavNodeRef Poly, const FVector& Location)
+		{
+			PolyVerts.Reset();
+			if (!NavMesh->GetPolyVerts(Poly, PolyVerts) || PolyVerts.Num() < 3)
+			{
+				return false;
+			}
+
+			// Recast polys are convex: inside when the point is on the same side of every edge
+			bool bPositive = false;
+			bool bNegative = false;
+			float MinZ = PolyVerts[0].Z;
+			float MaxZ = PolyVerts[0].Z;
+			for (int32 i = 0; i < PolyVerts.Num(); ++i)
+			{
+				const FVector& A = PolyVerts[i];
+				const FVector& B = PolyVerts[(i + 1) % PolyVerts.Num()];
+				const double Cross = (B.X - A.X) * (Location.Y - A.Y) - (B.Y - A.Y) * (Location.X - A.X);
+				bPositive |= Cross > 0.0;
+				bNegative |= Cross < 0.0;
+				if (bPositive && bNegative)
+				{
+					return false;
+				}
+				MinZ = FMath::Min<float>(MinZ, A.Z);
+				MaxZ = FMath::Max<float>(MaxZ, A.Z);
+			}
+			return Location.Z >= MinZ - ZExtent && Location.Z <= MaxZ + ZExtent;
+		}
+
+		bool IsLeavingNavMesh(FUnitNavPolyFragment* PolyFrag, const FVector& Location, float CapsuleRadius)
+		{
+			NavNodeRef ProjectedPoly = INVALID_NAVNODEREF;
+			if (!PolyFrag)
+			{
+				return ProjectFull(Location, CapsuleRadius, ProjectedPoly);
+			}
+
+			bool bInNeighbourhood = false;
+			if (NavMesh && PolyFrag->PolyRef != INVALID_NAVNODEREF)
+			{
+				if (IsInsidePoly(PolyFrag->PolyRef, Location))
+				{
+					bInNeighbourhood = true;
+				}
+				else
+				{
+					Neighbors.Reset();
+					if (NavMesh->GetPolyNeighbors(PolyFrag->PolyRef, Neighbors))
+					{
+						for (const NavNodeRef Neighbor : Neighbors)
+						{
+							if (IsInsidePoly(Neighbor, Location))
+							{
+								PolyFrag->PolyRef = Neighbor;
+								bInNeighbourhood = true;
+								break;
+							}
+						}
+					}
+				}
+			}
+
+			if (bInNeighbourhood)
+			{
+				PolyFrag->bWasLeavingNavMesh = false;
+				if (bValidate && ProjectFull(Location, CapsuleRadius, ProjectedPoly))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[ApplyMassMovement] Nav poly cache says on mesh, projection says leaving at %s"), *Location.ToString());
+				}
+				return false;
+			}
+
+			if (ProjectionBudget <= 0)
+			{
+				return PolyFrag->bWasLeavingNavMesh;
+			}
+			--ProjectionBudget;
+
+			const bool bLeaving = ProjectFull(Location, CapsuleRadius, ProjectedPoly);
+			PolyFrag->PolyRef = ProjectedPoly;
+			PolyFrag->bWasLeavingNavMesh = bLeaving;
+			return bLeaving;
+		}
+	};
+}
 
 UUnitApplyMassMovementProcessor::UUnitApplyMassMovementProcessor(): EntityQuery()
 {
@@ -32,7 +180,8 @@ void UUnitApplyMassMovementProcessor::ConfigureQueries(const TSharedRef<FMassEnt
 	EntityQuery.AddRequirement<FMassForceFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery.AddTagRequirement<FUnitMassTag>(EMassFragmentPresence::All);
-	EntityQuery.AddRequirement<FMassSteeringFragment>(EMassFragmentAccess::ReadOnly); 
+	EntityQuery.AddRequirement<FMassSteeringFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FUnitNavPolyFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional); 
 	
 	EntityQuery.AddTagRequirement<FMassStateRunTag>(EMassFragmentPresence::Any); 
 	EntityQuery.AddTagRequirement<FMassStateChaseTag>(EMassFragmentPresence::Any);
@@ -70,6 +219,7 @@ void UUnitApplyMassMovementProcessor::ConfigureQueries(const TSharedRef<FMassEnt
 	ClientEntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly);
 	//ClientEntityQuery.AddTagRequirement<FUnitMassTag>(EMassFragmentPresence::All);
 	ClientEntityQuery.AddRequirement<FMassSteeringFragment>(EMassFragmentAccess::ReadOnly);
+	ClientEntityQuery.AddRequirement<FUnitNavPolyFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
 	ClientEntityQuery.AddConstSharedRequirement<FMassMovementParameters>(EMassFragmentPresence::All);
 	// Mirror relevant state tags on client to limit work to moving entities
 	ClientEntityQuery.AddTagRequirement<FUnitMassTag>(EMassFragmentPresence::All);
@@ -133,7 +283,9 @@ void UUnitApplyMassMovementProcessor::ExecuteClient(FMassEntityManager& EntityMa
 {
     const float DeltaTime = FMath::Min(0.1f, Context.GetDeltaTimeSeconds());
    
-    ClientEntityQuery.ForEachEntityChunk(Context, [this, DeltaTime](FMassExecutionContext& LocalContext)
+    FNavMeshLeaveCheck NavCheck(GetWorld(), SoftAvoidanceZExtent);
+
+    ClientEntityQuery.ForEachEntityChunk(Context, [this, DeltaTime, &NavCheck](FMassExecutionContext& LocalContext)
     {
         const int32 NumEntities = LocalContext.GetNumEntities();
         if (NumEntities == 0) return;
@@ -144,6 +296,7 @@ void UUnitApplyMassMovementProcessor::ExecuteClient(FMassEntityManager& EntityMa
         const TArrayView<FMassForceFragment> ForceList = LocalContext.GetMutableFragmentView<FMassForceFragment>();
         const TArrayView<FMassVelocityFragment> VelocityList = LocalContext.GetMutableFragmentView<FMassVelocityFragment>();
         const TConstArrayView<FMassAgentCharacteristicsFragment> CharacteristicsList = LocalContext.GetFragmentView<FMassAgentCharacteristicsFragment>();
+        const TArrayView<FUnitNavPolyFragment> NavPolyList = LocalContext.GetMutableFragmentView<FUnitNavPolyFragment>();
 
         const bool bFreezeXY = LocalContext.DoesArchetypeHaveTag<FMassStateStopXYMovementTag>();
 
@@ -192,17 +345,12 @@ void UUnitApplyMassMovementProcessor::ExecuteClient(FMassEntityManager& EntityMa
             const FVector CurrentLocation = CurrentTransform.GetLocation();
             FVector NewLocation = CurrentLocation + Velocity.Value * DeltaTime;
 
-            UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(LocalContext.GetWorld());
             const FMassAgentCharacteristicsFragment& Characteristics = CharacteristicsList[EntityIndex];
 
-            if (NavSys && !Characteristics.bIsFlying)
+            if (NavCheck.NavSys && !Characteristics.bIsFlying)
             {
-                const FVector ProjectionExtent(Characteristics.CapsuleRadius * 4.0f, Characteristics.CapsuleRadius * 4.0f, SoftAvoidanceZExtent);
-
-                FNavLocation ProjectedLocation;
-                // Use capsule-based extent to detect if we are on the mesh
-                if (!NavSys->ProjectPointToNavigation(NewLocation, ProjectedLocation, ProjectionExtent) || 
-                    FVector::DistSquared2D(NewLocation, ProjectedLocation.Location) > FMath::Square(5.f))
+                FUnitNavPolyFragment* NavPoly = NavPolyList.Num() > 0 ? &NavPolyList[EntityIndex] : nullptr;
+                if (NavCheck.IsLeavingNavMesh(NavPoly, NewLocation, Characteristics.CapsuleRadius))
                 {
                     // If projection fails or is too far, the unit is trying to leave the mesh.
                     // We add the tag so SoftAvoidance can push us back next frame
@@ -221,7 +369,9 @@ void UUnitApplyMassMovementProcessor::ExecuteServer(FMassEntityManager& EntityMa
 {
     const float DeltaTime = FMath::Min(0.1f, Context.GetDeltaTimeSeconds());
 
-    EntityQuery.ForEachEntityChunk(Context, [this, DeltaTime](FMassExecutionContext& LocalContext)
+    FNavMeshLeaveCheck NavCheck(GetWorld(), SoftAvoidanceZExtent);
+
+    EntityQuery.ForEachEntityChunk(Context, [this, DeltaTime, &NavCheck](FMassExecutionContext& LocalContext)
     {
         const int32 NumEntities = LocalContext.GetNumEntities();
         if (NumEntities == 0) return;
@@ -232,6 +382,7 @@ void UUnitApplyMassMovementProcessor::ExecuteServer(FMassEntityManager& EntityMa
         const TArrayView<FMassForceFragment> ForceList = LocalContext.GetMutableFragmentView<FMassForceFragment>();
         const TArrayView<FMassVelocityFragment> VelocityList = LocalContext.GetMutableFragmentView<FMassVelocityFragment>();
         const TConstArrayView<FMassAgentCharacteristicsFragment> CharacteristicsList = LocalContext.GetFragmentView<FMassAgentCharacteristicsFragment>();
+        const TArrayView<FUnitNavPolyFragment> NavPolyList = LocalContext.GetMutableFragmentView<FUnitNavPolyFragment>();
 
         const bool bFreezeXY = LocalContext.DoesArchetypeHaveTag<FMassStateStopXYMovementTag>();
 
@@ -271,17 +422,12 @@ void UUnitApplyMassMovementProcessor::ExecuteServer(FMassEntityManager& EntityMa
             const FVector CurrentLocation = CurrentTransform.GetLocation();
             FVector NewLocation = CurrentLocation + Velocity.Value * DeltaTime;
 
-            UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(LocalContext.GetWorld());
             const FMassAgentCharacteristicsFragment& Characteristics = CharacteristicsList[EntityIndex];
 
-            if (NavSys && !Characteristics.bIsFlying)
+            if (NavCheck.NavSys && !Characteristics.bIsFlying)
             {
-                const FVector ProjectionExtent(Characteristics.CapsuleRadius * 4.0f, Characteristics.CapsuleRadius * 4.0f, SoftAvoidanceZExtent);
-
-                FNavLocation ProjectedLocation;
-                // Use capsule-based extent to detect if we are on the mesh
-                if (!NavSys->ProjectPointToNavigation(NewLocation, ProjectedLocation, ProjectionExtent) || 
-                    FVector::DistSquared2D(NewLocation, ProjectedLocation.Location) > FMath::Square(5.f))
+                FUnitNavPolyFragment* NavPoly = NavPolyList.Num() > 0 ? &NavPolyList[EntityIndex] : nullptr;
+                if (NavCheck.IsLeavingNavMesh(NavPoly, NewLocation, Characteristics.CapsuleRadius))
                 {
                     // If projection fails or is too far, the unit is trying to leave the mesh.
                     // We add the tag so SoftAvoidance can push us back next frame
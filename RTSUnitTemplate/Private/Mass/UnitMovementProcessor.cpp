@@ -15,6 +15,115 @@
 #include "Characters/Unit/UnitBase.h"
 #include "Components/CapsuleComponent.h"
 
+static TAutoConsoleVariable<float> CVarRTS_Movement_PathDedupCellSize(
+    TEXT("net.RTS.Movement.PathDedupCellSize"),
+    100.f,
+    TEXT("Cell size used to collapse path requests with the same start and goal cell into one navmesh query."),
+    ECVF_Default);
+static TAutoConsoleVariable<float> CVarRTS_Movement_PathGroupCellSize(
+    TEXT("net.RTS.Movement.PathGroupCellSize"),
+    800.f,
+    TEXT("Goal cell size used to group the path requests of one frame (e.g. a box-selected move order)."),
+    ECVF_Default);
+static TAutoConsoleVariable<int32> CVarRTS_Movement_PathGroupMinSize(
+    TEXT("net.RTS.Movement.PathGroupMinSize"),
+    6,
+    TEXT("Goal groups with at least this many requests share one leader path. 0 disables leader paths."),
+    ECVF_Default);
+static TAutoConsoleVariable<float> CVarRTS_Movement_PathGroupRadius(
+    TEXT("net.RTS.Movement.PathGroupRadius"),
+    1500.f,
+    TEXT("Max 2D distance between a unit and the group leader for the unit to follow the leader path."),
+    ECVF_Default);
+static TAutoConsoleVariable<int32> CVarRTS_Movement_PathBatchReportThreshold(
+    TEXT("net.RTS.Movement.PathBatchReportThreshold"),
+    32,
+    TEXT("Path batches with at least this many requests log their latency and CPU time. 0 disables the report."),
+    ECVF_Default);
+
+namespace
+{
+    struct FPathBatchQuery
+    {
+        FVector StartLocation = FVector::ZeroVector;
+        FVector EndLocation = FVector::ZeroVector;
+        FNavPathSharedPtr Path;
+    };
+
+    struct FPathBatchMember
+    {
+        FMassEntityHandle Entity;
+        FVector StartLocation = FVector::ZeroVector;
+        FVector EndLocation = FVector::ZeroVector;
+        double RequestTime = 0.0;
+        int32 QueryIndex = INDEX_NONE;
+        bool bFollowsLeader = false;
+        FNavPathSharedPtr Path;
+    };
+
+    // One frame worth of path requests, solved together on a background thread
+    struct FPathBatch
+    {
+        TArray<FPathBatchQuery> Queries;
+        TArray<FPathBatchMember> Members;
+        int32 FallbackQueries = 0;
+        double FlushSeconds = 0.0;
+        double SolveSeconds = 0.0;
+    };
+
+    FIntPoint ToPathCell(const FVector& Location, float CellSize)
+    {
+        return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+    }
+
+    FNavPathSharedPtr FindPathForBatch(UNavigationSystemV1* NavSystem, const ANavigationData* NavData, const FSharedConstNavQueryFilter& QueryFilter, const FVector& StartLocation, const FVector& EndLocation)
+    {
+        FPathFindingQuery Query(nullptr, *NavData, StartLocation, EndLocation, QueryFilter);
+        Query.SetAllowPartialPaths(true);
+
+        FPathFindingResult PathResult = NavSystem->FindPathSync(Query, EPathFindingMode::Regular);
+        if (PathResult.IsSuccessful() && PathResult.Path.IsValid() && PathResult.Path->GetPathPoints().Num() > 1)
+        {
+            return PathResult.Path;
+        }
+        return nullptr;
+    }
+
+    // Reuses a solved path for a unit whose start/end differ slightly by swapping in its own endpoints.
+    // The swapped end can sit behind a wall even inside one dedup cell, so the last segment is always checked with a navmesh raycast;
+    // leader followers can start further away, so their first segment is checked as well.
+    FNavPathSharedPtr AdaptPathForMember(const FPathBatchQuery& Query, const FPathBatchMember& Member, const ANavigationData* NavData, const FSharedConstNavQueryFilter& QueryFilter)
+    {
+        if (Member.StartLocation.Equals(Query.StartLocation, 1.f) && Member.EndLocation.Equals(Query.EndLocation, 1.f))
+        {
+            return Query.Path;
+        }
+
+        const TArray<FNavPathPoint>& SourcePoints = Query.Path->GetPathPoints();
+        TArray<FVector> Points;
+        Points.Reserve(SourcePoints.Num());
+        for (const FNavPathPoint& Point : SourcePoints)
+        {
+            Points.Add(Point.Location);
+        }
+        Points[0] = Member.StartLocation;
+        Points.Last() = Member.EndLocation;
+
+        const int32 LastIndex = Points.Num() - 1;
+        FVector HitLocation;
+        if (Member.bFollowsLeader && NavData->Raycast(Points[0], Points[1], HitLocation, nullptr, QueryFilter))
+        {
+            return nullptr;
+        }
+        if ((LastIndex > 1 || !Member.bFollowsLeader) && NavData->Raycast(Points[LastIndex - 1], Points[LastIndex], HitLocation, nullptr, QueryFilter))
+        {
+            return nullptr;
+        }
+
+        return MakeShared<FNavigationPath, ESPMode::ThreadSafe>(Points);
+    }
+}
+
 UUnitMovementProcessor::UUnitMovementProcessor(): EntityQuery()
 {
     // Run BEFORE steering, avoidance, and movement integration
@@ -149,6 +258,8 @@ void UUnitMovementProcessor::Execute(FMassEntityManager& EntityManager, FMassExe
     {
         ExecuteServer(EntityManager, Context);
     }
+
+    FlushPathRequests();
 }
 
 void UUnitMovementProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
@@ -555,40 +666,174 @@ void UUnitMovementProcessor::ExecuteServer(FMassEntityManager& EntityManager, FM
 
 void UUnitMovementProcessor::RequestPathfindingAsync(FMassEntityHandle Entity, FVector StartLocation, FVector EndLocation)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    FPendingPathRequest& Request = PendingPathRequests.AddDefaulted_GetRef();
+    Request.Entity = Entity;
+    Request.StartLocation = StartLocation;
+    Request.EndLocation = EndLocation;
+    Request.RequestTime = FPlatformTime::Seconds();
+}
 
-    UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(World);
-    if (!NavSystem)
+void UUnitMovementProcessor::FlushPathRequests()
+{
+    if (PendingPathRequests.Num() == 0)
     {
-        ResetPathfindingFlagDeferred(Entity);
         return;
     }
 
-    ANavigationData* NavData = NavSystem->GetDefaultNavDataInstance(FNavigationSystem::ECreateIfEmpty::DontCreate);
+    QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitMovement_FlushPathRequests);
+    const double FlushStartTime = FPlatformTime::Seconds();
+
+    TArray<FPendingPathRequest> Requests = MoveTemp(PendingPathRequests);
+    PendingPathRequests.Reset();
+
+    UWorld* World = GetWorld();
+    UNavigationSystemV1* NavSystem = World ? UNavigationSystemV1::GetCurrent(World) : nullptr;
+    ANavigationData* NavData = NavSystem ? NavSystem->GetDefaultNavDataInstance(FNavigationSystem::ECreateIfEmpty::DontCreate) : nullptr;
     if (!NavData)
     {
-        ResetPathfindingFlagDeferred(Entity);
+        for (const FPendingPathRequest& Request : Requests)
+        {
+            ResetPathfindingFlagDeferred(Request.Entity);
+        }
         return;
     }
-    
+
     FSharedConstNavQueryFilter QueryFilter = NavData->GetQueryFilter(UNavigationQueryFilter::StaticClass());
 
+    const float DedupCellSize = FMath::Max(1.f, CVarRTS_Movement_PathDedupCellSize.GetValueOnGameThread());
+    const float GroupCellSize = FMath::Max(1.f, CVarRTS_Movement_PathGroupCellSize.GetValueOnGameThread());
+    const int32 GroupMinSize = CVarRTS_Movement_PathGroupMinSize.GetValueOnGameThread();
+    const float GroupRadiusSq = FMath::Square(CVarRTS_Movement_PathGroupRadius.GetValueOnGameThread());
+
+    TSharedRef<FPathBatch, ESPMode::ThreadSafe> Batch = MakeShared<FPathBatch, ESPMode::ThreadSafe>();
+    Batch->Members.Reserve(Requests.Num());
+
+    // Group by goal cell: a box-selected move order lands in one or a few groups
+    TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> GoalGroups;
+    for (int32 Idx = 0; Idx < Requests.Num(); ++Idx)
+    {
+        GoalGroups.FindOrAdd(ToPathCell(Requests[Idx].EndLocation, GroupCellSize)).Add(Idx);
+    }
+
+    // Identical (start cell, goal cell) pairs share one query
+    TMap<TPair<FIntPoint, FIntPoint>, int32> QueryByCells;
+    auto FindOrAddQuery = [&](const FPendingPathRequest& Request) -> int32
+    {
+        const TPair<FIntPoint, FIntPoint> Key(ToPathCell(Request.StartLocation, DedupCellSize), ToPathCell(Request.EndLocation, DedupCellSize));
+        if (const int32* Existing = QueryByCells.Find(Key))
+        {
+            return *Existing;
+        }
+        const int32 QueryIndex = Batch->Queries.AddDefaulted();
+        Batch->Queries[QueryIndex].StartLocation = Request.StartLocation;
+        Batch->Queries[QueryIndex].EndLocation = Request.EndLocation;
+        QueryByCells.Add(Key, QueryIndex);
+        return QueryIndex;
+    };
+
+    auto AddMember = [&](const FPendingPathRequest& Request, int32 QueryIndex, bool bFollowsLeader)
+    {
+        FPathBatchMember& Member = Batch->Members.AddDefaulted_GetRef();
+        Member.Entity = Request.Entity;
+        Member.StartLocation = Request.StartLocation;
+        Member.EndLocation = Request.EndLocation;
+        Member.RequestTime = Request.RequestTime;
+        Member.QueryIndex = QueryIndex;
+        Member.bFollowsLeader = bFollowsLeader;
+    };
+
+    for (const TPair<FIntPoint, TArray<int32, TInlineAllocator<8>>>& Group : GoalGroups)
+    {
+        const TArray<int32, TInlineAllocator<8>>& Indices = Group.Value;
+        if (GroupMinSize <= 0 || Indices.Num() < GroupMinSize)
+        {
+            for (const int32 Idx : Indices)
+            {
+                AddMember(Requests[Idx], FindOrAddQuery(Requests[Idx]), false);
+            }
+            continue;
+        }
+
+        // Large group: the unit closest to the group centre runs the query, nearby units follow its path
+        FVector Centroid = FVector::ZeroVector;
+        for (const int32 Idx : Indices)
+        {
+            Centroid += Requests[Idx].StartLocation;
+        }
+        Centroid /= Indices.Num();
+
+        int32 LeaderIdx = Indices[0];
+        float BestDistSq = TNumericLimits<float>::Max();
+        for (const int32 Idx : Indices)
+        {
+            const float DistSq = FVector::DistSquared2D(Requests[Idx].StartLocation, Centroid);
+            if (DistSq < BestDistSq)
+            {
+                BestDistSq = DistSq;
+                LeaderIdx = Idx;
+            }
+        }
+
+        const FPendingPathRequest& Leader = Requests[LeaderIdx];
+        const int32 LeaderQuery = FindOrAddQuery(Leader);
+        for (const int32 Idx : Indices)
+        {
+            const FPendingPathRequest& Request = Requests[Idx];
+            if (Idx == LeaderIdx)
+            {
+                AddMember(Request, LeaderQuery, false);
+            }
+            else if (FVector::DistSquared2D(Request.StartLocation, Leader.StartLocation) <= GroupRadiusSq)
+            {
+                AddMember(Request, LeaderQuery, true);
+            }
+            else
+            {
+                AddMember(Request, FindOrAddQuery(Request), false);
+            }
+        }
+    }
+
+    Batch->FlushSeconds = FPlatformTime::Seconds() - FlushStartTime;
+
+    const TWeakObjectPtr<UWorld> WeakWorld = World;
     const bool bClientWorld = World->IsNetMode(NM_Client);
     const bool bLog = bShowLogs;
+    const int32 ReportThreshold = CVarRTS_Movement_PathBatchReportThreshold.GetValueOnGameThread();
     AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
-        [NavSystem, NavData, QueryFilter, Entity, StartLocation, EndLocation, World, bClientWorld, bLog] () mutable
+        [NavSystem, NavData, QueryFilter, Batch, WeakWorld, bClientWorld, bLog, ReportThreshold] ()
     {
         // --- Runs on a Background Thread ---
-        FPathFindingQuery Query(nullptr, *NavData, StartLocation, EndLocation, QueryFilter);
-        Query.SetAllowPartialPaths(true);
+        QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitMovement_SolvePathBatch);
+        const double SolveStartTime = FPlatformTime::Seconds();
+
+        for (FPathBatchQuery& Query : Batch->Queries)
+        {
+            Query.Path = FindPathForBatch(NavSystem, NavData, QueryFilter, Query.StartLocation, Query.EndLocation);
+        }
+
+        for (FPathBatchMember& Member : Batch->Members)
+        {
+            const FPathBatchQuery& Query = Batch->Queries[Member.QueryIndex];
+            if (Query.Path.IsValid())
+            {
+                Member.Path = AdaptPathForMember(Query, Member, NavData, QueryFilter);
+            }
+            if (!Member.Path.IsValid() && Query.Path.IsValid())
+            {
+                // Shared corridor is not reachable in a straight line from this unit's start or end; query on its own
+                ++Batch->FallbackQueries;
+                Member.Path = FindPathForBatch(NavSystem, NavData, QueryFilter, Member.StartLocation, Member.EndLocation);
+            }
+        }
+
+        Batch->SolveSeconds = FPlatformTime::Seconds() - SolveStartTime;
 
-        FPathFindingResult PathResult = NavSystem->FindPathSync(Query, EPathFindingMode::Regular);
-        
         AsyncTask(ENamedThreads::GameThread,
-            [Entity, PathResult, World, EndLocation, bClientWorld, bLog]() mutable
+            [Batch, WeakWorld, bClientWorld, bLog, ReportThreshold]()
         {
             // --- Runs back on the Game Thread ---
+            UWorld* World = WeakWorld.Get();
             if (!World) return;
 
             UMassEntitySubsystem* EntitySubsystem = World->GetSubsystem<UMassEntitySubsystem>();
@@ -596,53 +841,76 @@ void UUnitMovementProcessor::RequestPathfindingAsync(FMassEntityHandle Entity, F
 
             FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-            if (!EntityManager.IsEntityValid(Entity))
-            {
-                return;
-            }
-
             EntityManager.Defer().PushCommand<FMassDeferredSetCommand>(
-                [Entity, PathResult, EndLocation, bClientWorld, bLog](FMassEntityManager& System)
+                [Batch, bClientWorld, bLog, ReportThreshold](FMassEntityManager& System)
                 {
                     // This lambda now runs at a safe time.
-                    if (FUnitNavigationPathFragment* PathFrag = System.GetFragmentDataPtr<FUnitNavigationPathFragment>(Entity))
+                    const double ApplyTime = FPlatformTime::Seconds();
+                    double TotalLatency = 0.0;
+                    double MaxLatency = 0.0;
+                    int32 Applied = 0;
+
+                    for (const FPathBatchMember& Member : Batch->Members)
                     {
+                        if (!System.IsEntityValid(Member.Entity))
+                        {
+                            continue;
+                        }
+
+                        FUnitNavigationPathFragment* PathFrag = System.GetFragmentDataPtr<FUnitNavigationPathFragment>(Member.Entity);
+                        if (!PathFrag)
+                        {
+                            continue;
+                        }
+
                         PathFrag->bIsPathfindingInProgress = false; // Reset flag regardless of success/failure
 
+                        const double Latency = ApplyTime - Member.RequestTime;
+                        TotalLatency += Latency;
+                        MaxLatency = FMath::Max(MaxLatency, Latency);
+
                         // Drop stale results if target changed (compare in XY only, ignore Z disparities)
-                        const bool bTargetChanged = FVector::DistSquared2D(PathFrag->PathTargetLocation, EndLocation) > FMath::Square(1.f);
+                        const bool bTargetChanged = FVector::DistSquared2D(PathFrag->PathTargetLocation, Member.EndLocation) > FMath::Square(1.f);
                         if (bTargetChanged)
                         {
                             if (bClientWorld && bLog)
                             {
                                 UE_LOG(LogTemp, Warning, TEXT("[Client][UnitMovement] Dropping stale path result (target changed) TargetNow=%s Requested=%s"),
-                                    *PathFrag->PathTargetLocation.ToString(), *EndLocation.ToString());
+                                    *PathFrag->PathTargetLocation.ToString(), *Member.EndLocation.ToString());
                             }
-                            return; // do not apply
+                            continue; // do not apply
                         }
 
-                        if (PathResult.IsSuccessful() && PathResult.Path.IsValid() && PathResult.Path->GetPathPoints().Num() > 1)
+                        if (Member.Path.IsValid())
                         {
-                            const int32 NumPts = PathResult.Path->GetPathPoints().Num();
                             if (bClientWorld && bLog)
                             {
-                                UE_LOG(LogTemp, Warning, TEXT("[Client][UnitMovement] Path result: SUCCESS points=%d"), NumPts);
+                                UE_LOG(LogTemp, Warning, TEXT("[Client][UnitMovement] Path result: SUCCESS points=%d"), Member.Path->GetPathPoints().Num());
                             }
-                            PathFrag->CurrentPath = PathResult.Path;
+                            PathFrag->CurrentPath = Member.Path;
                             PathFrag->CurrentPathPointIndex = 1;
+                            ++Applied;
                         }
                         else
                         {
                             if (bClientWorld && bLog)
                             {
-                                UE_LOG(LogTemp, Warning, TEXT("[Client][UnitMovement] Path result: FAIL (IsSuccessful=%d, Valid=%d, Points=%d)"),
-                                    PathResult.IsSuccessful() ? 1 : 0,
-                                    PathResult.Path.IsValid() ? 1 : 0,
-                                    PathResult.Path.IsValid() ? PathResult.Path->GetPathPoints().Num() : 0);
+                                UE_LOG(LogTemp, Warning, TEXT("[Client][UnitMovement] Path result: FAIL"));
                             }
                             PathFrag->ResetPath();
                         }
                     }
+
+                    // Mass orders: report how long units waited and what the batch cost
+                    if (ReportThreshold > 0 && Batch->Members.Num() >= ReportThreshold)
+                    {
+                        UE_LOG(LogTemp, Log, TEXT("[UnitMovement] Path batch: Requests=%d Queries=%d Fallbacks=%d Applied=%d LatencyAvg=%.2fms LatencyMax=%.2fms GroupCPU=%.2fms SolveCPU=%.2fms"),
+                            Batch->Members.Num(), Batch->Queries.Num(), Batch->FallbackQueries, Applied,
+                            Batch->Members.Num() > 0 ? (TotalLatency / Batch->Members.Num()) * 1000.0 : 0.0,
+                            MaxLatency * 1000.0,
+                            Batch->FlushSeconds * 1000.0,
+                            Batch->SolveSeconds * 1000.0);
+                    }
                 });
         });
     });
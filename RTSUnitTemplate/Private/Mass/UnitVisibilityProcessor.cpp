@@ -0,0 +1,151 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/UnitVisibilityProcessor.h"
+
+#include "MassExecutionContext.h"
+#include "MassEntityManager.h"
+#include "MassCommonFragments.h"
+#include "MassActorSubsystem.h"
+#include "Mass/UnitMassTag.h"
+#include "Characters/Unit/PerformanceUnit.h"
+#include "Controller/PlayerController/ControllerBase.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/GameViewportClient.h"
+#include "SceneView.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_Visibility_UseProcessor(
+	TEXT("net.RTS.Visibility.UseProcessor"),
+	1,
+	TEXT("1 = unit viewport/fog visibility is computed by UUnitVisibilityProcessor, 0 = every APerformanceUnit checks itself in Tick."),
+	ECVF_Default);
+
+namespace
+{
+	/** View projection of the local player for one frame, relative to the view origin to keep float precision. */
+	struct FUnitViewportTest
+	{
+		FMatrix44f TranslatedViewProjection = FMatrix44f::Identity;
+		FVector ViewOrigin = FVector::ZeroVector;
+		FIntRect ViewRect;
+		FVector2f ViewportSize = FVector2f::ZeroVector;
+		bool bValid = false;
+
+		bool Initialize(UWorld* World)
+		{
+			APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+			ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+			if (!LocalPlayer || !LocalPlayer->ViewportClient)
+			{
+				return false;
+			}
+
+			FSceneViewProjectionData ProjectionData;
+			if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+			{
+				return false;
+			}
+
+			int32 SizeX = 0, SizeY = 0;
+			PlayerController->GetViewportSize(SizeX, SizeY);
+
+			TranslatedViewProjection = FMatrix44f(ProjectionData.ViewRotationMatrix * ProjectionData.ProjectionMatrix);
+			ViewOrigin = ProjectionData.ViewOrigin;
+			ViewRect = ProjectionData.GetConstrainedViewRect();
+			ViewportSize = FVector2f(SizeX, SizeY);
+			bValid = true;
+			return true;
+		}
+
+		// Same result as UGameplayStatics::ProjectWorldToScreen followed by the APerformanceUnit::IsInViewport rect test
+		bool IsOnScreen(const FVector& WorldPosition, float Offset) const
+		{
+			const FVector3f Relative(WorldPosition - ViewOrigin);
+			const VectorRegister4Float Clip = VectorTransformVector(VectorLoadFloat3_W1(&Relative), &TranslatedViewProjection);
+
+			float ClipValues[4];
+			VectorStore(Clip, ClipValues);
+			if (ClipValues[3] <= 0.f)
+			{
+				return false;
+			}
+
+			const float RHW = 1.f / ClipValues[3];
+			const float ScreenX = ViewRect.Min.X + (ClipValues[0] * RHW * 0.5f + 0.5f) * ViewRect.Width();
+			const float ScreenY = ViewRect.Min.Y + (0.5f - ClipValues[1] * RHW * 0.5f) * ViewRect.Height();
+
+			return ScreenX >= -Offset && ScreenX <= ViewportSize.X + Offset &&
+				ScreenY >= -Offset && ScreenY <= ViewportSize.Y + Offset;
+		}
+	};
+}
+
+UUnitVisibilityProcessor::UUnitVisibilityProcessor()
+	: EntityQuery()
+{
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone | EProcessorExecutionFlags::Client);
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	bAutoRegisterWithProcessingPhases = true;
+	bRequiresGameThreadExecution = true;
+}
+
+bool UUnitVisibilityProcessor::IsEnabled()
+{
+	return CVarRTS_Visibility_UseProcessor.GetValueOnGameThread() > 0;
+}
+
+void UUnitVisibilityProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.Initialize(EntityManager);
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassActorFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FMassUnitVisibilityFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddTagRequirement<FUnitMassTag>(EMassFragmentPresence::All);
+	EntityQuery.RegisterWithProcessor(*this);
+}
+
+void UUnitVisibilityProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitVisibilityProcessor_Execute);
+
+	UWorld* World = EntityManager.GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Without a local player (dedicated server) nothing is on screen, as in the old per-actor check
+	FUnitViewportTest ViewportTest;
+	ViewportTest.Initialize(World);
+
+	int32 LocalTeamId = INDEX_NONE;
+	if (const AControllerBase* ControllerBase = Cast<AControllerBase>(World->GetFirstPlayerController()))
+	{
+		LocalTeamId = ControllerBase->SelectableTeamId;
+	}
+
+	EntityQuery.ForEachEntityChunk(Context, [&ViewportTest, LocalTeamId](FMassExecutionContext& ChunkContext)
+	{
+		const int32 NumEntities = ChunkContext.GetNumEntities();
+		const TConstArrayView<FTransformFragment> TransformList = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TArrayView<FMassActorFragment> ActorList = ChunkContext.GetMutableFragmentView<FMassActorFragment>();
+		const TArrayView<FMassUnitVisibilityFragment> VisibilityList = ChunkContext.GetMutableFragmentView<FMassUnitVisibilityFragment>();
+
+		for (int32 i = 0; i < NumEntities; ++i)
+		{
+			APerformanceUnit* Unit = Cast<APerformanceUnit>(ActorList[i].GetMutable());
+			if (!Unit)
+			{
+				continue;
+			}
+
+			const bool bOnViewport = ViewportTest.bValid && ViewportTest.IsOnScreen(TransformList[i].GetTransform().GetLocation(), Unit->VisibilityOffset);
+			const bool bMyTeam = LocalTeamId != INDEX_NONE && (LocalTeamId == Unit->TeamId || LocalTeamId == 0);
+
+			Unit->ApplyProcessorVisibility(bOnViewport, bMyTeam, VisibilityList[i]);
+		}
+	});
+}
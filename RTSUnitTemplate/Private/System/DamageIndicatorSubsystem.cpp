@@ -0,0 +1,209 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "System/DamageIndicatorSubsystem.h"
+
+#include "Actors/IndicatorActor.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_DamageIndicator_PoolSize(
+	TEXT("net.RTS.DamageIndicator.PoolSize"),
+	64,
+	TEXT("Maximum number of damage indicator actors kept alive. When all are in use the oldest one is recycled."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_DamageIndicator_MaxNewPerFrame(
+	TEXT("net.RTS.DamageIndicator.MaxNewPerFrame"),
+	16,
+	TEXT("Maximum number of new damage indicators shown per frame. Hits on the local player's units are shown first."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRTS_DamageIndicator_MergeWindow(
+	TEXT("net.RTS.DamageIndicator.MergeWindow"),
+	0.3f,
+	TEXT("Seconds during which further hits on the same target are added to the indicator already shown."),
+	ECVF_Default);
+
+void UDamageIndicatorSubsystem::Deinitialize()
+{
+	PendingRequests.Empty();
+	ActiveByTarget.Empty();
+	FreeIndicators.Empty();
+	ActiveIndicators.Empty();
+	NumPooledIndicators = 0;
+	Super::Deinitialize();
+}
+
+TStatId UDamageIndicatorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDamageIndicatorSubsystem, STATGROUP_Tickables);
+}
+
+void UDamageIndicatorSubsystem::RequestIndicator(AActor* Target, TSubclassOf<AIndicatorActor> IndicatorClass, const FVector& Location, float Damage,
+	FLinearColor HighColor, FLinearColor LowColor, float ColorOffset, bool bLocalTeam)
+{
+	if (!Target || !IndicatorClass || Damage <= 0.f)
+	{
+		return;
+	}
+
+	// Several hits on one target within a frame become one request
+	for (FDamageIndicatorRequest& Pending : PendingRequests)
+	{
+		if (Pending.Target == Target && Pending.IndicatorClass == IndicatorClass)
+		{
+			Pending.Damage += Damage;
+			return;
+		}
+	}
+
+	FDamageIndicatorRequest& Request = PendingRequests.AddDefaulted_GetRef();
+	Request.Target = Target;
+	Request.IndicatorClass = IndicatorClass;
+	Request.Location = Location;
+	Request.Damage = Damage;
+	Request.HighColor = HighColor;
+	Request.LowColor = LowColor;
+	Request.ColorOffset = ColorOffset;
+	Request.bLocalTeam = bLocalTeam;
+}
+
+void UDamageIndicatorSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingRequests.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_DamageIndicatorSubsystem_Flush);
+
+	UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	const float MergeWindow = CVarRTS_DamageIndicator_MergeWindow.GetValueOnGameThread();
+	int32 NewBudget = FMath::Max(0, CVarRTS_DamageIndicator_MaxNewPerFrame.GetValueOnGameThread());
+
+	// Local team first, then the biggest numbers
+	PendingRequests.Sort([](const FDamageIndicatorRequest& A, const FDamageIndicatorRequest& B)
+	{
+		if (A.bLocalTeam != B.bLocalTeam)
+		{
+			return A.bLocalTeam;
+		}
+		return A.Damage > B.Damage;
+	});
+
+	for (const FDamageIndicatorRequest& Request : PendingRequests)
+	{
+		if (!Request.Target.IsValid())
+		{
+			continue;
+		}
+
+		if (FActiveDamageIndicator* Active = ActiveByTarget.Find(Request.Target))
+		{
+			AIndicatorActor* Indicator = Active->Indicator.Get();
+			if (Indicator && !Indicator->IsHidden() && Indicator->GetClass() == Request.IndicatorClass.Get() && Now - Active->StartTime <= MergeWindow)
+			{
+				Indicator->AddPooledDamage(Request.Damage);
+				continue;
+			}
+			ActiveByTarget.Remove(Request.Target);
+		}
+
+		if (NewBudget <= 0)
+		{
+			continue;
+		}
+
+		AIndicatorActor* Indicator = AcquireIndicator(Request.IndicatorClass);
+		if (!Indicator)
+		{
+			continue;
+		}
+		--NewBudget;
+
+		Indicator->ActivatePooled(Request.Location, Request.Damage, Request.HighColor, Request.LowColor, Request.ColorOffset);
+		ActiveIndicators.Add(Indicator);
+
+		FActiveDamageIndicator& Active = ActiveByTarget.Add(Request.Target);
+		Active.Indicator = Indicator;
+		Active.StartTime = Now;
+	}
+
+	PendingRequests.Reset();
+}
+
+AIndicatorActor* UDamageIndicatorSubsystem::AcquireIndicator(TSubclassOf<AIndicatorActor> IndicatorClass)
+{
+	TArray<TWeakObjectPtr<AIndicatorActor>>& Free = FreeIndicators.FindOrAdd(IndicatorClass.Get());
+	while (Free.Num() > 0)
+	{
+		if (AIndicatorActor* Indicator = Free.Pop(EAllowShrinking::No).Get())
+		{
+			return Indicator;
+		}
+		--NumPooledIndicators;
+	}
+
+	if (NumPooledIndicators < FMath::Max(1, CVarRTS_DamageIndicator_PoolSize.GetValueOnGameThread()))
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_DamageIndicatorSubsystem_SpawnIndicator);
+
+		UWorld* World = GetWorld();
+		if (!World)
+		{
+			return nullptr;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		AIndicatorActor* Indicator = World->SpawnActor<AIndicatorActor>(IndicatorClass, FTransform::Identity, SpawnParams);
+		if (Indicator)
+		{
+			Indicator->bPooled = true;
+			++NumPooledIndicators;
+		}
+		return Indicator;
+	}
+
+	// Pool exhausted: take over the oldest indicator of the same class that is still shown
+	for (int32 Index = 0; Index < ActiveIndicators.Num(); ++Index)
+	{
+		AIndicatorActor* Indicator = ActiveIndicators[Index].Get();
+		if (Indicator && Indicator->GetClass() == IndicatorClass.Get())
+		{
+			ActiveIndicators.RemoveAt(Index);
+			RemoveActiveByTarget(Indicator);
+			return Indicator;
+		}
+	}
+	return nullptr;
+}
+
+void UDamageIndicatorSubsystem::ReleaseIndicator(AIndicatorActor* Indicator)
+{
+	if (!Indicator)
+	{
+		return;
+	}
+
+	Indicator->DeactivatePooled();
+	ActiveIndicators.RemoveSingle(Indicator);
+	RemoveActiveByTarget(Indicator);
+	FreeIndicators.FindOrAdd(Indicator->GetClass()).Add(Indicator);
+}
+
+void UDamageIndicatorSubsystem::RemoveActiveByTarget(const AIndicatorActor* Indicator)
+{
+	// Also drops entries whose target or indicator is gone, so dead targets do not pile up
+	for (auto It = ActiveByTarget.CreateIterator(); It; ++It)
+	{
+		const AIndicatorActor* Active = It.Value().Indicator.Get();
+		if (Active == Indicator || !Active || !It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
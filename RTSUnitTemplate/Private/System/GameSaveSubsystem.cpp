@@ -28,6 +28,9 @@
 #include "GAS/GameplayAbilityBase.h"
 #include "Controller/PlayerController/CustomControllerBase.h"
 #include "Characters/Unit/GASUnit.h"
+#include "GameModes/RTSGameModeBase.h"
+#include "GameModes/ResourceGameMode.h"
+#include "System/UnitAttributeSyncSubsystem.h"
 
 void UGameSaveSubsystem::SaveCurrentGame(const FString& SlotName)
 {
@@ -438,6 +441,15 @@ void UGameSaveSubsystem::ApplyLoadedData(UWorld* LoadedWorld, URTSSaveGame* Save
         // Team/Selektierbarkeit anwenden
         Unit->TeamId = SavedUnit.TeamId;
         Unit->CanBeSelected = SavedUnit.bIsSelectable;
+        if (ARTSGameModeBase* GM = Cast<ARTSGameModeBase>(LoadedWorld->GetAuthGameMode()))
+        {
+            GM->RefreshAliveUnit(Unit);
+        }
+        // Worker registered itself in BeginPlay under its old team; recount it under the loaded one
+        if (AResourceGameMode* ResourceGM = Cast<AResourceGameMode>(LoadedWorld->GetAuthGameMode()))
+        {
+            ResourceGM->UpdateWorkerAssignment(Unit);
+        }
 
         // Zustand anwenden
         Unit->UnitStatePlaceholder = SavedUnit.UnitStatePlaceholder;
@@ -485,6 +497,7 @@ void UGameSaveSubsystem::ApplyLoadedData(UWorld* LoadedWorld, URTSSaveGame* Save
             if (LevelUnitForAttr->Attributes)
             {
                 LevelUnitForAttr->Attributes->UpdateAttributes(SavedUnit.AttributeSaveData);
+                UUnitAttributeSyncSubsystem::RequestFullSync(LevelUnitForAttr);
             }
         }
 
@@ -671,7 +684,7 @@ void UGameSaveSubsystem::ApplyLoadedData(UWorld* LoadedWorld, URTSSaveGame* Save
         // Properties
         WA->Tag = SavedWA.Tag;
         WA->TeamId = SavedWA.TeamId;
-        WA->IsNoBuildZone = SavedWA.IsNoBuildZone;
+        WA->SetIsNoBuildZone(SavedWA.IsNoBuildZone);
         WA->Type = SavedWA.Type;
 
         if (UClass* WR = SavedWA.WorkResourceClass.IsValid() ? SavedWA.WorkResourceClass.TryLoadClass<AWorkResource>() : nullptr)
@@ -0,0 +1,89 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "System/GroundTraceSubsystem.h"
+
+#include "Characters/Unit/UnitBase.h"
+#include "Actors/WorkArea.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+void UGroundTraceSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+	bTracking = false;
+	IgnoredActors.Empty();
+	SimpleParams.ClearIgnoredActors();
+	ComplexParams.ClearIgnoredActors();
+	Super::Deinitialize();
+}
+
+bool UGroundTraceSubsystem::IsIgnored(const AActor* Actor)
+{
+	return Actor && (Actor->IsA<AUnitBase>() || Actor->IsA<AWorkArea>());
+}
+
+void UGroundTraceSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (IsIgnored(Actor))
+	{
+		IgnoredActors.Add(Actor);
+		bParamsDirty = true;
+	}
+}
+
+void UGroundTraceSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	if (IsIgnored(Actor))
+	{
+		IgnoredActors.RemoveSwap(Actor);
+		bParamsDirty = true;
+	}
+}
+
+void UGroundTraceSubsystem::EnsureTracking()
+{
+	UWorld* World = GetWorld();
+	if (bTracking || !World) return;
+
+	// One world scan, afterwards the list only follows spawns and destroys
+	bTracking = true;
+	for (TActorIterator<AUnitBase> It(World); It; ++It)
+	{
+		IgnoredActors.Add(*It);
+	}
+	for (TActorIterator<AWorkArea> It(World); It; ++It)
+	{
+		IgnoredActors.Add(*It);
+	}
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UGroundTraceSubsystem::OnActorSpawned));
+	ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UGroundTraceSubsystem::OnActorDestroyed));
+	bParamsDirty = true;
+}
+
+const FCollisionQueryParams& UGroundTraceSubsystem::GetIgnoreParams(bool bTraceComplex)
+{
+	EnsureTracking();
+
+	if (bParamsDirty)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_GroundTrace_RebuildIgnores);
+
+		bParamsDirty = false;
+		SimpleParams = FCollisionQueryParams(SCENE_QUERY_STAT(UnitControllerGroundTrace), false);
+		ComplexParams = FCollisionQueryParams(SCENE_QUERY_STAT(UnitControllerGroundTrace), true);
+		for (const TWeakObjectPtr<AActor>& Actor : IgnoredActors)
+		{
+			if (Actor.IsValid())
+			{
+				SimpleParams.AddIgnoredActor(Actor.Get());
+				ComplexParams.AddIgnoredActor(Actor.Get());
+			}
+		}
+	}
+
+	return bTraceComplex ? ComplexParams : SimpleParams;
+}
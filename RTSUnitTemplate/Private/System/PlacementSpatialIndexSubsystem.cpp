@@ -0,0 +1,322 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "System/PlacementSpatialIndexSubsystem.h"
+
+#include "Actors/WorkArea.h"
+#include "Characters/Unit/BuildingBase.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queries"), STAT_RTSPlacement_Queries, STATGROUP_RTSPlacement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Candidates"), STAT_RTSPlacement_Candidates, STATGROUP_RTSPlacement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reindexed Actors"), STAT_RTSPlacement_Reindexed, STATGROUP_RTSPlacement);
+
+static TAutoConsoleVariable<int32> CVarRTS_Placement_SpatialIndex(
+	TEXT("net.RTS.Placement.SpatialIndex"),
+	1,
+	TEXT("1 = work area placement and snapping query UPlacementSpatialIndexSubsystem for nearby work areas / buildings, 0 = they iterate all of them in the world."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRTS_Placement_GridCellSize(
+	TEXT("net.RTS.Placement.GridCellSize"),
+	1000.f,
+	TEXT("Cell size (uu) of the work area / building placement grid. Read when the index is first used in a world."),
+	ECVF_Default);
+
+namespace
+{
+	// XY radius around the actor location that holds everything placement code measures against
+	float ComputeFootprintRadius(const AActor* Actor)
+	{
+		const FVector2D Location(Actor->GetActorLocation());
+
+		// Buildings snap by their capsule, centered on the actor (GetActorBoundsForSnap in ExtendedControllerBase.cpp)
+		if (const ABuildingBase* Building = Cast<ABuildingBase>(Actor))
+		{
+			if (const UCapsuleComponent* Capsule = Building->FindComponentByClass<UCapsuleComponent>())
+			{
+				return Capsule->GetScaledCapsuleRadius();
+			}
+		}
+
+		// Component bounds cover anything a trace can hit, the snap mesh of work areas is added explicitly
+		FBox Box = Actor->GetComponentsBoundingBox(/*bNonColliding=*/true);
+		if (const AWorkArea* WorkArea = Cast<AWorkArea>(Actor))
+		{
+			if (WorkArea->Mesh)
+			{
+				Box += WorkArea->Mesh->CalcBounds(WorkArea->Mesh->GetComponentTransform()).GetBox();
+			}
+		}
+		if (!Box.IsValid)
+		{
+			return 0.f;
+		}
+
+		// Beyond the farthest XY corner of the box, and beyond a circle of the largest half extent of any box inside it
+		const FVector Extent = Box.GetExtent();
+		return FVector2D::Distance(FVector2D(Box.GetCenter()), Location) + Extent.X + Extent.Y;
+	}
+}
+
+UPlacementSpatialIndexSubsystem* UPlacementSpatialIndexSubsystem::GetIfEnabled(const UWorld* World)
+{
+	if (!World || CVarRTS_Placement_SpatialIndex.GetValueOnGameThread() <= 0)
+	{
+		return nullptr;
+	}
+
+	UPlacementSpatialIndexSubsystem* Subsystem = World->GetSubsystem<UPlacementSpatialIndexSubsystem>();
+	if (Subsystem)
+	{
+		Subsystem->EnsureTracking();
+	}
+	return Subsystem;
+}
+
+void UPlacementSpatialIndexSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+	for (const TPair<TObjectKey<AActor>, TWeakObjectPtr<USceneComponent>>& Pair : BoundRoots)
+	{
+		if (USceneComponent* Root = Pair.Value.Get())
+		{
+			Root->TransformUpdated.RemoveAll(this);
+		}
+	}
+	bTracking = false;
+
+	BoundRoots.Empty();
+	PendingActors.Empty();
+	DirtyActors.Empty();
+	WorkAreaIndex.Reset();
+	BuildingIndex.Reset();
+	NoBuildZones.Empty();
+	Super::Deinitialize();
+}
+
+void UPlacementSpatialIndexSubsystem::EnsureTracking()
+{
+	UWorld* World = GetWorld();
+	if (bTracking || !World)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlacementSpatialIndex_InitialScan);
+
+	// One world scan, afterwards the indices only follow spawns, destroys and root transform updates
+	bTracking = true;
+	const float CellSize = FMath::Max(100.f, CVarRTS_Placement_GridCellSize.GetValueOnGameThread());
+	WorkAreaIndex.SetCellSize(CellSize);
+	BuildingIndex.SetCellSize(CellSize);
+	for (TActorIterator<AWorkArea> It(World); It; ++It)
+	{
+		AddActor(*It);
+	}
+	for (TActorIterator<ABuildingBase> It(World); It; ++It)
+	{
+		AddActor(*It);
+	}
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UPlacementSpatialIndexSubsystem::OnActorSpawned));
+	ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UPlacementSpatialIndexSubsystem::OnActorDestroyed));
+}
+
+bool UPlacementSpatialIndexSubsystem::IsTracked(const AActor* Actor)
+{
+	return Actor && (Actor->IsA<AWorkArea>() || Actor->IsA<ABuildingBase>());
+}
+
+void UPlacementSpatialIndexSubsystem::AddActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	if (AWorkArea* WorkArea = Cast<AWorkArea>(Actor))
+	{
+		if (WorkAreaIndex.Contains(WorkArea))
+		{
+			return;
+		}
+		WorkAreaIndex.Add(WorkArea, ComputeFootprintRadius(WorkArea));
+		RefreshNoBuildZone(WorkArea);
+	}
+	else if (ABuildingBase* Building = Cast<ABuildingBase>(Actor))
+	{
+		if (BuildingIndex.Contains(Building))
+		{
+			return;
+		}
+		BuildingIndex.Add(Building, ComputeFootprintRadius(Building));
+	}
+	else
+	{
+		return;
+	}
+
+	if (USceneComponent* Root = Actor->GetRootComponent())
+	{
+		Root->TransformUpdated.AddUObject(this, &UPlacementSpatialIndexSubsystem::OnRootTransformUpdated);
+		BoundRoots.Add(Actor, Root);
+	}
+}
+
+void UPlacementSpatialIndexSubsystem::RemoveActor(AActor* Actor)
+{
+	if (AWorkArea* WorkArea = Cast<AWorkArea>(Actor))
+	{
+		WorkAreaIndex.Remove(WorkArea);
+		NoBuildZones.Remove(WorkArea);
+	}
+	else if (ABuildingBase* Building = Cast<ABuildingBase>(Actor))
+	{
+		BuildingIndex.Remove(Building);
+	}
+	else
+	{
+		return;
+	}
+
+	TWeakObjectPtr<USceneComponent> Root;
+	if (BoundRoots.RemoveAndCopyValue(Actor, Root) && Root.IsValid())
+	{
+		Root->TransformUpdated.RemoveAll(this);
+	}
+}
+
+void UPlacementSpatialIndexSubsystem::OnActorSpawned(AActor* Actor)
+{
+	// Deferred spawns register their components later; index on the next query
+	if (IsTracked(Actor))
+	{
+		PendingActors.Add(Actor);
+	}
+}
+
+void UPlacementSpatialIndexSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	RemoveActor(Actor);
+}
+
+void UPlacementSpatialIndexSubsystem::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (UpdatedComponent)
+	{
+		DirtyActors.Add(UpdatedComponent->GetOwner());
+	}
+}
+
+void UPlacementSpatialIndexSubsystem::FlushDirtyActors()
+{
+	if (PendingActors.Num() > 0)
+	{
+		TArray<TWeakObjectPtr<AActor>> Spawned = MoveTemp(PendingActors);
+		PendingActors.Reset();
+		for (const TWeakObjectPtr<AActor>& Actor : Spawned)
+		{
+			AddActor(Actor.Get());
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& WeakActor : DirtyActors)
+	{
+		AActor* Actor = WeakActor.Get();
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		// Update keeps the actor's place in registration order
+		bool bReindexed = false;
+		if (AWorkArea* WorkArea = Cast<AWorkArea>(Actor))
+		{
+			bReindexed = WorkAreaIndex.Update(WorkArea, ComputeFootprintRadius(WorkArea));
+		}
+		else if (ABuildingBase* Building = Cast<ABuildingBase>(Actor))
+		{
+			bReindexed = BuildingIndex.Update(Building, ComputeFootprintRadius(Building));
+		}
+		if (bReindexed)
+		{
+			INC_DWORD_STAT(STAT_RTSPlacement_Reindexed);
+		}
+	}
+	DirtyActors.Reset();
+}
+
+void UPlacementSpatialIndexSubsystem::RefreshNoBuildZone(AWorkArea* WorkArea)
+{
+	if (WorkArea->IsNoBuildZone)
+	{
+		NoBuildZones.AddUnique(WorkArea);
+	}
+	else
+	{
+		NoBuildZones.Remove(WorkArea);
+	}
+}
+
+void UPlacementSpatialIndexSubsystem::NotifyNoBuildZoneChanged(AWorkArea* WorkArea)
+{
+	// Work areas not indexed yet pick the flag up when they are added
+	if (bTracking && WorkArea && WorkAreaIndex.Contains(WorkArea))
+	{
+		RefreshNoBuildZone(WorkArea);
+	}
+}
+
+void UPlacementSpatialIndexSubsystem::GatherWorkAreasInRadius(const FVector& Location, float Radius, TArray<AWorkArea*>& OutWorkAreas)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlacementSpatialIndex_GatherWorkAreas);
+
+	FlushDirtyActors();
+	const int32 NumBefore = OutWorkAreas.Num();
+	WorkAreaIndex.GatherInRadius(Location, Radius, OutWorkAreas);
+	INC_DWORD_STAT(STAT_RTSPlacement_Queries);
+	INC_DWORD_STAT_BY(STAT_RTSPlacement_Candidates, OutWorkAreas.Num() - NumBefore);
+}
+
+void UPlacementSpatialIndexSubsystem::GatherBuildingsInRadius(const FVector& Location, float Radius, TArray<ABuildingBase*>& OutBuildings)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlacementSpatialIndex_GatherBuildings);
+
+	FlushDirtyActors();
+	const int32 NumBefore = OutBuildings.Num();
+	BuildingIndex.GatherInRadius(Location, Radius, OutBuildings);
+	INC_DWORD_STAT(STAT_RTSPlacement_Queries);
+	INC_DWORD_STAT_BY(STAT_RTSPlacement_Candidates, OutBuildings.Num() - NumBefore);
+}
+
+void UPlacementSpatialIndexSubsystem::GatherWorkAreasAlongSegment(const FVector& Start, const FVector& End, TArray<AWorkArea*>& OutWorkAreas)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_PlacementSpatialIndex_GatherWorkAreasAlongSegment);
+
+	FlushDirtyActors();
+	const int32 NumBefore = OutWorkAreas.Num();
+	WorkAreaIndex.GatherAlongSegment(Start, End, OutWorkAreas);
+	INC_DWORD_STAT(STAT_RTSPlacement_Queries);
+	INC_DWORD_STAT_BY(STAT_RTSPlacement_Candidates, OutWorkAreas.Num() - NumBefore);
+}
+
+bool UPlacementSpatialIndexSubsystem::HasNoBuildZone(const AWorkArea* Ignored)
+{
+	FlushDirtyActors();
+
+	for (const TWeakObjectPtr<AWorkArea>& WeakWorkArea : NoBuildZones)
+	{
+		const AWorkArea* WorkArea = WeakWorkArea.Get();
+		if (WorkArea && WorkArea != Ignored && IsValid(WorkArea) && WorkArea->IsNoBuildZone)
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,287 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "System/UnitAttributeSyncSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "MassEntitySubsystem.h"
+#include "Characters/Unit/UnitBase.h"
+#include "GAS/AttributeSetBase.h"
+#include "Mass/MassActorBindingComponent.h"
+#include "Mass/UnitMassTag.h"
+
+DECLARE_STATS_GROUP(TEXT("RTS Attribute Sync"), STATGROUP_RTSAttributeSync, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attribute Changes Queued"), STAT_RTSAttributeSync_ChangesQueued, STATGROUP_RTSAttributeSync);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Units Synced"), STAT_RTSAttributeSync_UnitsSynced, STATGROUP_RTSAttributeSync);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Full Syncs"), STAT_RTSAttributeSync_FullSyncs, STATGROUP_RTSAttributeSync);
+
+static TAutoConsoleVariable<int32> CVarRTS_Sync_AttributeDriven(
+	TEXT("net.RTS.Sync.AttributeDriven"),
+	1,
+	TEXT("1 = combat stats in the Mass fragment are updated from attribute change events, 0 = every SyncUnitBase signal copies all attributes."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_Sync_ValidateAttributes(
+	TEXT("net.RTS.Sync.ValidateAttributes"),
+	0,
+	TEXT("When 1, every unit drained by the attribute sync compares its whole Mass combat stats fragment against the GAS attributes and logs mismatches."),
+	ECVF_Default);
+
+namespace
+{
+	constexpr uint16 FullSyncMask = (1u << static_cast<uint16>(EUnitSyncedAttribute::Num)) - 1u;
+
+	uint16 AttributeBit(EUnitSyncedAttribute Attribute)
+	{
+		return static_cast<uint16>(1u << static_cast<uint16>(Attribute));
+	}
+}
+
+bool UUnitAttributeSyncSubsystem::IsEnabled()
+{
+	return CVarRTS_Sync_AttributeDriven.GetValueOnAnyThread() > 0;
+}
+
+void UUnitAttributeSyncSubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<AUnitBase>, FRegisteredUnit>& Pair : RegisteredUnits)
+	{
+		UnbindUnit(Pair.Value);
+	}
+	RegisteredUnits.Empty();
+	PendingChanges.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UUnitAttributeSyncSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUnitAttributeSyncSubsystem, STATGROUP_Tickables);
+}
+
+void UUnitAttributeSyncSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	Flush();
+}
+
+FGameplayAttribute UUnitAttributeSyncSubsystem::GetGameplayAttribute(EUnitSyncedAttribute Attribute)
+{
+	switch (Attribute)
+	{
+	case EUnitSyncedAttribute::Health:          return UAttributeSetBase::GetHealthAttribute();
+	case EUnitSyncedAttribute::Shield:          return UAttributeSetBase::GetShieldAttribute();
+	case EUnitSyncedAttribute::MaxHealth:       return UAttributeSetBase::GetMaxHealthAttribute();
+	case EUnitSyncedAttribute::AttackDamage:    return UAttributeSetBase::GetAttackDamageAttribute();
+	case EUnitSyncedAttribute::Range:           return UAttributeSetBase::GetRangeAttribute();
+	case EUnitSyncedAttribute::RunSpeed:        return UAttributeSetBase::GetRunSpeedAttribute();
+	case EUnitSyncedAttribute::Armor:           return UAttributeSetBase::GetArmorAttribute();
+	case EUnitSyncedAttribute::MagicResistance: return UAttributeSetBase::GetMagicResistanceAttribute();
+	default:                                    return FGameplayAttribute();
+	}
+}
+
+void UUnitAttributeSyncSubsystem::RegisterUnit(AUnitBase* Unit)
+{
+	if (!IsValid(Unit))
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* ASC = Unit->GetAbilitySystemComponent();
+	if (!ASC)
+	{
+		return;
+	}
+
+	FRegisteredUnit& Registered = RegisteredUnits.FindOrAdd(Unit);
+	if (Registered.ASC.Get() == ASC)
+	{
+		return;
+	}
+
+	UnbindUnit(Registered);
+	Registered.ASC = ASC;
+
+	TWeakObjectPtr<AUnitBase> WeakUnit(Unit);
+	for (int32 Index = 0; Index < static_cast<int32>(EUnitSyncedAttribute::Num); ++Index)
+	{
+		const EUnitSyncedAttribute Attribute = static_cast<EUnitSyncedAttribute>(Index);
+		Registered.Handles[Index] = ASC->GetGameplayAttributeValueChangeDelegate(GetGameplayAttribute(Attribute))
+			.AddWeakLambda(this, [this, WeakUnit, Attribute](const FOnAttributeChangeData&)
+			{
+				if (AUnitBase* ChangedUnit = WeakUnit.Get())
+				{
+					QueueAttributeChange(ChangedUnit, Attribute);
+				}
+			});
+	}
+
+	QueueFullSync(Unit);
+}
+
+void UUnitAttributeSyncSubsystem::UnregisterUnit(AUnitBase* Unit)
+{
+	FRegisteredUnit Registered;
+	if (RegisteredUnits.RemoveAndCopyValue(Unit, Registered))
+	{
+		UnbindUnit(Registered);
+	}
+}
+
+void UUnitAttributeSyncSubsystem::UnbindUnit(FRegisteredUnit& Registered)
+{
+	if (UAbilitySystemComponent* ASC = Registered.ASC.Get())
+	{
+		for (int32 Index = 0; Index < static_cast<int32>(EUnitSyncedAttribute::Num); ++Index)
+		{
+			ASC->GetGameplayAttributeValueChangeDelegate(GetGameplayAttribute(static_cast<EUnitSyncedAttribute>(Index))).Remove(Registered.Handles[Index]);
+			Registered.Handles[Index].Reset();
+		}
+	}
+	Registered.ASC.Reset();
+}
+
+void UUnitAttributeSyncSubsystem::QueueAttributeChange(AUnitBase* Unit, EUnitSyncedAttribute Attribute)
+{
+	if (!Unit)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_RTSAttributeSync_ChangesQueued);
+	PendingChanges.Enqueue({ Unit, AttributeBit(Attribute) });
+}
+
+void UUnitAttributeSyncSubsystem::QueueFullSync(AUnitBase* Unit)
+{
+	if (!Unit)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_RTSAttributeSync_FullSyncs);
+	PendingChanges.Enqueue({ Unit, FullSyncMask });
+}
+
+void UUnitAttributeSyncSubsystem::RequestFullSync(AActor* UnitActor)
+{
+	AUnitBase* Unit = Cast<AUnitBase>(UnitActor);
+	if (!Unit || !IsEnabled())
+	{
+		return;
+	}
+
+	if (UUnitAttributeSyncSubsystem* AttributeSync = Unit->GetWorld() ? Unit->GetWorld()->GetSubsystem<UUnitAttributeSyncSubsystem>() : nullptr)
+	{
+		// Load and level-up also (re)register, e.g. units whose ability system was not ready at spawn
+		AttributeSync->RegisterUnit(Unit);
+		AttributeSync->QueueFullSync(Unit);
+	}
+}
+
+void UUnitAttributeSyncSubsystem::ApplyToFragment(AUnitBase* Unit, uint16 DirtyMask, FMassCombatStatsFragment& CombatStats)
+{
+	const UAttributeSetBase* AttributeSet = Unit->Attributes;
+
+	auto IsDirty = [DirtyMask](EUnitSyncedAttribute Attribute)
+	{
+		return (DirtyMask & AttributeBit(Attribute)) != 0;
+	};
+
+	// Same mapping as SynchronizeStatsFromActorToFragment
+	if (IsDirty(EUnitSyncedAttribute::Health))          { CombatStats.Health = AttributeSet->GetHealth(); }
+	if (IsDirty(EUnitSyncedAttribute::Shield))          { CombatStats.Shield = AttributeSet->GetShield(); }
+	if (IsDirty(EUnitSyncedAttribute::MaxHealth))       { CombatStats.MaxHealth = AttributeSet->GetMaxHealth(); CombatStats.MaxShield = AttributeSet->GetMaxHealth(); }
+	if (IsDirty(EUnitSyncedAttribute::AttackDamage))    { CombatStats.AttackDamage = AttributeSet->GetAttackDamage(); }
+	if (IsDirty(EUnitSyncedAttribute::Range))           { CombatStats.AttackRange = AttributeSet->GetRange(); }
+	if (IsDirty(EUnitSyncedAttribute::RunSpeed))        { CombatStats.RunSpeed = AttributeSet->GetRunSpeed(); }
+	if (IsDirty(EUnitSyncedAttribute::Armor))           { CombatStats.Armor = AttributeSet->GetArmor(); }
+	if (IsDirty(EUnitSyncedAttribute::MagicResistance)) { CombatStats.MagicResistance = AttributeSet->GetMagicResistance(); }
+}
+
+void UUnitAttributeSyncSubsystem::Flush()
+{
+	if (PendingChanges.IsEmpty())
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitAttributeSyncSubsystem_Flush);
+
+	// Merge all changes of the frame into one dirty mask per unit
+	TMap<TObjectKey<AUnitBase>, int32> PendingIndexByUnit;
+	TArray<FPendingAttributeSync> Merged;
+
+	FPendingAttributeSync Change;
+	while (PendingChanges.Dequeue(Change))
+	{
+		const TObjectKey<AUnitBase> Key(Change.Unit.Get());
+		if (const int32* Index = PendingIndexByUnit.Find(Key))
+		{
+			Merged[*Index].DirtyMask |= Change.DirtyMask;
+		}
+		else
+		{
+			PendingIndexByUnit.Add(Key, Merged.Add(Change));
+		}
+	}
+
+	UMassEntitySubsystem* EntitySubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMassEntitySubsystem>() : nullptr;
+	if (!EntitySubsystem)
+	{
+		return;
+	}
+
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+
+	for (const FPendingAttributeSync& Pending : Merged)
+	{
+		AUnitBase* Unit = Pending.Unit.Get();
+		if (!IsValid(Unit) || !Unit->Attributes || !Unit->MassActorBindingComponent)
+		{
+			continue;
+		}
+
+		const FMassEntityHandle Entity = Unit->MassActorBindingComponent->GetEntityHandle();
+		if (!EntityManager.IsEntityValid(Entity))
+		{
+			continue;
+		}
+
+		if (FMassCombatStatsFragment* CombatStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Entity))
+		{
+			INC_DWORD_STAT(STAT_RTSAttributeSync_UnitsSynced);
+			ApplyToFragment(Unit, Pending.DirtyMask, *CombatStats);
+
+			if (CVarRTS_Sync_ValidateAttributes.GetValueOnGameThread() != 0)
+			{
+				ValidateFragment(Unit, *CombatStats);
+			}
+		}
+	}
+}
+
+void UUnitAttributeSyncSubsystem::ValidateFragment(AUnitBase* Unit, const FMassCombatStatsFragment& CombatStats)
+{
+	// Reference is a full copy, the way SynchronizeStatsFromActorToFragment fills the fragment
+	FMassCombatStatsFragment Reference = CombatStats;
+	ApplyToFragment(Unit, FullSyncMask, Reference);
+
+	auto Check = [Unit](const TCHAR* Name, float Synced, float Expected)
+	{
+		if (!FMath::IsNearlyEqual(Synced, Expected, 0.01f))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[AttributeSync] %s mismatch on %s: %.2f vs %.2f (fragment vs attributes)"),
+				Name, *Unit->GetName(), Synced, Expected);
+		}
+	};
+
+	Check(TEXT("Health"), CombatStats.Health, Reference.Health);
+	Check(TEXT("Shield"), CombatStats.Shield, Reference.Shield);
+	Check(TEXT("MaxHealth"), CombatStats.MaxHealth, Reference.MaxHealth);
+	Check(TEXT("MaxShield"), CombatStats.MaxShield, Reference.MaxShield);
+	Check(TEXT("AttackDamage"), CombatStats.AttackDamage, Reference.AttackDamage);
+	Check(TEXT("AttackRange"), CombatStats.AttackRange, Reference.AttackRange);
+	Check(TEXT("RunSpeed"), CombatStats.RunSpeed, Reference.RunSpeed);
+	Check(TEXT("Armor"), CombatStats.Armor, Reference.Armor);
+	Check(TEXT("MagicResistance"), CombatStats.MagicResistance, Reference.MagicResistance);
+}
@@ -0,0 +1,157 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "System/UnitSpatialQuerySubsystem.h"
+
+#include "Characters/Unit/UnitBase.h"
+#include "GameModes/RTSGameModeBase.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<float> CVarRTS_Detection_GridCellSize(
+	TEXT("net.RTS.Detection.GridCellSize"),
+	1000.f,
+	TEXT("Cell size (uu) of the per team unit grid used by actor AI detection queries."),
+	ECVF_Default);
+
+void UUnitSpatialQuerySubsystem::Deinitialize()
+{
+	TeamGrids.Empty();
+	ScratchResults.Empty();
+	Super::Deinitialize();
+}
+
+void UUnitSpatialQuerySubsystem::RebuildIfNeeded()
+{
+	if (LastBuildFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastBuildFrame = GFrameCounter;
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitSpatialQuery_Rebuild);
+
+	CellSize = FMath::Max(50.f, CVarRTS_Detection_GridCellSize.GetValueOnGameThread());
+
+	// Keep the per team allocations alive between frames
+	for (auto& Pair : TeamGrids)
+	{
+		Pair.Value.Entries.Reset();
+		Pair.Value.CellRanges.Reset();
+	}
+
+	UWorld* World = GetWorld();
+	ARTSGameModeBase* RTSGameMode = World ? Cast<ARTSGameModeBase>(World->GetAuthGameMode()) : nullptr;
+	if (!RTSGameMode)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < RTSGameMode->AllUnits.Num(); i++)
+	{
+		AUnitBase* Unit = Cast<AUnitBase>(RTSGameMode->AllUnits[i]);
+		if (!IsValid(Unit))
+		{
+			continue;
+		}
+
+		FUnitSpatialEntry& Entry = TeamGrids.FindOrAdd(Unit->TeamId).Entries.AddDefaulted_GetRef();
+		Entry.Unit = Unit;
+		Entry.Location = Unit->GetActorLocation();
+		Entry.SourceIndex = i;
+		Entry.bIsFlying = Unit->IsFlying;
+		Entry.bIsInvisible = Unit->bIsInvisible;
+		Entry.bIsDead = Unit->GetUnitState() == UnitData::Dead;
+	}
+
+	for (auto& Pair : TeamGrids)
+	{
+		FTeamUnitGrid& Grid = Pair.Value;
+		Grid.Entries.Sort([this](const FUnitSpatialEntry& A, const FUnitSpatialEntry& B)
+		{
+			const FIntPoint CellA = ToCell(A.Location);
+			const FIntPoint CellB = ToCell(B.Location);
+			return CellA.X != CellB.X ? CellA.X < CellB.X : CellA.Y < CellB.Y;
+		});
+
+		for (int32 Idx = 0; Idx < Grid.Entries.Num(); ++Idx)
+		{
+			FIntPoint& Range = Grid.CellRanges.FindOrAdd(ToCell(Grid.Entries[Idx].Location), FIntPoint(Idx, 0));
+			Range.Y++;
+		}
+	}
+}
+
+void UUnitSpatialQuerySubsystem::QueryUnitsInRadius(const FVector& Center, float Radius, const FUnitDetectionFilter& Filter, TArray<AActor*>& OutUnits)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitSpatialQuery_QueryUnitsInRadius);
+
+	RebuildIfNeeded();
+
+	ScratchResults.Reset();
+	const float RadiusSq = FMath::Square(Radius);
+	const FIntPoint MinCell = ToCell(Center - FVector(Radius));
+	const FIntPoint MaxCell = ToCell(Center + FVector(Radius));
+	const int64 NumCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	for (const auto& Pair : TeamGrids)
+	{
+		const bool bSameTeam = Pair.Key == Filter.TeamId;
+		if (bSameTeam != Filter.bFriendly)
+		{
+			continue;
+		}
+
+		const FTeamUnitGrid& Grid = Pair.Value;
+		auto VisitRange = [&](const FIntPoint& Range)
+		{
+			for (int32 Idx = Range.X; Idx < Range.X + Range.Y; ++Idx)
+			{
+				const FUnitSpatialEntry& Entry = Grid.Entries[Idx];
+				if (FVector::DistSquared(Center, Entry.Location) > RadiusSq) continue;
+				if (Entry.bIsDead) continue;
+				if (Entry.bIsInvisible && !Filter.bCanDetectInvisible) continue;
+				if (Filter.bOnlyGround && Entry.bIsFlying) continue;
+				if (Filter.bOnlyFlying && !Entry.bIsFlying) continue;
+				// Units can die after the snapshot was taken this frame
+				if (!IsValid(Entry.Unit) || Entry.Unit->GetUnitState() == UnitData::Dead) continue;
+
+				ScratchResults.Add(&Entry);
+			}
+		};
+
+		// Huge radii touch more cells than the team has occupied ones; walk the occupied cells instead
+		if (NumCells > Grid.CellRanges.Num())
+		{
+			for (const auto& CellPair : Grid.CellRanges)
+			{
+				if (CellPair.Key.X >= MinCell.X && CellPair.Key.X <= MaxCell.X && CellPair.Key.Y >= MinCell.Y && CellPair.Key.Y <= MaxCell.Y)
+				{
+					VisitRange(CellPair.Value);
+				}
+			}
+		}
+		else
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+				{
+					if (const FIntPoint* Range = Grid.CellRanges.Find(FIntPoint(X, Y)))
+					{
+						VisitRange(*Range);
+					}
+				}
+			}
+		}
+	}
+
+	ScratchResults.Sort([](const FUnitSpatialEntry& A, const FUnitSpatialEntry& B)
+	{
+		return A.SourceIndex < B.SourceIndex;
+	});
+
+	OutUnits.Reserve(OutUnits.Num() + ScratchResults.Num());
+	for (const FUnitSpatialEntry* Entry : ScratchResults)
+	{
+		OutUnits.Emplace(Entry->Unit);
+	}
+}
@@ -0,0 +1,514 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "System/UnitTweenSubsystem.h"
+
+#include "Characters/Unit/MassUnitBase.h"
+#include "Characters/Unit/UnitBase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+DECLARE_STATS_GROUP(TEXT("RTS Unit Tweens"), STATGROUP_RTSUnitTween, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Tweens"), STAT_RTSUnitTween_ActiveTweens, STATGROUP_RTSUnitTween);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ISM Instance Writes"), STAT_RTSUnitTween_InstanceWrites, STATGROUP_RTSUnitTween);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ISM Render State Updates"), STAT_RTSUnitTween_RenderStateUpdates, STATGROUP_RTSUnitTween);
+
+static TAutoConsoleVariable<int32> CVarRTS_Tween_UseScheduler(
+	TEXT("net.RTS.Tween.UseScheduler"),
+	1,
+	TEXT("1 = cosmetic unit tweens (rotate, move, scale, pulsate, yaw follow) are advanced by UUnitTweenSubsystem in one pass per frame, 0 = one looping timer per actor and tween kind."),
+	ECVF_Default);
+
+namespace
+{
+	// Same alpha mapping as the per-actor tween steps in AMassUnitBase
+	float GetEasedAlpha(float Elapsed, float Duration, float EaseExp)
+	{
+		float Alpha = (Duration > 0.f) ? FMath::Clamp(Elapsed / Duration, 0.f, 1.f) : 1.f;
+		if (!FMath::IsNearlyEqual(EaseExp, 1.f))
+		{
+			Alpha = FMath::Pow(Alpha, EaseExp);
+		}
+		return Alpha;
+	}
+}
+
+FUnitTweenTarget FUnitTweenTarget::MakeISMInstance(AMassUnitBase* InOwner, UInstancedStaticMeshComponent* InISM, int32 InInstanceIndex)
+{
+	FUnitTweenTarget Target;
+	Target.Owner = InOwner;
+	Target.Component = InISM;
+	Target.InstanceIndex = InInstanceIndex;
+	Target.Type = EUnitTweenTargetType::ISMInstance;
+	return Target;
+}
+
+FUnitTweenTarget FUnitTweenTarget::MakeComponent(AMassUnitBase* InOwner, USceneComponent* InComponent)
+{
+	FUnitTweenTarget Target;
+	Target.Owner = InOwner;
+	Target.Component = InComponent;
+	Target.Type = EUnitTweenTargetType::Component;
+	return Target;
+}
+
+FUnitTweenTarget FUnitTweenTarget::MakeActor(AMassUnitBase* InOwner)
+{
+	FUnitTweenTarget Target;
+	Target.Owner = InOwner;
+	Target.Type = EUnitTweenTargetType::Actor;
+	return Target;
+}
+
+FUnitTweenKey::FUnitTweenKey(const FUnitTweenTarget& Target)
+	: InstanceIndex(Target.Type == EUnitTweenTargetType::ISMInstance ? Target.InstanceIndex : INDEX_NONE)
+{
+	if (Target.Type == EUnitTweenTargetType::Actor)
+	{
+		Object = Target.Owner;
+	}
+	else
+	{
+		Object = Target.Component;
+	}
+}
+
+bool UUnitTweenSubsystem::IsEnabled()
+{
+	return CVarRTS_Tween_UseScheduler.GetValueOnGameThread() > 0;
+}
+
+void UUnitTweenSubsystem::Deinitialize()
+{
+	RotationTweens.Reset();
+	LocationTweens.Reset();
+	ScaleTweens.Reset();
+	PulsateTweens.Reset();
+	SpinTweens.Reset();
+	YawFollows.Reset();
+	PendingInstanceWrites.Empty();
+	PendingInstanceIndexByKey.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UUnitTweenSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUnitTweenSubsystem, STATGROUP_Tickables);
+}
+
+int32 UUnitTweenSubsystem::GetNumActiveTweens() const
+{
+	return RotationTweens.Num() + LocationTweens.Num() + ScaleTweens.Num() + PulsateTweens.Num() + SpinTweens.Num() + YawFollows.Num();
+}
+
+void UUnitTweenSubsystem::StartRotation(const FUnitTweenTarget& Target, const FQuat& Start, const FQuat& End, float Duration, float EaseExp, bool bTeleport)
+{
+	FUnitRotationTween& Tween = RotationTweens.FindOrAdd(Target);
+	Tween.Start = Start.GetNormalized();
+	Tween.End = End.GetNormalized();
+	// Shortest-arc interpolation: q and -q represent the same rotation
+	if ((Tween.Start | Tween.End) < 0.f)
+	{
+		Tween.End = -Tween.End;
+	}
+	Tween.Duration = Duration;
+	Tween.Elapsed = 0.f;
+	Tween.EaseExp = FMath::Max(EaseExp, 0.001f);
+	Tween.bTeleport = bTeleport;
+}
+
+void UUnitTweenSubsystem::StartLocation(const FUnitTweenTarget& Target, const FVector& Start, const FVector& End, float Duration, float EaseExp)
+{
+	FUnitVectorTween& Tween = LocationTweens.FindOrAdd(Target);
+	Tween.Start = Start;
+	Tween.End = End;
+	Tween.Duration = Duration;
+	Tween.Elapsed = 0.f;
+	Tween.EaseExp = FMath::Max(EaseExp, 0.001f);
+}
+
+void UUnitTweenSubsystem::StartScale(const FUnitTweenTarget& Target, const FVector& Start, const FVector& End, float Duration, float EaseExp)
+{
+	FUnitVectorTween& Tween = ScaleTweens.FindOrAdd(Target);
+	Tween.Start = Start;
+	Tween.End = End;
+	Tween.Duration = Duration;
+	Tween.Elapsed = 0.f;
+	Tween.EaseExp = FMath::Max(EaseExp, 0.001f);
+}
+
+void UUnitTweenSubsystem::StartPulsate(const FUnitTweenTarget& Target, const FVector& MinScale, const FVector& MaxScale, float HalfPeriod)
+{
+	FUnitPulsateTween& Tween = PulsateTweens.FindOrAdd(Target);
+	Tween.MinScale = MinScale;
+	Tween.MaxScale = MaxScale;
+	Tween.HalfPeriod = FMath::Max(HalfPeriod, 0.0001f);
+	Tween.Elapsed = 0.f;
+}
+
+void UUnitTweenSubsystem::StartSpin(const FUnitTweenTarget& Target, float YawRate)
+{
+	SpinTweens.FindOrAdd(Target).YawRate = YawRate;
+}
+
+void UUnitTweenSubsystem::StartYawFollow(const FUnitTweenTarget& Target, float Duration, float EaseExp, float OffsetDegrees, bool bTeleport)
+{
+	FUnitYawFollow& Follow = YawFollows.FindOrAdd(Target);
+	Follow.Duration = Duration;
+	Follow.EaseExp = FMath::Max(EaseExp, 0.001f);
+	Follow.OffsetDegrees = OffsetDegrees;
+	Follow.bTeleport = bTeleport;
+}
+
+void UUnitTweenSubsystem::RemoveTweensForOwner(const AMassUnitBase* Owner)
+{
+	RotationTweens.RemoveOwner(Owner);
+	LocationTweens.RemoveOwner(Owner);
+	ScaleTweens.RemoveOwner(Owner);
+	PulsateTweens.RemoveOwner(Owner);
+	SpinTweens.RemoveOwner(Owner);
+	YawFollows.RemoveOwner(Owner);
+}
+
+bool UUnitTweenSubsystem::IsTargetValid(const FUnitTweenTarget& Target)
+{
+	if (!Target.Owner.IsValid())
+	{
+		return false;
+	}
+
+	switch (Target.Type)
+	{
+	case EUnitTweenTargetType::ISMInstance:
+		{
+			const UInstancedStaticMeshComponent* ISM = Cast<UInstancedStaticMeshComponent>(Target.Component.Get());
+			return ISM && ISM->IsValidInstance(Target.InstanceIndex);
+		}
+	case EUnitTweenTargetType::Component:
+		return Target.Component.IsValid();
+	default:
+		return true;
+	}
+}
+
+void UUnitTweenSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SET_DWORD_STAT(STAT_RTSUnitTween_ActiveTweens, GetNumActiveTweens());
+
+	if (GetNumActiveTweens() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitTweenSubsystem_Tick);
+
+	// Follows only retarget rotation tweens, so they run first and the new tweens advance this frame
+	UpdateYawFollows();
+	AdvanceRotations(DeltaTime);
+	AdvanceVectors(LocationTweens, DeltaTime, false);
+	AdvanceVectors(ScaleTweens, DeltaTime, true);
+	AdvancePulsates(DeltaTime);
+	AdvanceSpins(DeltaTime);
+
+	FlushInstanceWrites();
+}
+
+void UUnitTweenSubsystem::UpdateYawFollows()
+{
+	for (int32 Index = 0; Index < YawFollows.Num();)
+	{
+		const FUnitYawFollow& Follow = YawFollows.Tweens[Index];
+		if (!IsTargetValid(Follow.Target))
+		{
+			YawFollows.RemoveAt(Index);
+			continue;
+		}
+		++Index;
+
+		AMassUnitBase* Owner = Follow.Target.Owner.Get();
+		FVector WorldLocation = FVector::ZeroVector;
+		FQuat CurrentRotation = FQuat::Identity;
+		float ParentYaw = 0.f;
+
+		switch (Follow.Target.Type)
+		{
+		case EUnitTweenTargetType::ISMInstance:
+			{
+				const UInstancedStaticMeshComponent* ISM = CastChecked<UInstancedStaticMeshComponent>(Follow.Target.Component.Get());
+				FTransform InstanceTransform;
+				ISM->GetInstanceTransform(Follow.Target.InstanceIndex, InstanceTransform, /*bWorldSpace*/ true);
+				WorldLocation = InstanceTransform.GetLocation();
+				ISM->GetInstanceTransform(Follow.Target.InstanceIndex, InstanceTransform, /*bWorldSpace*/ false);
+				CurrentRotation = InstanceTransform.GetRotation();
+				if (const USceneComponent* Parent = ISM->GetAttachParent())
+				{
+					ParentYaw = Parent->GetComponentRotation().Yaw;
+				}
+				break;
+			}
+		case EUnitTweenTargetType::Component:
+			{
+				const USceneComponent* Component = Follow.Target.Component.Get();
+				WorldLocation = Component->GetComponentLocation();
+				CurrentRotation = Component->GetRelativeRotation().Quaternion();
+				if (const USceneComponent* Parent = Component->GetAttachParent())
+				{
+					ParentYaw = Parent->GetComponentRotation().Yaw;
+				}
+				break;
+			}
+		case EUnitTweenTargetType::Actor:
+			WorldLocation = Owner->GetActorLocation();
+			CurrentRotation = Owner->GetActorQuat();
+			break;
+		}
+
+		const AUnitBase* OwnerUnit = Cast<AUnitBase>(Owner);
+		const AUnitBase* TargetUnit = OwnerUnit ? OwnerUnit->UnitToChase : nullptr;
+		float DesiredYaw = Follow.OffsetDegrees;
+
+		if (IsValid(TargetUnit))
+		{
+			FVector ToTarget = TargetUnit->GetActorLocation() - WorldLocation;
+			ToTarget.Z = 0.f;
+			if (ToTarget.IsNearlyZero(1e-3f))
+			{
+				continue;
+			}
+
+			const float DesiredWorldYaw = FRotator::NormalizeAxis(FRotationMatrix::MakeFromX(ToTarget.GetSafeNormal()).Rotator().Yaw + Follow.OffsetDegrees);
+			DesiredYaw = FRotator::NormalizeAxis(DesiredWorldYaw - ParentYaw);
+		}
+
+		FRotator NewRotation = CurrentRotation.Rotator();
+		NewRotation.Yaw = DesiredYaw;
+
+		StartRotation(Follow.Target, CurrentRotation, NewRotation.Quaternion(), Follow.Duration, Follow.EaseExp, Follow.bTeleport);
+	}
+}
+
+void UUnitTweenSubsystem::AdvanceRotations(float DeltaTime)
+{
+	for (int32 Index = 0; Index < RotationTweens.Num();)
+	{
+		FUnitRotationTween& Tween = RotationTweens.Tweens[Index];
+		if (!IsTargetValid(Tween.Target))
+		{
+			RotationTweens.RemoveAt(Index);
+			continue;
+		}
+
+		Tween.Elapsed += DeltaTime;
+		const float Alpha = GetEasedAlpha(Tween.Elapsed, Tween.Duration, Tween.EaseExp);
+
+		if (Alpha >= 1.f)
+		{
+			// Snap exactly to the final orientation to avoid accumulated numeric error
+			ApplyRotation(Tween.Target, Tween.End, Tween.bTeleport);
+			RotationTweens.RemoveAt(Index);
+			continue;
+		}
+
+		ApplyRotation(Tween.Target, FQuat::Slerp(Tween.Start, Tween.End, Alpha).GetNormalized(), Tween.bTeleport);
+		++Index;
+	}
+}
+
+void UUnitTweenSubsystem::AdvanceVectors(TUnitTweenList<FUnitVectorTween>& List, float DeltaTime, bool bScale)
+{
+	for (int32 Index = 0; Index < List.Num();)
+	{
+		FUnitVectorTween& Tween = List.Tweens[Index];
+		if (!IsTargetValid(Tween.Target))
+		{
+			List.RemoveAt(Index);
+			continue;
+		}
+
+		Tween.Elapsed += DeltaTime;
+		const float Alpha = GetEasedAlpha(Tween.Elapsed, Tween.Duration, Tween.EaseExp);
+		const bool bFinished = Alpha >= 1.f;
+		const FVector Value = bFinished ? Tween.End : FMath::Lerp(Tween.Start, Tween.End, Alpha);
+
+		if (bScale)
+		{
+			ApplyScale(Tween.Target, Value);
+		}
+		else
+		{
+			ApplyLocation(Tween.Target, Value);
+		}
+
+		if (bFinished)
+		{
+			List.RemoveAt(Index);
+			continue;
+		}
+		++Index;
+	}
+}
+
+void UUnitTweenSubsystem::AdvancePulsates(float DeltaTime)
+{
+	for (int32 Index = 0; Index < PulsateTweens.Num();)
+	{
+		FUnitPulsateTween& Tween = PulsateTweens.Tweens[Index];
+		if (!IsTargetValid(Tween.Target))
+		{
+			PulsateTweens.RemoveAt(Index);
+			continue;
+		}
+
+		Tween.Elapsed += DeltaTime;
+
+		// Ping-pong alpha in [0,1] with a half-period of HalfPeriod
+		float Mod = FMath::Fmod(Tween.Elapsed / Tween.HalfPeriod, 2.f);
+		if (Mod < 0.f) Mod += 2.f;
+		const float Alpha = (Mod <= 1.f) ? Mod : (2.f - Mod);
+
+		ApplyScale(Tween.Target, FMath::Lerp(Tween.MinScale, Tween.MaxScale, Alpha));
+		++Index;
+	}
+}
+
+void UUnitTweenSubsystem::AdvanceSpins(float DeltaTime)
+{
+	for (int32 Index = 0; Index < SpinTweens.Num();)
+	{
+		const FUnitSpinTween& Tween = SpinTweens.Tweens[Index];
+		if (!IsTargetValid(Tween.Target))
+		{
+			SpinTweens.RemoveAt(Index);
+			continue;
+		}
+
+		FQuat Current = FQuat::Identity;
+		switch (Tween.Target.Type)
+		{
+		case EUnitTweenTargetType::ISMInstance:
+			Current = GetPendingInstanceTransform(Tween.Target, false).GetRotation();
+			break;
+		case EUnitTweenTargetType::Component:
+			Current = Tween.Target.Component->GetRelativeRotation().Quaternion();
+			break;
+		case EUnitTweenTargetType::Actor:
+			Current = Tween.Target.Owner->GetActorQuat();
+			break;
+		}
+
+		FRotator NewRotation = Current.Rotator();
+		NewRotation.Yaw = FRotator::NormalizeAxis(NewRotation.Yaw + Tween.YawRate * DeltaTime);
+		ApplyRotation(Tween.Target, NewRotation.Quaternion(), false);
+		++Index;
+	}
+}
+
+void UUnitTweenSubsystem::ApplyRotation(const FUnitTweenTarget& Target, const FQuat& Rotation, bool bTeleport)
+{
+	switch (Target.Type)
+	{
+	case EUnitTweenTargetType::ISMInstance:
+		GetPendingInstanceTransform(Target, bTeleport).SetRotation(Rotation);
+		break;
+	case EUnitTweenTargetType::Component:
+		Target.Component->SetRelativeRotation(Rotation.Rotator(), /*bSweep*/ false, nullptr, ETeleportType::TeleportPhysics);
+		break;
+	case EUnitTweenTargetType::Actor:
+		{
+			AMassUnitBase* Owner = Target.Owner.Get();
+			Owner->SetActorRotation(Rotation.Rotator());
+			Owner->SyncRotation();
+			break;
+		}
+	}
+}
+
+void UUnitTweenSubsystem::ApplyLocation(const FUnitTweenTarget& Target, const FVector& Location)
+{
+	switch (Target.Type)
+	{
+	case EUnitTweenTargetType::ISMInstance:
+		GetPendingInstanceTransform(Target, false).SetLocation(Location);
+		break;
+	case EUnitTweenTargetType::Component:
+		Target.Component->SetRelativeLocation(Location, /*bSweep*/ false, nullptr, ETeleportType::TeleportPhysics);
+		break;
+	case EUnitTweenTargetType::Actor:
+		{
+			AMassUnitBase* Owner = Target.Owner.Get();
+			Owner->SetActorLocation(Location, false, nullptr, ETeleportType::TeleportPhysics);
+			Owner->SyncTranslation();
+			break;
+		}
+	}
+}
+
+void UUnitTweenSubsystem::ApplyScale(const FUnitTweenTarget& Target, const FVector& Scale)
+{
+	switch (Target.Type)
+	{
+	case EUnitTweenTargetType::ISMInstance:
+		GetPendingInstanceTransform(Target, false).SetScale3D(Scale);
+		break;
+	case EUnitTweenTargetType::Component:
+		Target.Component->SetRelativeScale3D(Scale);
+		break;
+	case EUnitTweenTargetType::Actor:
+		Target.Owner->SetActorScale3D(Scale);
+		break;
+	}
+}
+
+FTransform& UUnitTweenSubsystem::GetPendingInstanceTransform(const FUnitTweenTarget& Target, bool bTeleport)
+{
+	const FUnitTweenKey Key(Target);
+	if (const int32* Index = PendingInstanceIndexByKey.Find(Key))
+	{
+		FPendingInstanceWrite& Write = PendingInstanceWrites[*Index];
+		Write.bTeleport |= bTeleport;
+		return Write.Transform;
+	}
+
+	UInstancedStaticMeshComponent* ISM = CastChecked<UInstancedStaticMeshComponent>(Target.Component.Get());
+
+	FPendingInstanceWrite& Write = PendingInstanceWrites.AddDefaulted_GetRef();
+	Write.Component = ISM;
+	Write.InstanceIndex = Target.InstanceIndex;
+	Write.bTeleport = bTeleport;
+	ISM->GetInstanceTransform(Target.InstanceIndex, Write.Transform, /*bWorldSpace*/ false);
+	PendingInstanceIndexByKey.Add(Key, PendingInstanceWrites.Num() - 1);
+	return Write.Transform;
+}
+
+void UUnitTweenSubsystem::FlushInstanceWrites()
+{
+	if (PendingInstanceWrites.Num() == 0)
+	{
+		return;
+	}
+
+	// All channels of an instance were combined above, so every instance is written once and
+	// every component updates its render state once per frame
+	TSet<UInstancedStaticMeshComponent*> DirtyComponents;
+	for (const FPendingInstanceWrite& Write : PendingInstanceWrites)
+	{
+		UInstancedStaticMeshComponent* ISM = Write.Component.Get();
+		if (!ISM || !ISM->IsValidInstance(Write.InstanceIndex))
+		{
+			continue;
+		}
+
+		ISM->UpdateInstanceTransform(Write.InstanceIndex, Write.Transform, /*bWorldSpace*/ false, /*bMarkRenderStateDirty*/ false, Write.bTeleport);
+		DirtyComponents.Add(ISM);
+		INC_DWORD_STAT(STAT_RTSUnitTween_InstanceWrites);
+	}
+
+	for (UInstancedStaticMeshComponent* ISM : DirtyComponents)
+	{
+		ISM->MarkRenderStateDirty();
+		INC_DWORD_STAT(STAT_RTSUnitTween_RenderStateUpdates);
+	}
+
+	PendingInstanceWrites.Reset();
+	PendingInstanceIndexByKey.Reset();
+}
@@ -0,0 +1,194 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "System/UnitUIUpdateSubsystem.h"
+
+#include "Characters/Unit/UnitBase.h"
+#include "GAS/AttributeSetBase.h"
+
+DECLARE_STATS_GROUP(TEXT("RTS Unit UI"), STATGROUP_RTSUnitUI, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Widget Update Requests"), STAT_RTSUnitUI_WidgetUpdateRequests, STATGROUP_RTSUnitUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Widget Updates"), STAT_RTSUnitUI_WidgetUpdates, STATGROUP_RTSUnitUI);
+
+static TAutoConsoleVariable<int32> CVarRTS_UI_CoalesceUnitUpdates(
+	TEXT("net.RTS.UI.CoalesceUnitUpdates"),
+	1,
+	TEXT("1 = health bar updates, collapse checks and health threshold events from gameplay effects are flushed once per unit per frame, 0 = applied on every effect."),
+	ECVF_Default);
+
+bool UUnitUIUpdateSubsystem::IsEnabled()
+{
+	return CVarRTS_UI_CoalesceUnitUpdates.GetValueOnGameThread() > 0;
+}
+
+void UUnitUIUpdateSubsystem::Deinitialize()
+{
+	PendingUpdates.Empty();
+	PendingIndexByUnit.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UUnitUIUpdateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUnitUIUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UUnitUIUpdateSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	Flush();
+}
+
+FPendingUnitUIUpdate& UUnitUIUpdateSubsystem::FindOrAddPending(AUnitBase* Unit)
+{
+	if (const int32* Index = PendingIndexByUnit.Find(Unit))
+	{
+		return PendingUpdates[*Index];
+	}
+
+	const int32 NewIndex = PendingUpdates.AddDefaulted();
+	PendingIndexByUnit.Add(Unit, NewIndex);
+	PendingUpdates[NewIndex].Unit = Unit;
+	return PendingUpdates[NewIndex];
+}
+
+void UUnitUIUpdateSubsystem::QueueHealthChange(AUnitBase* Unit, float OldHealth, float NewHealth)
+{
+	if (!Unit)
+	{
+		return;
+	}
+
+	FPendingUnitUIUpdate& Pending = FindOrAddPending(Unit);
+	if (!Pending.bHealthChanged)
+	{
+		Pending.bHealthChanged = true;
+		Pending.FrameStartHealth = OldHealth;
+	}
+	Pending.LatestHealth = NewHealth;
+}
+
+void UUnitUIUpdateSubsystem::QueueHealthCollapseCheck(AUnitBase* Unit, float NewHealth, float OldHealth)
+{
+	if (!Unit)
+	{
+		return;
+	}
+
+	FPendingUnitUIUpdate& Pending = FindOrAddPending(Unit);
+	if (!Pending.bHealthCollapseCheck)
+	{
+		Pending.bHealthCollapseCheck = true;
+		Pending.CollapseOldHealth = OldHealth;
+	}
+	Pending.CollapseNewHealth = NewHealth;
+}
+
+void UUnitUIUpdateSubsystem::QueueShieldCollapseCheck(AUnitBase* Unit, float NewShield, float OldShield)
+{
+	if (!Unit)
+	{
+		return;
+	}
+
+	FPendingUnitUIUpdate& Pending = FindOrAddPending(Unit);
+	if (!Pending.bShieldCollapseCheck)
+	{
+		Pending.bShieldCollapseCheck = true;
+		Pending.CollapseOldShield = OldShield;
+	}
+	Pending.CollapseNewShield = NewShield;
+}
+
+void UUnitUIUpdateSubsystem::QueueWidgetUpdate(AUnitBase* Unit)
+{
+	if (!Unit)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_RTSUnitUI_WidgetUpdateRequests);
+	FindOrAddPending(Unit).bWidgetDirty = true;
+}
+
+void UUnitUIUpdateSubsystem::FireThresholdCrossings(AUnitBase* Unit, float OldHealth, float NewHealth)
+{
+	const float MaxHealth = Unit->Attributes ? Unit->Attributes->GetMaxHealth() : 0.f;
+	if (MaxHealth <= 0.f || OldHealth == NewHealth)
+	{
+		return;
+	}
+
+	const float OldPct = OldHealth / MaxHealth;
+	const float NewPct = NewHealth / MaxHealth;
+
+	// Same order as the direct path in UAttributeSetBase: downward crossings first, then upward ones
+	if (OldPct >= 0.50f && NewPct < 0.50f) { Unit->OnHealthThresholdCrossed(false, false, true, NewHealth); }
+	if (OldPct >= 0.25f && NewPct < 0.25f) { Unit->OnHealthThresholdCrossed(false, true,  false, NewHealth); }
+	if (OldPct <= 0.25f && NewPct > 0.25f) { Unit->OnHealthThresholdCrossed(true,  true,  false, NewHealth); }
+	if (OldPct <= 0.50f && NewPct > 0.50f) { Unit->OnHealthThresholdCrossed(true,  false, true, NewHealth); }
+}
+
+void UUnitUIUpdateSubsystem::Flush()
+{
+	if (PendingUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitUIUpdateSubsystem_Flush);
+
+	// Callbacks may queue new updates for the next frame
+	TArray<FPendingUnitUIUpdate> Updates = MoveTemp(PendingUpdates);
+	PendingUpdates.Reset();
+	PendingIndexByUnit.Reset();
+
+	for (const FPendingUnitUIUpdate& Pending : Updates)
+	{
+		AUnitBase* Unit = Pending.Unit.Get();
+		if (!IsValid(Unit) || Unit->GetUnitState() == UnitData::Dead)
+		{
+			continue;
+		}
+
+		ApplyUpdate(Unit, Pending);
+	}
+}
+
+void UUnitUIUpdateSubsystem::FlushUnit(AUnitBase* Unit)
+{
+	int32 Index = INDEX_NONE;
+	if (!Unit || !PendingIndexByUnit.RemoveAndCopyValue(Unit, Index))
+	{
+		return;
+	}
+
+	// Leave the slot in place so the indices of the other units stay valid; Flush skips it
+	const FPendingUnitUIUpdate Pending = PendingUpdates[Index];
+	PendingUpdates[Index].Unit.Reset();
+
+	ApplyUpdate(Unit, Pending);
+}
+
+void UUnitUIUpdateSubsystem::ApplyUpdate(AUnitBase* Unit, const FPendingUnitUIUpdate& Pending)
+{
+	if (Pending.bHealthChanged)
+	{
+		FireThresholdCrossings(Unit, Pending.FrameStartHealth, Pending.LatestHealth);
+	}
+
+	if (Pending.bHealthCollapseCheck)
+	{
+		Unit->HealthbarCollapseCheck(Pending.CollapseNewHealth, Pending.CollapseOldHealth);
+	}
+
+	if (Pending.bShieldCollapseCheck)
+	{
+		Unit->ShieldCollapseCheck(Pending.CollapseNewShield, Pending.CollapseOldShield);
+	}
+
+	if (Pending.bWidgetDirty)
+	{
+		INC_DWORD_STAT(STAT_RTSUnitUI_WidgetUpdates);
+		Unit->UpdateWidget();
+	}
+}
@@ -10,6 +10,15 @@
 void UDamageIndicator::NativeConstruct()
 {
 	Super::NativeConstruct();
+	InitialVisibility = GetVisibility();
+	StartUpdateTimer();
+}
+
+void UDamageIndicator::ResetIndicator()
+{
+	Opacity = 1.0f;
+	SetVisibility(InitialVisibility);
+	UpdateIndicator();
 	StartUpdateTimer();
 }
 
@@ -59,6 +68,14 @@ void UDamageIndicator::StartUpdateTimer()
 	GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &UDamageIndicator::UpdateIndicator, UpdateInterval, true);
 }
 
+void UDamageIndicator::StopUpdateTimer()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+	}
+}
+
 float UDamageIndicator::CalculateOpacity()
 {
 	// Static variable to persist the opacity value across function calls
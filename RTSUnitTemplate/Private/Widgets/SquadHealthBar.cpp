@@ -7,6 +7,13 @@
 #include "GAS/AttributeSetBase.h"
 #include "EngineUtils.h"
 #include "UObject/ObjectKey.h"
+#include "AbilitySystemComponent.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_SquadHealth_Validate(
+	TEXT("net.RTS.SquadHealth.Validate"),
+	0,
+	TEXT("When 1, every squad health snapshot is compared against a brute-force walk over all units and mismatches are logged."),
+	ECVF_Default);
 
 namespace
 {
@@ -37,7 +44,257 @@ namespace
 		bool bInitialized = false;
 	};
 
-	static TMap<FSquadKey, FSquadBaseline> GSquadBaselines;
+	// Running totals of all registered members; doubles keep incremental add/remove from drifting
+	struct FSquadAggregate
+	{
+		double CurrentHealth = 0.0;
+		double CurrentShield = 0.0;
+		double MaxHealth = 0.0;
+		double MaxShield = 0.0;
+		int32 NumMembers = 0;
+		FSquadBaseline Baseline;
+	};
+
+	struct FSquadMemberContribution
+	{
+		FSquadKey Key;
+		// Current values only count while alive, max values count for all members (baseline semantics)
+		float CurrentHealth = 0.f;
+		float CurrentShield = 0.f;
+		float MaxHealth = 0.f;
+		float MaxShield = 0.f;
+
+		bool bRegistered = false;
+
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		FDelegateHandle AttributeHandles[4];
+	};
+
+	static TMap<FSquadKey, FSquadAggregate> GSquadAggregates;
+	static TMap<TObjectKey<AUnitBase>, FSquadMemberContribution> GSquadMembers;
+
+	FGameplayAttribute GetTrackedAttribute(int32 Index)
+	{
+		switch (Index)
+		{
+		case 0: return UAttributeSetBase::GetHealthAttribute();
+		case 1: return UAttributeSetBase::GetMaxHealthAttribute();
+		case 2: return UAttributeSetBase::GetShieldAttribute();
+		default: return UAttributeSetBase::GetMaxShieldAttribute();
+		}
+	}
+
+	void ApplyContribution(const FSquadMemberContribution& Contribution, double Sign)
+	{
+		FSquadAggregate& Aggregate = GSquadAggregates.FindOrAdd(Contribution.Key);
+		Aggregate.CurrentHealth += Sign * Contribution.CurrentHealth;
+		Aggregate.CurrentShield += Sign * Contribution.CurrentShield;
+		Aggregate.MaxHealth += Sign * Contribution.MaxHealth;
+		Aggregate.MaxShield += Sign * Contribution.MaxShield;
+		Aggregate.NumMembers += (Sign > 0.0) ? 1 : -1;
+
+		if (Aggregate.NumMembers <= 0)
+		{
+			GSquadAggregates.Remove(Contribution.Key);
+		}
+	}
+
+	void UnbindAttributeCallbacks(FSquadMemberContribution& Contribution)
+	{
+		if (UAbilitySystemComponent* ASC = Contribution.ASC.Get())
+		{
+			for (int32 i = 0; i < UE_ARRAY_COUNT(Contribution.AttributeHandles); ++i)
+			{
+				ASC->GetGameplayAttributeValueChangeDelegate(GetTrackedAttribute(i)).Remove(Contribution.AttributeHandles[i]);
+			}
+		}
+		Contribution.ASC.Reset();
+	}
+
+	void BindAttributeCallbacks(AUnitBase* Unit, FSquadMemberContribution& Contribution)
+	{
+		UAbilitySystemComponent* ASC = Unit->GetAbilitySystemComponent();
+		if (!ASC || Contribution.ASC.Get() == ASC)
+		{
+			return;
+		}
+
+		UnbindAttributeCallbacks(Contribution);
+		Contribution.ASC = ASC;
+		for (int32 i = 0; i < UE_ARRAY_COUNT(Contribution.AttributeHandles); ++i)
+		{
+			Contribution.AttributeHandles[i] = ASC->GetGameplayAttributeValueChangeDelegate(GetTrackedAttribute(i))
+				.AddWeakLambda(Unit, [Unit](const FOnAttributeChangeData&)
+				{
+					FSquadHealthRegistry::UpdateUnit(Unit);
+				});
+		}
+	}
+}
+
+void FSquadHealthRegistry::UpdateUnit(AUnitBase* Unit)
+{
+	if (!Unit || !IsInGameThread())
+	{
+		return;
+	}
+
+	UWorld* World = Unit->GetWorld();
+	if (!World || Unit->SquadId <= 0 || !Unit->Attributes || Unit->IsActorBeingDestroyed())
+	{
+		RemoveUnit(Unit);
+		return;
+	}
+
+	FSquadMemberContribution NewContribution;
+	NewContribution.Key = FSquadKey{ FObjectKey(World), Unit->TeamId, Unit->SquadId };
+	NewContribution.MaxHealth = FMath::Max(0.f, Unit->Attributes->GetMaxHealth());
+	NewContribution.MaxShield = FMath::Max(0.f, Unit->Attributes->GetMaxShield());
+	// Skip dead units to avoid counting stale health/shield
+	if (Unit->GetUnitState() != UnitData::Dead)
+	{
+		NewContribution.CurrentHealth = FMath::Clamp(Unit->Attributes->GetHealth(), 0.f, NewContribution.MaxHealth);
+		NewContribution.CurrentShield = FMath::Clamp(Unit->Attributes->GetShield(), 0.f, NewContribution.MaxShield);
+	}
+
+	FSquadMemberContribution& Contribution = GSquadMembers.FindOrAdd(TObjectKey<AUnitBase>(Unit));
+	if (Contribution.bRegistered && Contribution.Key == NewContribution.Key)
+	{
+		// Same squad: apply the delta so the aggregate (and its baseline) stays in place
+		if (FSquadAggregate* Aggregate = GSquadAggregates.Find(Contribution.Key))
+		{
+			Aggregate->CurrentHealth += NewContribution.CurrentHealth - Contribution.CurrentHealth;
+			Aggregate->CurrentShield += NewContribution.CurrentShield - Contribution.CurrentShield;
+			Aggregate->MaxHealth += NewContribution.MaxHealth - Contribution.MaxHealth;
+			Aggregate->MaxShield += NewContribution.MaxShield - Contribution.MaxShield;
+		}
+		Contribution.CurrentHealth = NewContribution.CurrentHealth;
+		Contribution.CurrentShield = NewContribution.CurrentShield;
+		Contribution.MaxHealth = NewContribution.MaxHealth;
+		Contribution.MaxShield = NewContribution.MaxShield;
+		return;
+	}
+
+	// Joined a squad or moved to another one
+	if (Contribution.bRegistered)
+	{
+		ApplyContribution(Contribution, -1.0);
+		Contribution.bRegistered = false;
+	}
+
+	BindAttributeCallbacks(Unit, Contribution);
+	if (!Contribution.ASC.IsValid())
+	{
+		// Without an ASC there are no change callbacks; stay unregistered until the next update
+		GSquadMembers.Remove(TObjectKey<AUnitBase>(Unit));
+		return;
+	}
+
+	Contribution.Key = NewContribution.Key;
+	Contribution.CurrentHealth = NewContribution.CurrentHealth;
+	Contribution.CurrentShield = NewContribution.CurrentShield;
+	Contribution.MaxHealth = NewContribution.MaxHealth;
+	Contribution.MaxShield = NewContribution.MaxShield;
+	Contribution.bRegistered = true;
+	ApplyContribution(Contribution, 1.0);
+}
+
+void FSquadHealthRegistry::RemoveUnit(AUnitBase* Unit)
+{
+	FSquadMemberContribution Contribution;
+	if (!GSquadMembers.RemoveAndCopyValue(TObjectKey<AUnitBase>(Unit), Contribution))
+	{
+		return;
+	}
+
+	UnbindAttributeCallbacks(Contribution);
+	if (Contribution.bRegistered)
+	{
+		ApplyContribution(Contribution, -1.0);
+	}
+}
+
+void FSquadHealthRegistry::GetSnapshot(const AUnitBase* SquadMember, FSquadHealthSnapshot& OutSnapshot)
+{
+	OutSnapshot = FSquadHealthSnapshot();
+	UWorld* World = SquadMember ? SquadMember->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	const FSquadKey Key{ FObjectKey(World), SquadMember->TeamId, SquadMember->SquadId };
+	FSquadAggregate* Aggregate = GSquadAggregates.Find(Key);
+	if (!Aggregate)
+	{
+		// Squad not registered yet (e.g. SquadId replicated after BeginPlay); register its members once
+		for (TActorIterator<AUnitBase> It(World); It; ++It)
+		{
+			AUnitBase* Unit = *It;
+			if (Unit && Unit->TeamId == SquadMember->TeamId && Unit->SquadId == SquadMember->SquadId)
+			{
+				UpdateUnit(Unit);
+			}
+		}
+		Aggregate = GSquadAggregates.Find(Key);
+		if (!Aggregate)
+		{
+			return;
+		}
+	}
+
+	// Use or initialize baseline max totals for this squad (do not shrink when members die)
+	FSquadBaseline& Baseline = Aggregate->Baseline;
+	if (!Baseline.bInitialized && (Aggregate->MaxHealth > 0.0 || Aggregate->MaxShield > 0.0))
+	{
+		// Only lock in the baseline once we actually observed non-zero totals (e.g. after replication)
+		Baseline.MaxHealth = static_cast<float>(Aggregate->MaxHealth);
+		Baseline.MaxShield = static_cast<float>(Aggregate->MaxShield);
+		Baseline.bInitialized = true;
+	}
+
+	OutSnapshot.CurrentHealth = FMath::Max(0.f, static_cast<float>(Aggregate->CurrentHealth));
+	OutSnapshot.CurrentShield = FMath::Max(0.f, static_cast<float>(Aggregate->CurrentShield));
+
+	// Clamp current totals to the baseline to avoid showing >100%, but only if a valid baseline exists.
+	if (Baseline.bInitialized)
+	{
+		OutSnapshot.CurrentHealth = FMath::Min(OutSnapshot.CurrentHealth, Baseline.MaxHealth);
+		OutSnapshot.CurrentShield = FMath::Min(OutSnapshot.CurrentShield, Baseline.MaxShield);
+	}
+
+	// Report max values using the established baseline if available, otherwise fall back to the latest totals
+	OutSnapshot.MaxHealth = Baseline.bInitialized ? Baseline.MaxHealth : static_cast<float>(Aggregate->MaxHealth);
+	OutSnapshot.MaxShield = Baseline.bInitialized ? Baseline.MaxShield : static_cast<float>(Aggregate->MaxShield);
+}
+
+void FSquadHealthRegistry::ComputeBruteForce(const AUnitBase* SquadMember, FSquadHealthSnapshot& OutSnapshot)
+{
+	OutSnapshot = FSquadHealthSnapshot();
+	UWorld* World = SquadMember ? SquadMember->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	const int32 Team = SquadMember->TeamId;
+	const int32 Squad = SquadMember->SquadId;
+	for (TActorIterator<AUnitBase> It(World); It; ++It)
+	{
+		AUnitBase* Unit = *It;
+		if (!Unit || Unit->IsActorBeingDestroyed()) continue;
+		if (Unit->TeamId != Team || Unit->SquadId != Squad) continue;
+		if (!Unit->Attributes) continue;
+
+		const float UnitMax = FMath::Max(0.f, Unit->Attributes->GetMaxHealth());
+		const float UnitShieldMax = FMath::Max(0.f, Unit->Attributes->GetMaxShield());
+		OutSnapshot.MaxHealth += UnitMax;
+		OutSnapshot.MaxShield += UnitShieldMax;
+
+		if (Unit->GetUnitState() == UnitData::Dead) continue;
+		OutSnapshot.CurrentHealth += FMath::Clamp(Unit->Attributes->GetHealth(), 0.f, UnitMax);
+		OutSnapshot.CurrentShield += FMath::Clamp(Unit->Attributes->GetShield(), 0.f, UnitShieldMax);
+	}
 }
 
 void USquadHealthBar::UpdateWidget()
@@ -63,31 +320,45 @@ void USquadHealthBar::UpdateWidget()
 	float CurrentHealth = 0.f, MaxHealth = 0.f, CurrentShield = 0.f, MaxShield = 0.f;
 	ComputeSquadHealth(CurrentHealth, MaxHealth, CurrentShield, MaxShield);
 
-	if (HealthBar)
-	{
-		float HealthPercent = (MaxHealth > 0.f) ? (CurrentHealth / MaxHealth) : 0.f;
-		HealthBar->SetPercent(HealthPercent);
-	}
+	FSquadHealthSnapshot Snapshot;
+	Snapshot.CurrentHealth = CurrentHealth;
+	Snapshot.MaxHealth = MaxHealth;
+	Snapshot.CurrentShield = CurrentShield;
+	Snapshot.MaxShield = MaxShield;
 
-	FNumberFormattingOptions Opts; Opts.SetMaximumFractionalDigits(0);
-	if (CurrentHealthLabel) CurrentHealthLabel->SetText(FText::AsNumber(CurrentHealth, &Opts));
-	if (MaxHealthLabel) MaxHealthLabel->SetText(FText::AsNumber(MaxHealth, &Opts));
+	// Only touch the bars and labels when the squad totals changed
+	const bool bHealthChanged = !bHasDrawnSnapshot || !Snapshot.Equals(LastDrawnSnapshot);
+	LastDrawnSnapshot = Snapshot;
+	bHasDrawnSnapshot = true;
 
-	if (ShieldBar)
+	FNumberFormattingOptions Opts; Opts.SetMaximumFractionalDigits(0);
+	if (bHealthChanged)
 	{
-		if (CurrentShield <= 0.f)
+		if (HealthBar)
 		{
-			ShieldBar->SetVisibility(ESlateVisibility::Collapsed);
+			float HealthPercent = (MaxHealth > 0.f) ? (CurrentHealth / MaxHealth) : 0.f;
+			HealthBar->SetPercent(HealthPercent);
 		}
-		else
+
+		if (CurrentHealthLabel) CurrentHealthLabel->SetText(FText::AsNumber(CurrentHealth, &Opts));
+		if (MaxHealthLabel) MaxHealthLabel->SetText(FText::AsNumber(MaxHealth, &Opts));
+
+		if (ShieldBar)
 		{
-			ShieldBar->SetVisibility(ESlateVisibility::Visible);
+			if (CurrentShield <= 0.f)
+			{
+				ShieldBar->SetVisibility(ESlateVisibility::Collapsed);
+			}
+			else
+			{
+				ShieldBar->SetVisibility(ESlateVisibility::Visible);
+			}
+			float ShieldPercent = (MaxShield > 0.f) ? (CurrentShield / MaxShield) : 0.f;
+			ShieldBar->SetPercent(ShieldPercent);
 		}
-		float ShieldPercent = (MaxShield > 0.f) ? (CurrentShield / MaxShield) : 0.f;
-		ShieldBar->SetPercent(ShieldPercent);
+		if (CurrentShieldLabel) CurrentShieldLabel->SetText(FText::AsNumber(CurrentShield, &Opts));
+		if (MaxShieldLabel) MaxShieldLabel->SetText(FText::AsNumber(MaxShield, &Opts));
 	}
-	if (CurrentShieldLabel) CurrentShieldLabel->SetText(FText::AsNumber(CurrentShield, &Opts));
-	if (MaxShieldLabel) MaxShieldLabel->SetText(FText::AsNumber(MaxShield, &Opts));
 
 	// Level and XP remain tied to the owner's display (optional to aggregate)
 	if (CharacterLevel)
@@ -102,9 +373,7 @@ void USquadHealthBar::ComputeSquadHealth(float& OutCurrentHealth, float& OutMaxH
 	OutCurrentHealth = 0.f; OutMaxHealth = 0.f; OutCurrentShield = 0.f; OutMaxShield = 0.f;
 	if (!OwnerCharacter) return;
 
-	const int Squad = OwnerCharacter->SquadId;
-	const int Team = OwnerCharacter->TeamId;
-	if (Squad <= 0) // Not a squad; fall back to single owner values
+	if (OwnerCharacter->SquadId <= 0) // Not a squad; fall back to single owner values
 	{
 		if (OwnerCharacter->Attributes)
 		{
@@ -116,71 +385,27 @@ void USquadHealthBar::ComputeSquadHealth(float& OutCurrentHealth, float& OutMaxH
 		return;
 	}
 
-	UWorld* World = OwnerCharacter->GetWorld();
-	if (!World) return;
+	FSquadHealthSnapshot Snapshot;
+	FSquadHealthRegistry::GetSnapshot(OwnerCharacter, Snapshot);
 
-	// Sum current values from alive/valid units
-	for (TActorIterator<AUnitBase> It(World); It; ++It)
+	if (CVarRTS_SquadHealth_Validate.GetValueOnGameThread() != 0)
 	{
-		AUnitBase* Unit = *It;
-		if (!Unit || Unit->IsActorBeingDestroyed()) continue;
-		if (Unit->TeamId != Team || Unit->SquadId != Squad) continue;
-		if (!Unit->Attributes) continue;
-		// Skip dead units to avoid counting stale health/shield
-		if (Unit->GetUnitState() == UnitData::Dead) continue;
-
-		const float UnitMax = FMath::Max(0.f, Unit->Attributes->GetMaxHealth());
-		const float UnitHealth = FMath::Clamp(Unit->Attributes->GetHealth(), 0.f, UnitMax);
-		OutCurrentHealth += UnitHealth;
-
-		const float UnitShieldMax = FMath::Max(0.f, Unit->Attributes->GetMaxShield());
-		const float UnitShield = FMath::Clamp(Unit->Attributes->GetShield(), 0.f, UnitShieldMax);
-		OutCurrentShield += UnitShield;
-	}
-
-	// Use or initialize baseline max totals for this squad (do not shrink when members die)
-	FSquadKey Key{ FObjectKey(World), Team, Squad };
-	FSquadBaseline& Baseline = GSquadBaselines.FindOrAdd(Key);
-
-	// If baseline was initialized to zeros (e.g., before replication), allow re-initialization later
-	if (Baseline.bInitialized && Baseline.MaxHealth <= 0.f && Baseline.MaxShield <= 0.f)
-	{
-		Baseline.bInitialized = false;
-	}
-
-	float TempMaxHealth = 0.f;
-	float TempMaxShield = 0.f;
-	if (!Baseline.bInitialized)
-	{
-		// Initialize from current snapshot. We intentionally include all squad members
-		// (even dead) so the baseline represents the full squad composition.
-		for (TActorIterator<AUnitBase> It(World); It; ++It)
+		// Brute-force totals before baseline clamping; compare only what the baseline does not alter
+		FSquadHealthSnapshot Reference;
+		FSquadHealthRegistry::ComputeBruteForce(OwnerCharacter, Reference);
+		const bool bCurrentMatches =
+			FMath::IsNearlyEqual(Snapshot.CurrentHealth, FMath::Min(Reference.CurrentHealth, Snapshot.MaxHealth), 0.5f) &&
+			FMath::IsNearlyEqual(Snapshot.CurrentShield, FMath::Min(Reference.CurrentShield, Snapshot.MaxShield), 0.5f);
+		if (!bCurrentMatches)
 		{
-			AUnitBase* Unit = *It;
-			if (!Unit || Unit->IsActorBeingDestroyed()) continue;
-			if (Unit->TeamId != Team || Unit->SquadId != Squad) continue;
-			if (!Unit->Attributes) continue;
-			TempMaxHealth += FMath::Max(0.f, Unit->Attributes->GetMaxHealth());
-			TempMaxShield += FMath::Max(0.f, Unit->Attributes->GetMaxShield());
+			UE_LOG(LogTemp, Warning, TEXT("[SquadHealth] Aggregate mismatch Team=%d Squad=%d Health %.1f vs %.1f Shield %.1f vs %.1f (registry vs brute force)"),
+				OwnerCharacter->TeamId, OwnerCharacter->SquadId,
+				Snapshot.CurrentHealth, Reference.CurrentHealth, Snapshot.CurrentShield, Reference.CurrentShield);
 		}
-
-		// Only lock in the baseline if we actually observed non-zero totals.
-		if (TempMaxHealth > 0.f || TempMaxShield > 0.f)
-		{
-			Baseline.MaxHealth = TempMaxHealth;
-			Baseline.MaxShield = TempMaxShield;
-			Baseline.bInitialized = true;
-		}
-	}
-
-	// Clamp current totals to the baseline to avoid showing >100%, but only if a valid baseline exists.
-	if (Baseline.bInitialized)
-	{
-		OutCurrentHealth = FMath::Clamp(OutCurrentHealth, 0.f, Baseline.MaxHealth);
-		OutCurrentShield = FMath::Clamp(OutCurrentShield, 0.f, Baseline.MaxShield);
 	}
 
-	// Report max values using the established baseline if available, otherwise fall back to the latest snapshot
-	OutMaxHealth = Baseline.bInitialized ? Baseline.MaxHealth : TempMaxHealth;
-	OutMaxShield = Baseline.bInitialized ? Baseline.MaxShield : TempMaxShield;
+	OutCurrentHealth = Snapshot.CurrentHealth;
+	OutMaxHealth = Snapshot.MaxHealth;
+	OutCurrentShield = Snapshot.CurrentShield;
+	OutMaxShield = Snapshot.MaxShield;
 }
@@ -22,6 +22,8 @@
 #include "Styling/SlateTypes.h"
 #include "Engine/Texture2D.h"
 #include "Blueprint/WidgetTree.h"
+#include "GAS/AttributeSetBase.h"
+#include "GameplayEffectTypes.h"
 
 void UUnitWidgetSelector::NativeConstruct()
 {
@@ -36,6 +38,18 @@ void UUnitWidgetSelector::NativeConstruct()
 	BindStanceButtonEvents();
 }
 
+void UUnitWidgetSelector::NativeDestruct()
+{
+	UnbindAllHealthBindings();
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+	}
+
+	Super::NativeDestruct();
+}
+
 
 FText UUnitWidgetSelector::ReplaceRarityKeywords(
 	FText OriginalText,
@@ -61,6 +75,7 @@ FText UUnitWidgetSelector::ReplaceRarityKeywords(
 
 void UUnitWidgetSelector::UpdateSelectedUnits()
 {
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitWidgetSelector_UpdateSelectedUnits);
 	if (!ControllerBase) return;
 	
 	if (ControllerBase->HUDBase)
@@ -1486,148 +1501,347 @@ void UUnitWidgetSelector::ClearUnitCards()
 	UnitHealthBars.Empty();
 	UnitHealthTexts.Empty();
 	ButtonLabels.Empty();
+	StackCountTexts.Empty();
+	GroupedUnitsByCard.Empty();
+
+	CardDisplayedUnits.Empty();
+	CardDisplayedCounts.Empty();
+	CardDisplayedHealth.Empty();
+	UnbindAllHealthBindings();
+
+	bUnitCardPoolBuilt = false;
+	ActiveUnitCardCount = 0;
+	LastSelectionCount = INDEX_NONE;
+	bUnitCardHealthDirty = true;
 }
 
-void UUnitWidgetSelector::UpdateUnitCards()
+void UUnitWidgetSelector::EnsureUnitCardPool()
 {
-	if (!ControllerBase)
+	if (bUnitCardPoolBuilt && bUnitCardPoolGrouped == bGroupUnitCardsByType)
 	{
 		return;
 	}
 
-	if (!UnitCardHorizontalBox || !UnitCardWidgetClass)
-	{
-		return;
-	}
+	// Grouped and non-grouped mode read the stack count from different widgets, rebuild on mode change
+	ClearUnitCards();
 
-	// Group units by type if enabled
-	if (bGroupUnitCardsByType)
+	const int32 PoolSize = FMath::Max(0, MaxUnitCards);
+	for (int32 i = 0; i < PoolSize; i++)
 	{
-		TMap<UClass*, TArray<AUnitBase*>> UnitsByType;
-		TArray<UClass*> UniqueTypes;
+		UUserWidget* NewCard = CreateWidget<UUserWidget>(GetOwningPlayer(), UnitCardWidgetClass);
+		if (!NewCard)
+		{
+			break;
+		}
 
-		for (AUnitBase* Unit : ControllerBase->SelectedUnits)
+		if (i == 0)
 		{
-			if (!Unit) continue;
+			UnitCardShownVisibility = NewCard->GetVisibility();
+		}
+		NewCard->SetVisibility(ESlateVisibility::Collapsed);
+		UnitCardHorizontalBox->AddChild(NewCard);
+		SelectButtonWidgets.Add(NewCard);
+
+		USelectorButton* SelectBtn = Cast<USelectorButton>(NewCard->GetWidgetFromName(TEXT("SelectButton")));
+		SelectButtons.Add(SelectBtn);
+
+		USelectorButton* SingleBtn = Cast<USelectorButton>(NewCard->GetWidgetFromName(TEXT("SingleSelectButton")));
+		SingleSelectButtons.Add(SingleBtn);
+
+		UProgressBar* HealthBar = Cast<UProgressBar>(NewCard->GetWidgetFromName(TEXT("UnitHealthBar")));
+		UnitHealthBars.Add(HealthBar);
+
+		UTextBlock* HealthText = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("UnitHealthText")));
+		UnitHealthTexts.Add(HealthText);
+
+		UTextBlock* Label = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("TextBlock")));
+		ButtonLabels.Add(Label);
 
-			UClass* UnitClass = Unit->GetClass();
-			if (!UnitsByType.Contains(UnitClass))
+		if (bGroupUnitCardsByType)
+		{
+			// Use TextBlock for stack count display
+			StackCountTexts.Add(Label);
+		}
+		else
+		{
+			UTextBlock* StackText = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("StackCountText")));
+			if (StackText)
 			{
-				UnitsByType.Add(UnitClass, TArray<AUnitBase*>());
-				UniqueTypes.Add(UnitClass);
+				// Stack counts are not shown in non-grouped mode
+				StackText->SetVisibility(ESlateVisibility::Collapsed);
 			}
-			UnitsByType[UnitClass].Add(Unit);
+			StackCountTexts.Add(StackText);
 		}
 
-		const int32 NumTypes = FMath::Min(UniqueTypes.Num(), MaxUnitCards);
-		GroupedUnitsByCard.SetNum(NumTypes);
+		if (SelectBtn)
+		{
+			SelectBtn->Id = i;
+			SelectBtn->Selector = this;
+			SelectBtn->SelectUnit = true;
+			SelectBtn->OnClicked.AddUniqueDynamic(SelectBtn, &USelectorButton::OnClick);
+		}
+		if (SingleBtn)
+		{
+			SingleBtn->Id = i;
+			SingleBtn->Selector = this;
+			SingleBtn->SelectUnit = true;
+			SingleBtn->OnClicked.AddUniqueDynamic(SingleBtn, &USelectorButton::OnClick);
+		}
+	}
+
+	const int32 NumCards = SelectButtonWidgets.Num();
+	CardDisplayedUnits.SetNum(NumCards);
+	CardDisplayedCounts.Init(INDEX_NONE, NumCards);
+	CardDisplayedHealth.Init(-1.f, NumCards);
 
-		// Remove extra cards
-		while (SelectButtonWidgets.Num() > NumTypes)
+	bUnitCardPoolBuilt = true;
+	bUnitCardPoolGrouped = bGroupUnitCardsByType;
+}
+
+void UUnitWidgetSelector::SetActiveUnitCardCount(int32 Count)
+{
+	Count = FMath::Clamp(Count, 0, SelectButtonWidgets.Num());
+	if (Count == ActiveUnitCardCount)
+	{
+		return;
+	}
+
+	// Only the cards crossing the boundary change visibility
+	const int32 First = FMath::Min(Count, ActiveUnitCardCount);
+	const int32 Last = FMath::Max(Count, ActiveUnitCardCount);
+	for (int32 i = First; i < Last; i++)
+	{
+		if (SelectButtonWidgets[i])
 		{
-			const int32 LastIndex = SelectButtonWidgets.Num() - 1;
-			if (SelectButtonWidgets[LastIndex])
-			{
-				SelectButtonWidgets[LastIndex]->RemoveFromParent();
-			}
-			SelectButtonWidgets.RemoveAt(LastIndex);
-			if (UnitIcons.Num() > LastIndex) UnitIcons.RemoveAt(LastIndex);
-			if (UnitHealthBars.Num() > LastIndex) UnitHealthBars.RemoveAt(LastIndex);
-			if (UnitHealthTexts.Num() > LastIndex) UnitHealthTexts.RemoveAt(LastIndex);
-			if (ButtonLabels.Num() > LastIndex) ButtonLabels.RemoveAt(LastIndex);
-			if (SelectButtons.Num() > LastIndex) SelectButtons.RemoveAt(LastIndex);
-			if (SingleSelectButtons.Num() > LastIndex) SingleSelectButtons.RemoveAt(LastIndex);
-			if (StackCountTexts.Num() > LastIndex) StackCountTexts.RemoveAt(LastIndex);
+			SelectButtonWidgets[i]->SetVisibility(i < Count ? UnitCardShownVisibility : ESlateVisibility::Collapsed);
 		}
+		if (i >= Count)
+		{
+			CardDisplayedUnits[i].Reset();
+			CardDisplayedCounts[i] = INDEX_NONE;
+			CardDisplayedHealth[i] = -1.f;
+		}
+	}
+	ActiveUnitCardCount = Count;
+}
+
+void UUnitWidgetSelector::SetCardIcon(int32 CardIndex, UTexture2D* Icon)
+{
+	if (!SelectButtons.IsValidIndex(CardIndex) || !SelectButtons[CardIndex] || !Icon)
+	{
+		return;
+	}
+
+	// Only update style if the icon has changed (prevents hover flickering)
+	FButtonStyle ButtonStyle = SelectButtons[CardIndex]->GetStyle();
+	if (ButtonStyle.Normal.GetResourceObject() == Icon)
+	{
+		return;
+	}
+
+	ButtonStyle.Normal.SetResourceObject(Icon);
+	ButtonStyle.Normal.DrawAs = ESlateBrushDrawType::Image;
+	ButtonStyle.Normal.TintColor = FSlateColor(FLinearColor::White);
+	ButtonStyle.Hovered.SetResourceObject(Icon);
+	ButtonStyle.Hovered.DrawAs = ESlateBrushDrawType::Image;
+	ButtonStyle.Hovered.TintColor = FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f, 1.0f));
+	ButtonStyle.Pressed.SetResourceObject(Icon);
+	ButtonStyle.Pressed.DrawAs = ESlateBrushDrawType::Image;
+	ButtonStyle.Pressed.TintColor = FSlateColor(FLinearColor(0.5f, 0.5f, 0.5f, 1.0f));
+	SelectButtons[CardIndex]->SetStyle(ButtonStyle);
+}
+
+bool UUnitWidgetSelector::RefreshSelectionSignature()
+{
+	const TArray<AUnitBase*>& Units = ControllerBase->SelectedUnits;
+
+	uint32 Signature = GetTypeHash(Units.Num());
+	for (const AUnitBase* Unit : Units)
+	{
+		Signature = HashCombineFast(Signature, GetTypeHash(Unit));
+	}
+
+	if (Signature == LastSelectionSignature && Units.Num() == LastSelectionCount)
+	{
+		return false;
+	}
 
-		// Spawn cards for each unique type
-		while (SelectButtonWidgets.Num() < NumTypes)
+	LastSelectionSignature = Signature;
+	LastSelectionCount = Units.Num();
+	return true;
+}
+
+void UUnitWidgetSelector::UpdateHealthBindings()
+{
+	TSet<AUnitBase*> Selected;
+	Selected.Reserve(ControllerBase->SelectedUnits.Num());
+	for (AUnitBase* Unit : ControllerBase->SelectedUnits)
+	{
+		if (Unit)
 		{
-			UUserWidget* NewCard = CreateWidget<UUserWidget>(GetOwningPlayer(), UnitCardWidgetClass);
-			if (NewCard)
-			{
-				UnitCardHorizontalBox->AddChild(NewCard);
-				SelectButtonWidgets.Add(NewCard);
+			Selected.Add(Unit);
+		}
+	}
+
+	// Drop bindings of units that left the selection
+	for (auto It = HealthBindings.CreateIterator(); It; ++It)
+	{
+		AUnitBase* Unit = It.Key().Get();
+		if (Unit && Selected.Contains(Unit))
+		{
+			continue;
+		}
+		UnbindHealthBinding(It.Value());
+		It.RemoveCurrent();
+	}
+
+	// Bind newly selected units
+	for (AUnitBase* Unit : Selected)
+	{
+		if (HealthBindings.Contains(Unit))
+		{
+			continue;
+		}
+		UAbilitySystemComponent* ASC = Unit->GetAbilitySystemComponent();
+		if (!ASC)
+		{
+			continue;
+		}
 
-				USelectorButton* SelectBtn = Cast<USelectorButton>(NewCard->GetWidgetFromName(TEXT("SelectButton")));
-				SelectButtons.Add(SelectBtn);
+		FUnitCardHealthBinding& Binding = HealthBindings.Add(Unit);
+		Binding.ASC = ASC;
+		Binding.HealthHandle = ASC->GetGameplayAttributeValueChangeDelegate(UAttributeSetBase::GetHealthAttribute())
+			.AddUObject(this, &UUnitWidgetSelector::OnSelectedUnitHealthChanged);
+		Binding.MaxHealthHandle = ASC->GetGameplayAttributeValueChangeDelegate(UAttributeSetBase::GetMaxHealthAttribute())
+			.AddUObject(this, &UUnitWidgetSelector::OnSelectedUnitHealthChanged);
+		if (Unit->Attributes)
+		{
+			Binding.Attributes = Unit->Attributes;
+			Binding.DirectWriteHandle = Unit->Attributes->OnDirectHealthWrite.AddUObject(this, &UUnitWidgetSelector::OnSelectedUnitDirectHealthWrite);
+		}
+	}
+}
 
-				USelectorButton* SingleBtn = Cast<USelectorButton>(NewCard->GetWidgetFromName(TEXT("SingleSelectButton")));
-				SingleSelectButtons.Add(SingleBtn);
+void UUnitWidgetSelector::UnbindAllHealthBindings()
+{
+	for (const TPair<TWeakObjectPtr<AUnitBase>, FUnitCardHealthBinding>& Pair : HealthBindings)
+	{
+		UnbindHealthBinding(Pair.Value);
+	}
+	HealthBindings.Empty();
+}
 
-				UProgressBar* HealthBar = Cast<UProgressBar>(NewCard->GetWidgetFromName(TEXT("UnitHealthBar")));
-				UnitHealthBars.Add(HealthBar);
+void UUnitWidgetSelector::UnbindHealthBinding(const FUnitCardHealthBinding& Binding)
+{
+	if (UAbilitySystemComponent* ASC = Binding.ASC.Get())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(UAttributeSetBase::GetHealthAttribute()).Remove(Binding.HealthHandle);
+		ASC->GetGameplayAttributeValueChangeDelegate(UAttributeSetBase::GetMaxHealthAttribute()).Remove(Binding.MaxHealthHandle);
+	}
+	if (UAttributeSetBase* Attributes = Binding.Attributes.Get())
+	{
+		Attributes->OnDirectHealthWrite.Remove(Binding.DirectWriteHandle);
+	}
+}
 
-				UTextBlock* HealthText = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("UnitHealthText")));
-				UnitHealthTexts.Add(HealthText);
+void UUnitWidgetSelector::OnSelectedUnitHealthChanged(const FOnAttributeChangeData& Data)
+{
+	bUnitCardHealthDirty = true;
+}
 
-				UTextBlock* Label = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("TextBlock")));
-				ButtonLabels.Add(Label);
+void UUnitWidgetSelector::OnSelectedUnitDirectHealthWrite(UAttributeSetBase* AttributeSet)
+{
+	bUnitCardHealthDirty = true;
+}
 
-				// Use TextBlock for stack count display
-				StackCountTexts.Add(Label);
+void UUnitWidgetSelector::UpdateUnitCards()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UnitWidgetSelector_UpdateUnitCards);
 
-				const int32 NewId = SelectButtonWidgets.Num() - 1;
-				if (SelectBtn)
-				{
-					SelectBtn->Id = NewId;
-					SelectBtn->Selector = this;
-					SelectBtn->SelectUnit = true;
-					SelectBtn->OnClicked.AddUniqueDynamic(SelectBtn, &USelectorButton::OnClick);
-				}
-				if (SingleBtn)
+	if (!ControllerBase)
+	{
+		return;
+	}
+
+	if (!UnitCardHorizontalBox || !UnitCardWidgetClass)
+	{
+		return;
+	}
+
+	EnsureUnitCardPool();
+
+	// Cards only change when the selection or a selected unit's health changed
+	const bool bSelectionChanged = RefreshSelectionSignature();
+	if (!bSelectionChanged && !bUnitCardHealthDirty)
+	{
+		return;
+	}
+	if (bSelectionChanged)
+	{
+		UpdateHealthBindings();
+	}
+	bUnitCardHealthDirty = false;
+
+	// Group units by type if enabled
+	if (bGroupUnitCardsByType)
+	{
+		if (bSelectionChanged)
+		{
+			TMap<UClass*, int32> CardByType;
+			GroupedUnitsByCard.Reset();
+
+			for (AUnitBase* Unit : ControllerBase->SelectedUnits)
+			{
+				if (!Unit) continue;
+
+				UClass* UnitClass = Unit->GetClass();
+				int32* CardIndex = CardByType.Find(UnitClass);
+				if (!CardIndex)
 				{
-					SingleBtn->Id = NewId;
-					SingleBtn->Selector = this;
-					SingleBtn->SelectUnit = true;
-					SingleBtn->OnClicked.AddUniqueDynamic(SingleBtn, &USelectorButton::OnClick);
+					if (GroupedUnitsByCard.Num() >= SelectButtonWidgets.Num())
+					{
+						continue;
+					}
+					CardIndex = &CardByType.Add(UnitClass, GroupedUnitsByCard.Num());
+					GroupedUnitsByCard.AddDefaulted();
 				}
+				GroupedUnitsByCard[*CardIndex].Add(Unit);
 			}
 		}
 
-		// Update each card with grouped data
+		const int32 NumTypes = GroupedUnitsByCard.Num();
+		SetActiveUnitCardCount(NumTypes);
+
+		// Update each card with grouped data, touching only what changed
 		for (int32 i = 0; i < NumTypes; i++)
 		{
-			UClass* UnitClass = UniqueTypes[i];
-			const TArray<AUnitBase*>& UnitsOfType = UnitsByType[UnitClass];
-
-			// Convert to weak pointers for storage
-			GroupedUnitsByCard[i].Empty();
-			for (AUnitBase* U : UnitsOfType)
-			{
-				GroupedUnitsByCard[i].Add(U);
-			}
+			const TArray<TWeakObjectPtr<AUnitBase>>& UnitsOfType = GroupedUnitsByCard[i];
 
-			AUnitBase* RepUnit = UnitsOfType[0];
+			AUnitBase* RepUnit = UnitsOfType.Num() > 0 ? UnitsOfType[0].Get() : nullptr;
 			const int32 Count = UnitsOfType.Num();
 
 			// Set icon from representative unit
-			if (SelectButtons.IsValidIndex(i) && SelectButtons[i] && RepUnit && RepUnit->UnitIcon)
+			if (RepUnit && CardDisplayedUnits[i].Get() != RepUnit)
 			{
-				FButtonStyle ButtonStyle = SelectButtons[i]->GetStyle();
-				ButtonStyle.Normal.SetResourceObject(RepUnit->UnitIcon);
-				ButtonStyle.Normal.DrawAs = ESlateBrushDrawType::Image;
-				ButtonStyle.Normal.TintColor = FSlateColor(FLinearColor::White);
-				ButtonStyle.Hovered.SetResourceObject(RepUnit->UnitIcon);
-				ButtonStyle.Hovered.DrawAs = ESlateBrushDrawType::Image;
-				ButtonStyle.Hovered.TintColor = FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f, 1.0f));
-				ButtonStyle.Pressed.SetResourceObject(RepUnit->UnitIcon);
-				ButtonStyle.Pressed.DrawAs = ESlateBrushDrawType::Image;
-				ButtonStyle.Pressed.TintColor = FSlateColor(FLinearColor(0.5f, 0.5f, 0.5f, 1.0f));
-				SelectButtons[i]->SetStyle(ButtonStyle);
+				CardDisplayedUnits[i] = RepUnit;
+				SetCardIcon(i, RepUnit->UnitIcon);
 			}
 
 			// Show stack count (x25) - only show if more than 1
-			if (StackCountTexts.IsValidIndex(i) && StackCountTexts[i])
+			if (Count != CardDisplayedCounts[i])
 			{
-				if (Count > 1)
-				{
-					StackCountTexts[i]->SetText(FText::FromString(FString::Printf(TEXT("x%d"), Count)));
-					StackCountTexts[i]->SetVisibility(ESlateVisibility::HitTestInvisible);
-				}
-				else
+				CardDisplayedCounts[i] = Count;
+				if (StackCountTexts.IsValidIndex(i) && StackCountTexts[i])
 				{
-					StackCountTexts[i]->SetVisibility(ESlateVisibility::Collapsed);
+					if (Count > 1)
+					{
+						StackCountTexts[i]->SetText(FText::FromString(FString::Printf(TEXT("x%d"), Count)));
+						StackCountTexts[i]->SetVisibility(ESlateVisibility::HitTestInvisible);
+					}
+					else
+					{
+						StackCountTexts[i]->SetVisibility(ESlateVisibility::Collapsed);
+					}
 				}
 			}
 
@@ -1636,8 +1850,9 @@ void UUnitWidgetSelector::UpdateUnitCards()
 			{
 				float TotalHealth = 0.f;
 				float TotalMaxHealth = 0.f;
-				for (AUnitBase* U : UnitsOfType)
+				for (const TWeakObjectPtr<AUnitBase>& WeakUnit : UnitsOfType)
 				{
+					const AUnitBase* U = WeakUnit.Get();
 					if (U && U->Attributes)
 					{
 						TotalHealth += U->Attributes->GetHealth();
@@ -1645,7 +1860,11 @@ void UUnitWidgetSelector::UpdateUnitCards()
 					}
 				}
 				const float AvgPercent = (TotalMaxHealth > 0.f) ? (TotalHealth / TotalMaxHealth) : 1.f;
-				UnitHealthBars[i]->SetPercent(AvgPercent);
+				if (!FMath::IsNearlyEqual(AvgPercent, CardDisplayedHealth[i], 0.001f))
+				{
+					CardDisplayedHealth[i] = AvgPercent;
+					UnitHealthBars[i]->SetPercent(AvgPercent);
+				}
 			}
 		}
 
@@ -1657,85 +1876,18 @@ void UUnitWidgetSelector::UpdateUnitCards()
 	else
 	{
 		// Original non-grouped behavior
-		const int32 SelectedCount = ControllerBase->SelectedUnits.Num();
 		GroupedUnitsByCard.Empty();
+		SetActiveUnitCardCount(ControllerBase->SelectedUnits.Num());
 
-		while (SelectButtonWidgets.Num() > SelectedCount)
-		{
-			const int32 LastIndex = SelectButtonWidgets.Num() - 1;
-			if (SelectButtonWidgets[LastIndex])
-			{
-				SelectButtonWidgets[LastIndex]->RemoveFromParent();
-			}
-			SelectButtonWidgets.RemoveAt(LastIndex);
-			if (UnitIcons.Num() > LastIndex) UnitIcons.RemoveAt(LastIndex);
-			if (UnitHealthBars.Num() > LastIndex) UnitHealthBars.RemoveAt(LastIndex);
-			if (UnitHealthTexts.Num() > LastIndex) UnitHealthTexts.RemoveAt(LastIndex);
-			if (ButtonLabels.Num() > LastIndex) ButtonLabels.RemoveAt(LastIndex);
-			if (SelectButtons.Num() > LastIndex) SelectButtons.RemoveAt(LastIndex);
-			if (SingleSelectButtons.Num() > LastIndex) SingleSelectButtons.RemoveAt(LastIndex);
-			if (StackCountTexts.Num() > LastIndex) StackCountTexts.RemoveAt(LastIndex);
-		}
-
-		while (SelectButtonWidgets.Num() < SelectedCount && SelectButtonWidgets.Num() < MaxUnitCards)
-		{
-			UUserWidget* NewCard = CreateWidget<UUserWidget>(GetOwningPlayer(), UnitCardWidgetClass);
-			if (NewCard)
-			{
-				UnitCardHorizontalBox->AddChild(NewCard);
-				SelectButtonWidgets.Add(NewCard);
-
-				USelectorButton* SelectBtn = Cast<USelectorButton>(NewCard->GetWidgetFromName(TEXT("SelectButton")));
-				SelectButtons.Add(SelectBtn);
-
-				USelectorButton* SingleBtn = Cast<USelectorButton>(NewCard->GetWidgetFromName(TEXT("SingleSelectButton")));
-				SingleSelectButtons.Add(SingleBtn);
-
-				UProgressBar* HealthBar = Cast<UProgressBar>(NewCard->GetWidgetFromName(TEXT("UnitHealthBar")));
-				UnitHealthBars.Add(HealthBar);
-
-				UTextBlock* HealthText = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("UnitHealthText")));
-				UnitHealthTexts.Add(HealthText);
-
-				UTextBlock* Label = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("TextBlock")));
-				ButtonLabels.Add(Label);
-
-				UTextBlock* StackText = Cast<UTextBlock>(NewCard->GetWidgetFromName(TEXT("StackCountText")));
-				StackCountTexts.Add(StackText);
-
-				const int32 NewId = SelectButtonWidgets.Num() - 1;
-				if (SelectBtn)
-				{
-					SelectBtn->Id = NewId;
-					SelectBtn->Selector = this;
-					SelectBtn->SelectUnit = true;
-					SelectBtn->OnClicked.AddUniqueDynamic(SelectBtn, &USelectorButton::OnClick);
-				}
-				if (SingleBtn)
-				{
-					SingleBtn->Id = NewId;
-					SingleBtn->Selector = this;
-					SingleBtn->SelectUnit = true;
-					SingleBtn->OnClicked.AddUniqueDynamic(SingleBtn, &USelectorButton::OnClick);
-				}
-			}
-		}
-
-		// Hide stack count in non-grouped mode
-		for (UTextBlock* StackText : StackCountTexts)
-		{
-			if (StackText)
-			{
-				StackText->SetVisibility(ESlateVisibility::Collapsed);
-			}
-		}
-
-		const bool bHasCards = SelectButtonWidgets.Num() > 0;
+		const bool bHasCards = ActiveUnitCardCount > 0;
 		const ESlateVisibility TargetVisibility = bHasCards ? ESlateVisibility::Visible : ESlateVisibility::Hidden;
 		if (SelectUnitCanvas) SelectUnitCanvas->SetVisibility(TargetVisibility);
 		if (SelectUnitCard) SelectUnitCard->SetVisibility(TargetVisibility);
 
-		SetUnitIcons(ControllerBase->SelectedUnits);
+		if (bSelectionChanged)
+		{
+			SetUnitIcons(ControllerBase->SelectedUnits);
+		}
 		UpdateUnitHealthBars(ControllerBase->SelectedUnits);
 	}
 }
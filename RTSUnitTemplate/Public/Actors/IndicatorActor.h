@@ -58,5 +58,14 @@ public:
 	UFUNCTION(NetMulticast, Reliable)
 	void Multicast_UpdateWidget(float Damage, FLinearColor HighColor, FLinearColor LowColor, float ColorOffset);
 
+	// Pooling (UDamageIndicatorSubsystem): finished pooled indicators are hidden and returned instead of destroyed
+	UPROPERTY(Transient)
+	bool bPooled = false;
+
+	void ActivatePooled(const FVector& Location, float Damage, FLinearColor HighColor, FLinearColor LowColor, float ColorOffset);
+	void DeactivatePooled();
+	// Adds a merged hit to the number that is already shown
+	void AddPooledDamage(float Damage);
+
 	///////////////////////////////////////////////////////////////////
 };
@@ -29,6 +29,11 @@ public:
 
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "RTSUnitTemplate|Movement")
 	float ArcHeightDistanceFactor = 0.f;
+
+	// When set, SpawnProjectile does not spawn this actor. The flight is simulated by UProjectileSimulationSubsystem
+	// using this class' defaults (mesh, Niagara, impact FX, pierce/bounce flags). Blueprint ImpactEvent is not called.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = RTSUnitTemplate)
+	bool bUsePooledSimulation = false;
 	// Sets default values for this actor's properties
 	AProjectile();
 
@@ -244,4 +249,9 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void SetVisibility(bool Visible);
+
+	// Shared with UProjectileSimulationSubsystem so pooled and actor projectiles resolve hits identically
+	static float CalculateImpactDamage(const class AUnitBase* ShootingUnit, const AUnitBase* UnitToHit, float BaseDamage, bool bUseAttributeDamage);
+	static void FireImpactEffects(AUnitBase* ShootingUnit, AUnitBase* UnitToHit, UNiagaraSystem* InImpactVFX, USoundBase* InImpactSound, const FVector& InScaleImpactVFX, float InScaleImpactSound, float ImpactZ);
+	static void ApplyIsAttacked(UWorld* World, AUnitBase* UnitToHit);
 };
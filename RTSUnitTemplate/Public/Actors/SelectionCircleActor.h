@@ -40,8 +40,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
     void SetCircleBounds(const FVector2D& Min, const FVector2D& Max);
 
-    UFUNCTION(NetMulticast, Unreliable, Category = RTSUnitTemplate)
-    void Multicast_UpdateSelectionCircles(const TArray<FVector_NetQuantize>& Positions, const TArray<float>& WorldRadii);
+    // Local, non-replicated update from the owning client's selection
+    UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
+    void UpdateSelectionCircles_Local(const TArray<FVector>& Positions, const TArray<float>& WorldRadii);
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
     int32 CircleMapSize = 200.f;
@@ -61,12 +62,21 @@ public:
 private:
     FTimerHandle SelectionCircleUpdateTimerHandle;
 
-    UFUNCTION(NetMulticast, Unreliable, Category = RTSUnitTemplate)
-    void Multicast_ApplyCircleMask();
+    // Shows the mask on the local team's actor once, then stops the retry timer
+    void ApplyCircleMask();
+
+    // Sets the 1px square outline of a rect (clipped to the texture) to Color
+    void DrawSquareOutline(const FIntRect& Square, const FColor& Color);
+
+    // Uploads only the given pixel rects of CirclePixels
+    void UploadCirclePixels(const TArray<FIntRect>& DirtyRects);
 
     UPROPERTY()
     UTexture2D* CircleMaskTexture;
 
     UPROPERTY()
     TArray<FColor> CirclePixels;
+
+    // Unclipped squares (center +- half side) currently drawn into CirclePixels
+    TArray<FIntRect> DrawnSquares;
 };
\ No newline at end of file
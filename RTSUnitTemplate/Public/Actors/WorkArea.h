@@ -69,8 +69,15 @@ public:
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
 	int TeamId = 0;
 
-	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
+	// Set through SetIsNoBuildZone at runtime, the placement index tracks no build zones by it
+	UPROPERTY(ReplicatedUsing = OnRep_IsNoBuildZone, EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetIsNoBuildZone, Category = RTSUnitTemplate)
 	bool IsNoBuildZone = false;
+
+	UFUNCTION(BlueprintSetter)
+	void SetIsNoBuildZone(bool bNewIsNoBuildZone);
+
+	UFUNCTION()
+	void OnRep_IsNoBuildZone();
 	
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
 	TSubclassOf<UGameplayEffect> AreaEffect;
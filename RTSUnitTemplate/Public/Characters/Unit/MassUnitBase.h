@@ -16,6 +16,8 @@ class UMassActorBindingComponent;
 class UInstancedStaticMeshComponent;
 class USelectionDecalComponent;
 class UNiagaraComponent;
+class UUnitTweenSubsystem;
+struct FUnitTweenTarget;
 
 #include "MassUnitBase.generated.h"
 
@@ -287,6 +289,11 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void OnConstruction(const FTransform& Transform) override;
 	
+	// Tween scheduler of this world while net.RTS.Tween.UseScheduler is on; otherwise nullptr and the timers below are used
+	UUnitTweenSubsystem* GetTweenScheduler() const;
+	// Tween target of the unit visual used by the *ISMLinear and PulsateISMScale tweens (ISM instance, ISM component or skeletal mesh)
+	bool GetVisualTweenTarget(FUnitTweenTarget& OutTarget);
+
 	// Smooth rotation controls (duration-based)
 	
 	float RotateDuration = 0.25f; // seconds to reach target; <=0 to snap
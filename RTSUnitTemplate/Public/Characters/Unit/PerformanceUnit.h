@@ -20,6 +20,7 @@ class UAudioComponent;
 struct FTimerHandle;
 class UUnitBaseHealthBar;
 class UUnitTimerWidget;
+struct FMassUnitVisibilityFragment;
 
 USTRUCT(BlueprintType)
 struct FActiveNiagaraEffect
@@ -145,6 +146,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void VisibilityTickFog();
 
+	// Called by UUnitVisibilityProcessor with this frame's viewport/team result; applies changes to the actor on transitions only
+	void ApplyProcessorVisibility(bool bOnViewport, bool bMyTeam, FMassUnitVisibilityFragment& State);
+
 	UFUNCTION(NetMulticast, Reliable, BlueprintCallable, Category = RTSUnitTemplate)
 	void SpawnDamageIndicator(const float Damage, FLinearColor HighColor, FLinearColor LowColor, float ColorOffset);
 	
@@ -13,6 +13,7 @@
 #include "Navigation/CrowdFollowingComponent.h"
 #include "NavigationSystem.h"
 #include "AI/Navigation/NavigationTypes.h"
+#include "Mass/Projectiles/ProjectileEvents.h"
 #include "UnitBase.generated.h"
 
 class UMeshComponent;
@@ -357,6 +358,15 @@ public:
 	UFUNCTION(Server, Reliable, BlueprintCallable, Category = RTSUnitTemplate)
 	void SpawnProjectileFromClass(AActor* Aim, AActor* Attacker, TSubclassOf<class AProjectile> ProjectileClass, int MaxPiercedTargets, bool FollowTarget, int ProjectileCount, float Spread, bool IsBouncingNext, bool IsBouncingBack, bool DisableAutoZOffset, float ZOffset, float Scale = 1.f, FVector SpawnOffset = FVector(0.f, 0.f, 0.f));
 
+	// Pooled projectiles (AProjectile::bUsePooledSimulation): one event per shot, simulated locally everywhere.
+	// Reliable: there is no actor to replicate a lost shot later, and follow-ups reference it by id
+	UFUNCTION(NetMulticast, Reliable)
+	void Multicast_SpawnPooledProjectile(const FProjectileSpawnEvent& Event);
+
+	// Bounce retargets and releases of this unit's pooled projectiles, one call per frame
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_PooledProjectileFollowUps(const TArray<FProjectileFollowUpEvent>& Events);
+
 	UFUNCTION(Server, Reliable, BlueprintCallable, Category = RTSUnitTemplate)
 	void SpawnProjectileFromClassWithAim(FVector Aim, TSubclassOf<class AProjectile> ProjectileClass, int MaxPiercedTargets, int ProjectileCount, float Spread, bool IsBouncingNext, bool IsBouncingBack, float ZOffset, float Scale = 1.f);
 	
@@ -81,6 +81,14 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
 	float TickInterval = 0.25f; 
+
+	// Channel for ground traces. Use a project trace channel that units and work areas ignore,
+	// then no ignore list is needed. On ECC_Visibility the cached unit/work area ignore list is used.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
+	TEnumAsByte<ECollisionChannel> GroundTraceChannel = ECC_Visibility;
+
+	// Line trace that passes through units and work areas
+	bool TraceGround(const FVector& Start, const FVector& End, FHitResult& HitResult, bool bTraceComplex, const AActor* ExtraIgnoredActor = nullptr) const;
 	
 	virtual void BeginPlay() override;
 
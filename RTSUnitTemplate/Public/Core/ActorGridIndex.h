@@ -0,0 +1,360 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Uniform XY grid over actors that stay in place while registered (work areas, bases).
+ * Nearest and k-nearest queries scan rings of cells around the query point and stop as soon as no
+ * unvisited cell can hold a closer actor. Distances are full 3D squared distances to the location the
+ * actor had when it was added, so results and ordering are those of a linear scan over the same actors.
+ * Radius and segment queries test an optional XY footprint radius per actor and return actors in Add order.
+ * Actors that move have to be updated (Update) or removed and added again, or the index is reset and refilled.
+ */
+template<typename ActorType>
+class TActorGridIndex
+{
+public:
+	// Closest first, Key = squared distance
+	typedef TPair<float, ActorType*> FNearestEntry;
+
+	void Reset()
+	{
+		Cells.Reset();
+		CellByActor.Reset();
+		MinCell = FIntPoint(MAX_int32, MAX_int32);
+		MaxCell = FIntPoint(MIN_int32, MIN_int32);
+		MaxRadius = 0.f;
+		NextSequence = 0;
+	}
+
+	// Re-buckets the registered actors if the size changes
+	void SetCellSize(float InCellSize)
+	{
+		const float NewCellSize = FMath::Max(InCellSize, 1.f);
+		if (NewCellSize == CellSize)
+		{
+			return;
+		}
+
+		TArray<FEntry> Entries;
+		Entries.Reserve(CellByActor.Num());
+		for (const TPair<FIntPoint, TArray<FEntry>>& Pair : Cells)
+		{
+			Entries.Append(Pair.Value);
+		}
+
+		// Footprints and Add order are kept
+		Cells.Reset();
+		CellByActor.Reset();
+		MinCell = FIntPoint(MAX_int32, MAX_int32);
+		MaxCell = FIntPoint(MIN_int32, MIN_int32);
+		CellSize = NewCellSize;
+		for (const FEntry& Entry : Entries)
+		{
+			if (Entry.Actor.IsValid())
+			{
+				AddEntry(Entry);
+			}
+		}
+	}
+
+	int32 Num() const { return CellByActor.Num(); }
+
+	bool Contains(const ActorType* Actor) const { return Actor && CellByActor.Contains(Actor); }
+
+	// Radius is the actor's XY footprint around its location, used by GatherInRadius and GatherAlongSegment
+	void Add(ActorType* Actor, float Radius = 0.f)
+	{
+		if (Actor && !CellByActor.Contains(Actor))
+		{
+			AddEntry({ Actor, Actor->GetActorLocation(), Radius, NextSequence++ });
+		}
+	}
+
+	// Adds an actor at a location other than its actor location (e.g. its Mass transform), with a footprint half height for GatherInSphere
+	void Add(ActorType* Actor, const FVector& Location, float Radius, float HalfHeight)
+	{
+		if (Actor && !CellByActor.Contains(Actor))
+		{
+			AddEntry({ Actor, Location, Radius, NextSequence++, HalfHeight });
+		}
+	}
+
+	// Re-buckets a registered actor at its current location and footprint, keeping its place in Add order
+	bool Update(ActorType* Actor, float Radius = 0.f)
+	{
+		FEntry Entry;
+		if (!Actor || !RemoveEntry(Actor, Entry))
+		{
+			return false;
+		}
+		Entry.Actor = Actor;
+		Entry.Location = Actor->GetActorLocation();
+		Entry.Radius = Radius;
+		AddEntry(Entry);
+		return true;
+	}
+
+	void Remove(ActorType* Actor)
+	{
+		FEntry Entry;
+		RemoveEntry(Actor, Entry);
+	}
+
+	// Closest valid actor accepted by Filter, nullptr if there is none
+	template<typename FilterType>
+	ActorType* FindNearest(const FVector& Location, FilterType&& Filter) const
+	{
+		TArray<FNearestEntry, TInlineAllocator<1>> Nearest;
+		GatherNearest(Location, 1, Filter, Nearest);
+		return Nearest.Num() > 0 ? Nearest[0].Value : nullptr;
+	}
+
+	/**
+	 * Merges the closest valid actors accepted by Filter into InOutNearest, which stays sorted and holds at
+	 * most MaxCount entries. Several indices can gather into the same array to get the closest over all of them.
+	 */
+	template<typename FilterType, typename AllocatorType>
+	void GatherNearest(const FVector& Location, int32 MaxCount, FilterType&& Filter, TArray<FNearestEntry, AllocatorType>& InOutNearest) const
+	{
+		if (MaxCount <= 0 || Cells.IsEmpty())
+		{
+			return;
+		}
+
+		const FIntPoint Center = GetCell(Location);
+		const int32 MaxRing = FMath::Max(
+			FMath::Max(FMath::Abs(Center.X - MinCell.X), FMath::Abs(MaxCell.X - Center.X)),
+			FMath::Max(FMath::Abs(Center.Y - MinCell.Y), FMath::Abs(MaxCell.Y - Center.Y)));
+
+		for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+		{
+			// Every cell of this ring is at least (Ring - 1) cells away from the query point
+			if (Ring > 1 && InOutNearest.Num() >= MaxCount && InOutNearest.Last().Key <= FMath::Square((Ring - 1) * CellSize))
+			{
+				break;
+			}
+
+			const int32 MinY = FMath::Max(Center.Y - Ring, MinCell.Y);
+			const int32 MaxY = FMath::Min(Center.Y + Ring, MaxCell.Y);
+			for (int32 X = FMath::Max(Center.X - Ring, MinCell.X); X <= FMath::Min(Center.X + Ring, MaxCell.X); ++X)
+			{
+				// Inner columns only touch the ring at the top and bottom row
+				const bool bEdgeColumn = FMath::Abs(X - Center.X) == Ring;
+				const int32 Step = bEdgeColumn ? 1 : FMath::Max(2 * Ring, 1);
+				for (int32 Y = bEdgeColumn ? MinY : Center.Y - Ring; Y <= MaxY; Y += Step)
+				{
+					if (Y < MinY)
+					{
+						continue;
+					}
+					if (const TArray<FEntry>* Entries = Cells.Find(FIntPoint(X, Y)))
+					{
+						GatherCell(*Entries, Location, MaxCount, Filter, InOutNearest);
+					}
+				}
+			}
+		}
+	}
+
+	// Appends the valid actors whose footprint comes within Radius (XY) of Location, in Add order
+	template<typename AllocatorType>
+	void GatherInRadius(const FVector& Location, float Radius, TArray<ActorType*, AllocatorType>& OutActors) const
+	{
+		const FVector2D Center(Location);
+		GatherInBox(Center - FVector2D(Radius), Center + FVector2D(Radius), [&Center, Radius](const FEntry& Entry)
+		{
+			return FVector2D::Distance(Center, FVector2D(Entry.Location)) <= Radius + Entry.Radius;
+		}, OutActors);
+	}
+
+	// Like GatherInRadius, but also requires the sphere to reach the footprint's vertical extent (location Z +- half height)
+	template<typename AllocatorType>
+	void GatherInSphere(const FVector& Location, float Radius, TArray<ActorType*, AllocatorType>& OutActors) const
+	{
+		const FVector2D Center(Location);
+		GatherInBox(Center - FVector2D(Radius), Center + FVector2D(Radius), [&Location, &Center, Radius](const FEntry& Entry)
+		{
+			return FVector2D::Distance(Center, FVector2D(Entry.Location)) <= Radius + Entry.Radius
+				&& FMath::Abs(Location.Z - Entry.Location.Z) <= Radius + Entry.HalfHeight;
+		}, OutActors);
+	}
+
+	// Appends the valid actors whose footprint crosses the XY projection of the segment, in Add order
+	template<typename AllocatorType>
+	void GatherAlongSegment(const FVector& Start, const FVector& End, TArray<ActorType*, AllocatorType>& OutActors) const
+	{
+		const FVector SegmentStart(Start.X, Start.Y, 0.f);
+		const FVector SegmentEnd(End.X, End.Y, 0.f);
+		const FVector2D BoxMin(FMath::Min(Start.X, End.X), FMath::Min(Start.Y, End.Y));
+		const FVector2D BoxMax(FMath::Max(Start.X, End.X), FMath::Max(Start.Y, End.Y));
+		GatherInBox(BoxMin, BoxMax, [&SegmentStart, &SegmentEnd](const FEntry& Entry)
+		{
+			const FVector Point(Entry.Location.X, Entry.Location.Y, 0.f);
+			return FMath::PointDistToSegment(Point, SegmentStart, SegmentEnd) <= Entry.Radius;
+		}, OutActors);
+	}
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<ActorType> Actor;
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.f;
+		// Add order, radius and segment results are sorted by it
+		uint32 Sequence = 0;
+		// Vertical extent around Location, only tested by GatherInSphere
+		float HalfHeight = 0.f;
+	};
+
+	void AddEntry(const FEntry& Entry)
+	{
+		const FIntPoint Cell = GetCell(Entry.Location);
+		Cells.FindOrAdd(Cell).Add(Entry);
+		CellByActor.Add(Entry.Actor.Get(), Cell);
+		MinCell = FIntPoint(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y));
+		MaxCell = FIntPoint(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y));
+		// Only grows, which keeps the radius and segment queries conservative
+		MaxRadius = FMath::Max(MaxRadius, Entry.Radius);
+	}
+
+	bool RemoveEntry(const ActorType* Actor, FEntry& OutEntry)
+	{
+		FIntPoint Cell;
+		if (!Actor || !CellByActor.RemoveAndCopyValue(Actor, Cell))
+		{
+			return false;
+		}
+
+		if (TArray<FEntry>* Entries = Cells.Find(Cell))
+		{
+			const int32 Index = Entries->IndexOfByPredicate([Actor](const FEntry& Entry) { return Entry.Actor == Actor; });
+			if (Index != INDEX_NONE)
+			{
+				OutEntry = (*Entries)[Index];
+				Entries->RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			}
+			if (Entries->IsEmpty())
+			{
+				Cells.Remove(Cell);
+			}
+		}
+		return true;
+	}
+
+	int32 GetCellCoord(double Value) const
+	{
+		return FMath::FloorToInt(Value / CellSize);
+	}
+
+	FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(GetCellCoord(Location.X), GetCellCoord(Location.Y));
+	}
+
+	// Visits every entry whose footprint can overlap the XY box, keeps those passing Test and appends them in Add order
+	template<typename TestType, typename AllocatorType>
+	void GatherInBox(const FVector2D& BoxMin, const FVector2D& BoxMax, TestType&& Test, TArray<ActorType*, AllocatorType>& OutActors) const
+	{
+		if (Cells.IsEmpty())
+		{
+			return;
+		}
+
+		// Entries are bucketed by actor location, footprints reach at most MaxRadius beyond it
+		const FIntPoint FirstCell(FMath::Max(GetCellCoord(BoxMin.X - MaxRadius), MinCell.X), FMath::Max(GetCellCoord(BoxMin.Y - MaxRadius), MinCell.Y));
+		const FIntPoint LastCell(FMath::Min(GetCellCoord(BoxMax.X + MaxRadius), MaxCell.X), FMath::Min(GetCellCoord(BoxMax.Y + MaxRadius), MaxCell.Y));
+		if (FirstCell.X > LastCell.X || FirstCell.Y > LastCell.Y)
+		{
+			return;
+		}
+
+		TArray<const FEntry*, TInlineAllocator<32>> Found;
+		auto VisitCell = [&Found, &Test](const TArray<FEntry>& Entries)
+		{
+			for (const FEntry& Entry : Entries)
+			{
+				if (Test(Entry) && IsValid(Entry.Actor.Get()))
+				{
+					Found.Add(&Entry);
+				}
+			}
+		};
+
+		// Large boxes and long segments touch more cells than are occupied; walk the occupied cells instead
+		const int64 NumCells = int64(LastCell.X - FirstCell.X + 1) * int64(LastCell.Y - FirstCell.Y + 1);
+		if (NumCells > Cells.Num())
+		{
+			for (const TPair<FIntPoint, TArray<FEntry>>& Pair : Cells)
+			{
+				if (Pair.Key.X >= FirstCell.X && Pair.Key.X <= LastCell.X && Pair.Key.Y >= FirstCell.Y && Pair.Key.Y <= LastCell.Y)
+				{
+					VisitCell(Pair.Value);
+				}
+			}
+		}
+		else
+		{
+			for (int32 X = FirstCell.X; X <= LastCell.X; ++X)
+			{
+				for (int32 Y = FirstCell.Y; Y <= LastCell.Y; ++Y)
+				{
+					if (const TArray<FEntry>* Entries = Cells.Find(FIntPoint(X, Y)))
+					{
+						VisitCell(*Entries);
+					}
+				}
+			}
+		}
+
+		Found.Sort([](const FEntry& A, const FEntry& B)
+		{
+			return A.Sequence < B.Sequence;
+		});
+		OutActors.Reserve(OutActors.Num() + Found.Num());
+		for (const FEntry* Entry : Found)
+		{
+			OutActors.Add(Entry->Actor.Get());
+		}
+	}
+
+	template<typename FilterType, typename AllocatorType>
+	static void GatherCell(const TArray<FEntry>& Entries, const FVector& Location, int32 MaxCount, FilterType& Filter, TArray<FNearestEntry, AllocatorType>& InOutNearest)
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			const float DistanceSquared = (Entry.Location - Location).SizeSquared();
+			if (InOutNearest.Num() >= MaxCount && DistanceSquared >= InOutNearest.Last().Key)
+			{
+				continue;
+			}
+
+			ActorType* Actor = Entry.Actor.Get();
+			if (!IsValid(Actor) || !Filter(Actor))
+			{
+				continue;
+			}
+
+			int32 Index = InOutNearest.Num();
+			while (Index > 0 && InOutNearest[Index - 1].Key > DistanceSquared)
+			{
+				--Index;
+			}
+			if (InOutNearest.Num() >= MaxCount)
+			{
+				InOutNearest.Pop(EAllowShrinking::No);
+			}
+			InOutNearest.Insert(FNearestEntry(DistanceSquared, Actor), Index);
+		}
+	}
+
+	float CellSize = 2000.f;
+	TMap<FIntPoint, TArray<FEntry>> Cells;
+	TMap<TObjectKey<ActorType>, FIntPoint> CellByActor;
+	FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+	FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+	float MaxRadius = 0.f;
+	uint32 NextSequence = 0;
+};
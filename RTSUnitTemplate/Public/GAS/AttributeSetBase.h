@@ -18,6 +18,10 @@ GAMEPLAYATTRIBUTE_VALUE_GETTER(PropertyName) \
 GAMEPLAYATTRIBUTE_VALUE_SETTER(PropertyName) \
 GAMEPLAYATTRIBUTE_VALUE_INITTER(PropertyName)
 
+class UAttributeSetBase;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDirectHealthWrite, UAttributeSetBase*);
+
 /**
  * 
  */
@@ -93,6 +97,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void SetAttributeHealth(float NewHealth);
 
+	// Broadcast by SetAttributeHealth / SetAttributeShield, which bypass the ability system component's change delegates
+	FOnDirectHealthWrite OnDirectHealthWrite;
+
 	// Shield //
 	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Attributes", SaveGame, ReplicatedUsing= OnRep_Shield)
 	FGameplayAttributeData Shield;
@@ -22,6 +22,7 @@ class ARTSBTController;
 class UBehaviorTree;
 class UWorld;
 class AUnitBase;
+class ASpawnerUnit;
 class AWinLoseConfigActor;
 class ULoadingWidget;
 
@@ -122,6 +123,16 @@ public:
 	UPROPERTY()
 	TMap<int32, FTagCountMap> TeamTagsAliveCountMap;
 
+	UPROPERTY()
+	TMap<int32, int32> TeamBuildingsAliveCountMap;
+
+	// Alive counters are kept incrementally (server only): units register when they start play,
+	// unregister on death or EndPlay, so win/lose checks no longer rescan every unit.
+	void RegisterAliveUnit(ASpawnerUnit* Unit);
+	void UnregisterAliveUnit(ASpawnerUnit* Unit);
+	// Re-reads TeamId/UnitTags of a registered unit after they changed
+	void RefreshAliveUnit(ASpawnerUnit* Unit);
+
 	bool IsAnyUnitWithTagAlive(const FGameplayTag& Tag, const TMap<FGameplayTag, int32>& AliveTagCounts) const;
 
 	UFUNCTION(BlueprintCallable, Category = "RTSUnitTemplate|WinLose")
@@ -133,6 +144,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RTSUnitTemplate|WinLose")
 	virtual float GetResource(int32 TeamId, EResourceType ResourceType) const;
 
+	// Records DestroyedUnit and schedules one win/lose evaluation for the next tick, shared by all calls of this frame
 	virtual void CheckWinLoseCondition(AUnitBase* DestroyedUnit = nullptr);
 
 	void TriggerWinLoseForPlayer(ACameraControllerBase* PC, bool bWon, AWinLoseConfigActor* Config);
@@ -243,5 +255,27 @@ public:
 
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	
+private:
+	struct FAliveUnitRecord
+	{
+		int32 TeamId = 0;
+		FGameplayTagContainer Tags;
+		bool bIsBuilding = false;
+	};
+
+	void AddAliveRecord(const FAliveUnitRecord& Record);
+	void RemoveAliveRecord(const FAliveUnitRecord& Record);
+
+	void EvaluateWinLoseCondition();
+
+#if !UE_BUILD_SHIPPING
+	// Debug: compares the incremental counters against a full scan of all units
+	void ValidateAliveCounters() const;
+#endif
+
+	TMap<TObjectKey<ASpawnerUnit>, FAliveUnitRecord> AliveUnitRecords;
+
+	bool bWinLoseEvaluationPending = false;
+	// Tags of every unit passed to CheckWinLoseCondition before the pending evaluation, per team
+	TMap<int32, FGameplayTagContainer> PendingDestroyedTagsByTeam;
 };
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "Actors/WorkArea.h"
 #include "Characters/Unit/WorkingUnitBase.h"
 #include "Characters/Unit/BuildingBase.h"
+#include "Core/ActorGridIndex.h"
 #include "ResourceGameMode.generated.h"
 
 /**
@@ -61,6 +62,13 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void AddBaseToGroup(ABuildingBase* BuildingBase);
+
+	// Adds the area to its WorkAreaGroups array and to the spatial index of its type
+	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
+	void AddWorkAreaToGroup(AWorkArea* WorkArea);
+
+	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
+	void RemoveWorkAreaFromGroup(AWorkArea* WorkArea);
 	
 protected:
 	virtual void BeginPlay() override; // Override BeginPlay
@@ -74,6 +82,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Work)
 	float HighestMaxResource = 200.0f;
 
+	// Cell size of the grids answering the closest base / work area queries (net.RTS.Work.SpatialIndex)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Work)
+	float WorkAreaIndexCellSize = 2000.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Work)
 	TMap<EResourceType, bool> SupplyLikeResources;
 	
@@ -192,8 +204,60 @@ public:
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void SetAllCurrentWorkers(int TeamId);
 
+	// Per team worker registry; workers register on BeginPlay and leave on EndPlay
+	void RegisterWorker(AWorkingUnitBase* Worker);
+	void UnregisterWorker(AWorkingUnitBase* Worker);
+
+	// Call after a worker's ResourcePlace, TeamId or controller changed
+	void UpdateWorkerAssignment(AWorkingUnitBase* Worker);
+
+	// Workers assigned to the area no longer count for its resource type
+	void HandleWorkAreaEndPlay(AWorkArea* WorkArea);
+
+	// Workers (IsWorker) of the team, as AddMaxWorkersForResourceType counts them
+	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
+	int32 GetTeamWorkerCount(int32 TeamId) const;
+
+	// Workers of the team with a resource place of this type and a worker controller, as SetAllCurrentWorkers counts them
+	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
+	int32 GetAssignedWorkerCount(int32 TeamId, EResourceType ResourceType) const;
+
 	virtual void CheckWinLoseCondition(AUnitBase* DestroyedUnit = nullptr) override;
 
 private:
 	void CheckWinLoseConditionTimer();
+
+	TActorGridIndex<AWorkArea>* GetWorkAreaIndex(WorkAreaData::WorkAreaType Type);
+
+	// Closest resource areas of all types to the worker's base (or the worker), closest first
+	TArray<AWorkArea*> GatherClosestResourcePlaces(AWorkingUnitBase* Worker);
+
+	// One grid per resource area type (Primary .. Legendary), one for build areas and one for the bases of all teams
+	TActorGridIndex<AWorkArea> ResourceAreaIndices[static_cast<int32>(EResourceType::MAX)];
+	TActorGridIndex<AWorkArea> BuildAreaIndex;
+	TActorGridIndex<ABuildingBase> BaseIndex;
+
+	struct FRegisteredWorker
+	{
+		int32 TeamId = 0;
+		bool bIsWorker = false;
+		// Only set while the worker has a resource place and a worker controller
+		TWeakObjectPtr<AWorkArea> AssignedPlace;
+		EResourceType AssignedType = EResourceType::MAX;
+	};
+
+	struct FTeamWorkers
+	{
+		int32 WorkerCount = 0;
+		int32 AssignedWorkers[static_cast<int32>(EResourceType::MAX)] = {};
+	};
+
+	static FRegisteredWorker DescribeWorker(AWorkingUnitBase* Worker);
+	void CountWorker(const FRegisteredWorker& Registered, int32 Delta);
+
+	// net.RTS.Work.VerifyWorkerRegistry: compares the registry against a scan over all workers
+	void VerifyWorkerRegistry(int32 TeamId) const;
+
+	TMap<TObjectKey<AWorkingUnitBase>, FRegisteredWorker> RegisteredWorkers;
+	TMap<int32, FTeamWorkers> TeamWorkers;
 };
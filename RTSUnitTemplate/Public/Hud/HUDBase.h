@@ -48,6 +48,13 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 		void SelectISMUnitsInRectangle(const FVector2D& RectMin, const FVector2D& RectMax);
+
+	// Commits the box selection of the current drag (squad expansion); DrawHUD calls it as well once bSelectFriendly is cleared
+	void EndSelectionDrag();
+
+	// Edge length in pixels of the screen cells the selectable units are binned into while dragging
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
+	float SelectionBinSize = 64.f;
 	
 		void Tick(float DeltaSeconds);
 
@@ -176,4 +183,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void DrawSelectedBuildingWaypointLinks();
 
+private:
+	// Selectable unit of the local team, gathered once when a drag starts
+	struct FSelectionCandidate
+	{
+		TWeakObjectPtr<AUnitBase> Unit;
+		bool bSkeletal = false;
+		bool bInBaseSelection = false;
+		bool bInRectangle = false;
+	};
+
+	void BeginSelectionDrag();
+
+	// Projects all candidates once, bins them by screen cell and selects / deselects the ones whose rectangle state changed
+	void UpdateSelectionDrag(bool bTestSkeletal, const FVector2D& SkeletalCornerA, const FVector2D& SkeletalCornerB, const FVector2D& ISMCornerA, const FVector2D& ISMCornerB);
+
+	bool bSelectionDragActive = false;
+	TArray<FSelectionCandidate> SelectionCandidates;
+
+	// Selection kept by a CTRL drag
+	TArray<TWeakObjectPtr<AUnitBase>> SelectionBaseUnits;
+
+	// Projected points of the current frame, sorted by screen cell; BinStarts[Cell] is the first point of the cell
+	TArray<FVector2f> SelectionPoints;
+	TArray<int32> SelectionPointCandidates;
+	TArray<int32> SelectionPointBins;
+	TArray<FVector2f> SelectionBinnedPoints;
+	TArray<int32> SelectionBinnedCandidates;
+	TArray<int32> SelectionBinStarts;
+	TArray<bool> SelectionInRectangle;
 };
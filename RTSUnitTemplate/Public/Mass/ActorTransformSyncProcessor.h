@@ -11,6 +11,13 @@
 // Forward declaration if needed
 class UMassRepresentationSubsystem;
 
+/** Transform of a unit entity, stored at its entity index for the duration of one Execute. */
+struct FUnitTransformSnapshotEntry
+{
+	FMassEntityHandle Entity;
+	const FTransformFragment* Transform = nullptr;
+};
+
 UCLASS()
 class RTSUNITTEMPLATE_API UActorTransformSyncProcessor : public UMassProcessor
 {
@@ -61,6 +68,10 @@ private:
 	FMassEntityQuery EntityQuery;
 
 	FMassEntityQuery ClientEntityQuery;
+
+	// All unit transforms, used to resolve attack targets without a per target fragment lookup
+	FMassEntityQuery TargetSnapshotQuery;
+	TArray<FUnitTransformSnapshotEntry> TargetTransformSnapshot;
 	
 	// Cache subsystem pointer for efficiency
 	UPROPERTY(Transient)
@@ -77,6 +88,10 @@ private:
 	//----------------------------------------------------------------------//
 	
 	bool ShouldProceedWithTick(const float ActualDeltaTime);
+
+	void BuildTargetTransformSnapshot(FMassExecutionContext& Context);
+
+	const FTransformFragment* FindTargetTransform(FMassEntityManager& EntityManager, const FMassEntityHandle& TargetEntity) const;
 	
 	void HandleGroundAndHeight(const AUnitBase* UnitBase, FMassAgentCharacteristicsFragment& CharFragment, const FVector& CurrentActorLocation, const float ActualDeltaTime, FTransform& MassTransform, FVector& InOutFinalLocation, bool bIsDead = false) const;
 	
@@ -6,7 +6,7 @@
 #include "LookAtProcessor.generated.h"
 
 /**
- * 
+ * Disabled. Rotation towards the attack target is done by UActorTransformSyncProcessor::RotateTowardsTarget.
  */
 UCLASS()
 class RTSUNITTEMPLATE_API ULookAtProcessor : public UMassProcessor
@@ -14,6 +14,36 @@
 #include "MassEntityUtils.h" // For CreateEntityFromConfig helper
 #include "MassActorBindingComponent.generated.h"
 
+struct FTransformFragment;
+struct FMassVelocityFragment;
+struct FMassMoveTargetFragment;
+struct FAgentRadiusFragment;
+struct FMassAvoidanceColliderFragment;
+struct FMassActorFragment;
+struct FMassRepresentationLODFragment;
+
+/**
+ * Fragments of a freshly created unit entity written by the Init* helpers.
+ * UMassUnitSpawnerSubsystem fills them from chunk views during batched creation; FromEntity resolves them one by one.
+ * Null where the entity's archetype lacks the fragment.
+ */
+struct FMassNewEntityFragments
+{
+	FTransformFragment* Transform = nullptr;
+	FMassVelocityFragment* Velocity = nullptr;
+	FMassMoveTargetFragment* MoveTarget = nullptr;
+	FMassCombatStatsFragment* CombatStats = nullptr;
+	FMassAgentCharacteristicsFragment* Characteristics = nullptr;
+	FMassAIStateFragment* AIState = nullptr;
+	FMassPatrolFragment* Patrol = nullptr;
+	FAgentRadiusFragment* AgentRadius = nullptr;
+	FMassAvoidanceColliderFragment* AvoidanceCollider = nullptr;
+	FMassAITargetFragment* AITarget = nullptr;
+	FMassActorFragment* Actor = nullptr;
+	FMassRepresentationLODFragment* RepresentationLOD = nullptr;
+
+	static FMassNewEntityFragments FromEntity(const FMassEntityManager& EntityManager, FMassEntityHandle Handle);
+};
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class RTSUNITTEMPLATE_API UMassActorBindingComponent : public USceneComponent
@@ -70,6 +100,17 @@ public:
 	
 	FMassEntityHandle CreateAndLinkBuildingToMassEntity();
 
+	// Post-creation part of the two functions above, also used by UMassUnitSpawnerSubsystem batch creation
+	void LinkOwnerToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle);
+	void LinkBuildingToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle);
+
+	// LinkOwnerToNewMassEntity without the fragment fill, so batched creation can fill whole chunks in between
+	void BeginLinkOwnerToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle);
+	void FinishLinkOwnerToNewMassEntity(FMassEntityManager& EM, FMassEntityHandle NewMassEntityHandle);
+
+	// Returns false if this component should not get an entity right now
+	bool PrepareBatchedEntityCreation(FMassArchetypeHandle& OutArchetype, FMassArchetypeSharedFragmentValues& OutSharedValues);
+
 	// Client-side request to queue safe Mass link after server creation
 	UFUNCTION(BlueprintCallable, Category = Mass)
 	void RequestClientMassLink();
@@ -78,6 +119,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Mass)
 	void RequestClientMassUnlink();
 
+	// Cached per unit class/config in URTSWorldCacheSubsystem; falls back to BuildArchetypeAndSharedValues on a miss
+	bool GetOrBuildArchetypeAndSharedValues(FMassArchetypeHandle& OutArchetype,
+									   FMassArchetypeSharedFragmentValues& OutSharedValues);
+
 	// Helpers to build archetype and shared values
 	bool BuildArchetypeAndSharedValues(FMassArchetypeHandle& OutArchetype,
 									   FMassArchetypeSharedFragmentValues& OutSharedValues);
@@ -93,6 +138,15 @@ public:
 	void InitRepresentation(FMassEntityManager& EntityManager, const FMassEntityHandle& Handle);
 	void InitStats(FMassEntityManager& EntityManager, const FMassEntityHandle& Handle, AActor* OwnerActor);
 
+	// Same fills on already resolved fragments (chunk views in UMassUnitSpawnerSubsystem::CreateEntitiesBatched)
+	void InitTransform(const FMassNewEntityFragments& Fragments);
+	void InitMovementFragments(const FMassNewEntityFragments& Fragments);
+	void InitRepresentation(const FMassNewEntityFragments& Fragments, FMassEntityHandle Handle);
+	void InitializeMassEntityStatsFromOwner(const FMassNewEntityFragments& Fragments, AActor* OwnerActor);
+
+	// Actor-side GAS setup, must run before the stats are read from the attributes
+	void InitOwnerAbilitySystem(AActor* OwnerActor);
+
 
 	
 	void InitializeMassEntityStatsFromOwner(FMassEntityManager& EntityManager, FMassEntityHandle EntityHandle, AActor* OwnerActor); // <<< ADD THIS
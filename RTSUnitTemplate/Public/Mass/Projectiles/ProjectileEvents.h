@@ -0,0 +1,74 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "ProjectileEvents.generated.h"
+
+class AProjectile;
+class AUnitBase;
+
+/**
+ * Everything a client needs to simulate a pooled projectile on its own.
+ * Sent once per shot through AUnitBase::Multicast_SpawnPooledProjectile.
+ */
+USTRUCT()
+struct FProjectileSpawnEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AProjectile> ProjectileClass;
+
+	// Target actor is serialized as its NetGUID; may be null for location shots
+	UPROPERTY()
+	TObjectPtr<AUnitBase> Target = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize Origin = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantize ArcOrigin = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantize TargetLocation = FVector::ZeroVector;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FVector_NetQuantize100 Scale = FVector::OneVector;
+
+	UPROPERTY()
+	float Speed = 0.f;
+
+	// Server assigned id, used to address the projectile in follow-up events (bounce retargets)
+	UPROPERTY()
+	int32 ProjectileId = INDEX_NONE;
+};
+
+/**
+ * Server decided bounce retarget or release of a pooled projectile.
+ * Collected per frame and sent unreliably through AUnitBase::Multicast_PooledProjectileFollowUps.
+ */
+USTRUCT()
+struct FProjectileFollowUpEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ProjectileId = INDEX_NONE;
+
+	// Ignored for releases
+	UPROPERTY()
+	TObjectPtr<AUnitBase> NewTarget = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize NewTargetLocation = FVector::ZeroVector;
+
+	UPROPERTY()
+	bool bBouncedBack = false;
+
+	UPROPERTY()
+	bool bRelease = false;
+};
@@ -0,0 +1,31 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "Mass/Projectiles/ProjectileSimulationSubsystem.h"
+#include "ProjectileSimulationProcessor.generated.h"
+
+/**
+ * Drives UProjectileSimulationSubsystem once per frame. Refills the unit hit index from Mass data and
+ * actor AI units (only while location/arc projectiles are in flight) and advances all pooled projectiles.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UProjectileSimulationProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UProjectileSimulationProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery UnitQuery;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UProjectileSimulationSubsystem> ProjectileSubsystem;
+};
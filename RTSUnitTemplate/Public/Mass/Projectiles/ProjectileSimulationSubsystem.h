@@ -0,0 +1,177 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/ActorGridIndex.h"
+#include "Characters/Unit/UnitBase.h"
+#include "Mass/Projectiles/ProjectileEvents.h"
+#include "ProjectileSimulationSubsystem.generated.h"
+
+class AProjectile;
+class UGameplayEffect;
+class UInstancedStaticMeshComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
+class USoundBase;
+
+/** Per projectile class data, read once from the class default object. */
+USTRUCT()
+struct FProjectileClassConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AProjectile> ProjectileClass;
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> ISM = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> NiagaraA = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> NiagaraB = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> ImpactVFX = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<USoundBase> ImpactSound = nullptr;
+
+	UPROPERTY()
+	TSubclassOf<UGameplayEffect> ProjectileEffect;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> FreeNiagaraA;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> FreeNiagaraB;
+
+	FTransform NiagaraAStart = FTransform::Identity;
+	FTransform NiagaraBStart = FTransform::Identity;
+	TArray<int32> FreeInstances;
+
+	FVector ScaleImpactVFX = FVector::OneVector;
+	FVector RotationSpeed = FVector::ZeroVector;
+	float ScaleImpactSound = 1.f;
+	float ArcHeight = 0.f;
+	float ArcHeightDistanceFactor = 0.f;
+	float MaxLifeTime = 2.f;
+	float CollisionRadius = 0.f;
+	float OverlapCheckInterval = 0.1f;
+	float DestructionDelayTime = 0.1f;
+	int32 MaxPiercedTargets = 1;
+	bool bFollowTarget = false;
+	bool bRotateMesh = false;
+	bool bIsHealing = false;
+	bool bIsBouncingBack = false;
+	bool bIsBouncingNext = false;
+	bool bUseAttributeDamage = true;
+	bool bInstancesDirty = false;
+};
+
+/**
+ * Dense, actor free projectile simulation. Replaces per-shot AProjectile actors for classes
+ * that set bUsePooledSimulation. The server applies damage, clients only simulate the flight
+ * from the spawn event. Visuals are pooled ISM instances and Niagara components per class.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UProjectileSimulationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	static bool IsPooledSimulationEnabled(TSubclassOf<AProjectile> ProjectileClass);
+
+	// Server: allocate an id for a new shot
+	int32 AllocateProjectileId() { return NextProjectileId++; }
+
+	void SpawnFromEvent(const FProjectileSpawnEvent& Event, AUnitBase* Shooter, bool bAuthority);
+	// Server driven follow-ups for bouncing projectiles, applied on every machine
+	void RetargetProjectile(int32 ProjectileId, AUnitBase* NewTarget, const FVector& NewTargetLocation, bool bBouncedBack);
+	void ReleaseProjectile(int32 ProjectileId);
+	void ApplyFollowUps(const TArray<FProjectileFollowUpEvent>& Events);
+
+	bool HasActiveProjectiles() const { return Ids.Num() > 0; }
+	bool NeedsHitGrid() const;
+	// Refilled by UProjectileSimulationProcessor with Mass and actor AI units while NeedsHitGrid is true
+	TActorGridIndex<AUnitBase>& GetHitIndexMutable() { return HitIndex; }
+
+	void Advance(float DeltaTime);
+
+	void ResetSystem();
+
+private:
+	int32 FindOrAddClassConfig(TSubclassOf<AProjectile> ProjectileClass);
+	AActor* GetOrCreateVisualHost();
+
+	void AcquireVisuals(int32 Slot);
+	void ReleaseVisuals(int32 Slot);
+	void UpdateVisuals(int32 Slot);
+	void FlushInstanceUpdates();
+
+	void RemoveSlot(int32 Slot);
+
+	void FlyToUnitTarget(int32 Slot, float DeltaTime);
+	void FlyToLocationTarget(int32 Slot, float DeltaTime);
+	void FlyInArc(int32 Slot, float DeltaTime);
+
+	void ResolveOverlap(int32 Slot, AUnitBase* UnitToHit);
+	void ResolveImpact(int32 Slot, AUnitBase* UnitToHit);
+	void ResolveImpactHeal(int32 Slot, AUnitBase* UnitToHit);
+	void ContinueAfterImpact(int32 Slot, AUnitBase* UnitToHit);
+	void SetNextBouncing(int32 Slot, AUnitBase* ShootingUnit, AUnitBase* UnitToHit);
+	void SetBackBouncing(int32 Slot, AUnitBase* ShootingUnit);
+	void DestroyWhenMaxPierced(int32 Slot);
+	void DestroyWithDelay(int32 Slot);
+	void ResetShooterTarget(int32 Slot);
+
+	// Server: apply a follow-up locally now and send it to clients with the next flush
+	void QueueFollowUp(int32 Slot, AUnitBase* NewTarget, const FVector& NewTargetLocation, bool bBouncedBack, bool bRelease);
+	void FlushFollowUps();
+
+	UPROPERTY(Transient)
+	TArray<FProjectileClassConfig> ClassConfigs;
+
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> VisualHost = nullptr;
+
+	// --- Dense per projectile state, indexed by slot (swap-removed) ---
+	TArray<int32> Ids;
+	TArray<int32> ClassIndices;
+	TArray<TWeakObjectPtr<AUnitBase>> Shooters;
+	TArray<TWeakObjectPtr<AUnitBase>> Targets;
+	TArray<int32> TeamIds;
+	TArray<FTransform> Transforms;
+	TArray<FVector> FlightDirections;
+	TArray<FVector> TargetLocations;
+	TArray<FVector> ArcStartLocations;
+	TArray<float> Speeds;
+	// Shooter attack damage at spawn, like AProjectile::Init; only used with authority
+	TArray<float> Damages;
+	TArray<float> LifeTimes;
+	TArray<float> ArcTravelTimes;
+	TArray<float> OverlapTimers;
+	// < 0 while alive, counts down DestructionDelayTime once the projectile is finished
+	TArray<float> DestroyTimers;
+	TArray<int32> PiercedCounts;
+	TArray<TArray<TWeakObjectPtr<AUnitBase>, TInlineAllocator<2>>> PiercedUnits;
+	TArray<int32> InstanceIndices;
+	TArray<TWeakObjectPtr<UNiagaraComponent>> NiagaraAComponents;
+	TArray<TWeakObjectPtr<UNiagaraComponent>> NiagaraBComponents;
+	TArray<uint8> AuthorityFlags;
+	TArray<uint8> BouncedBackFlags;
+	TArray<uint8> VisibleFlags;
+
+	TMap<int32, int32> SlotById;
+
+	TActorGridIndex<AUnitBase> HitIndex;
+	TArray<int32> SlotsPendingRemoval;
+	// Follow-ups of this frame per shooter, sent as one unreliable multicast each
+	TMap<TWeakObjectPtr<AUnitBase>, TArray<FProjectileFollowUpEvent>> PendingFollowUps;
+	int32 NextProjectileId = 1;
+};
@@ -2,6 +2,8 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "UObject/WeakObjectPtr.h"
+#include "UObject/ObjectKey.h"
+#include "MassArchetypeTypes.h"
 class FSubsystemCollectionBase;
 class AUnitRegistryReplicator;
 class AUnitClientBubbleInfo;
@@ -9,6 +11,48 @@ class UMassActorBindingComponent;
 
 #include "RTSWorldCacheSubsystem.generated.h"
 
+// Everything that changes the archetype or shared fragment values built by
+// UMassActorBindingComponent::BuildArchetypeAndSharedValues
+struct FMassUnitArchetypeKey
+{
+	TObjectKey<UClass> UnitClass;
+	bool bAddEffectTargetFragment = false;
+	bool bAddGameplayEffectFragment = false;
+	bool bStopSeparation = false;
+	float RunSpeed = 0.f;
+	float MaxAcceleration = 0.f;
+	float AvoidanceDistance = 0.f;
+	float ObstacleSeparationStiffness = 0.f;
+
+	bool operator==(const FMassUnitArchetypeKey& Other) const
+	{
+		return UnitClass == Other.UnitClass
+			&& bAddEffectTargetFragment == Other.bAddEffectTargetFragment
+			&& bAddGameplayEffectFragment == Other.bAddGameplayEffectFragment
+			&& bStopSeparation == Other.bStopSeparation
+			&& RunSpeed == Other.RunSpeed
+			&& MaxAcceleration == Other.MaxAcceleration
+			&& AvoidanceDistance == Other.AvoidanceDistance
+			&& ObstacleSeparationStiffness == Other.ObstacleSeparationStiffness;
+	}
+
+	friend uint32 GetTypeHash(const FMassUnitArchetypeKey& Key)
+	{
+		uint32 Hash = GetTypeHash(Key.UnitClass);
+		Hash = HashCombineFast(Hash, (uint32)Key.bAddEffectTargetFragment | ((uint32)Key.bAddGameplayEffectFragment << 1) | ((uint32)Key.bStopSeparation << 2));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.RunSpeed));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.MaxAcceleration));
+		Hash = HashCombineFast(Hash, GetTypeHash(Key.AvoidanceDistance));
+		return HashCombineFast(Hash, GetTypeHash(Key.ObstacleSeparationStiffness));
+	}
+};
+
+struct FMassUnitArchetypeEntry
+{
+	FMassArchetypeHandle Archetype;
+	FMassArchetypeSharedFragmentValues SharedValues;
+};
+
 UCLASS()
 class RTSUNITTEMPLATE_API URTSWorldCacheSubsystem : public UWorldSubsystem
 {
@@ -33,6 +77,10 @@ public:
 	// Find a binding by UnitIndex (preferred unique key)
 	UMassActorBindingComponent* FindBindingByUnitIndex(int32 UnitIndex);
 
+	// Archetype + shared fragment values per unit class/config, so spawns skip rebuilding them
+	const FMassUnitArchetypeEntry* FindUnitArchetype(const FMassUnitArchetypeKey& Key) const { return UnitArchetypes.Find(Key); }
+	void AddUnitArchetype(const FMassUnitArchetypeKey& Key, const FMassArchetypeHandle& Archetype, const FMassArchetypeSharedFragmentValues& SharedValues);
+
 	// Clear caches explicitly
 	void ClearAll();
 
@@ -42,4 +90,5 @@ private:
 	TMap<FName, TWeakObjectPtr<UMassActorBindingComponent>> BindingByOwnerName;
 	TMap<int32, TWeakObjectPtr<UMassActorBindingComponent>> BindingByUnitIndex;
 	double LastBindingRebuildTime = -1000.0;
+	TMap<FMassUnitArchetypeKey, FMassUnitArchetypeEntry> UnitArchetypes;
 };
\ No newline at end of file
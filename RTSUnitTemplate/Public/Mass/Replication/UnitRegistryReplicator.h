@@ -33,6 +33,9 @@ public:
 	// Server-only: block a NetID from being reused for NetIDQuarantineTime seconds
 	void QuarantineNetID(uint32 NetID);
 
+	// Server-only: MarkArrayDirty + ForceNetUpdate once on the next tick, however many items were marked this frame
+	void RequestRegistryNetUpdate();
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RTS|Replication")
 	float NetIDQuarantineTime = 60.0f;
 	
@@ -63,6 +66,9 @@ protected:
 private:
 	// Periodic diagnostics timer (server-only)
 	FTimerHandle DiagnosticsTimerHandle;
+
+	void FlushRegistryNetUpdate();
+	bool bRegistryNetUpdatePending = false;
 	
 	UPROPERTY(Transient)
 	uint32 NextNetID = 1; // not replicated; authoritative on server only
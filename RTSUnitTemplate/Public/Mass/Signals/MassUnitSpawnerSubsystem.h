@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Characters/Unit/UnitBase.h"
+#include "MassEntityQuery.h"
 #include "MassUnitSpawnerSubsystem.generated.h"
 
+struct FMassNewEntityFragments;
+
 /**
  * 
  */
@@ -18,8 +21,20 @@ public:
 	void RegisterUnitForMassCreation(AUnitBase* NewUnit);
 	void GetAndClearPendingUnits(TArray<AUnitBase*>& OutPendingUnits);
 
+	// Creates Mass entities for up to MaxToCreate queued units (<= 0 = all), front of the queue first.
+	// Units sharing an archetype are created with one BatchCreateEntities call and their fragments are filled per chunk.
+	// Handled units are removed from InOutUnits.
+	int32 CreateEntitiesBatched(TArray<TObjectPtr<AUnitBase>>& InOutUnits, int32 MaxToCreate);
+
 	void ResetSystem();
 private:
+	// Resolves the fragments of new unit entities from chunk views and hands them to Fill, one chunk at a time
+	void ForEachNewUnitInChunks(FMassEntityManager& EM, TConstArrayView<FMassEntityHandle> Entities,
+		TFunctionRef<void(FMassEntityHandle, const FMassNewEntityFragments&)> Fill);
+
 	UPROPERTY()
 	TArray<TObjectPtr<AUnitBase>> PendingUnits;
+
+	FMassEntityQuery NewUnitQuery;
+	bool bNewUnitQueryInitialized = false;
 };
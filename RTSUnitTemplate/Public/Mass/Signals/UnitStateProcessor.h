@@ -12,6 +12,7 @@
 #include "Containers/ArrayView.h" // Ensure TConstArrayView/TArrayView is available
 #include "Controller/PlayerController/ExtendedControllerBase.h"
 #include "Delegates/Delegate.h" // <-- Explicitly include this header
+#include "HAL/CriticalSection.h"
 #include "GameModes/ResourceGameMode.h"
 #include "UnitStateProcessor.generated.h"
 
@@ -284,5 +285,76 @@ private:
 	void HandleUpdateFollowMovement(FName SignalName, TArray<FMassEntityHandle>& Entities);
 	UFUNCTION()
 	void HandleCheckFollowAssigned(FName SignalName, TArray<FMassEntityHandle>& Entities);
-		
+
+	// Signal batching: handlers queue their entities, one game thread flush per frame runs the *_GameThread bodies
+	typedef void (UUnitStateProcessor::*FSignalBatchHandler)(FName, TArray<FMassEntityHandle>&);
+
+	struct FPendingSignalBatch
+	{
+		FName SignalName;
+		// nullptr marks where the state change queue runs
+		FSignalBatchHandler Handler = nullptr;
+		// First arrival order, every entity at most once
+		TArray<FMassEntityHandle> Entities;
+		TSet<FMassEntityHandle> QueuedEntities;
+	};
+
+	// State change signals of all kinds share one queue in delivery order. Every distinct signal of an entity runs,
+	// only a repeat of the signal the entity already has queued last is dropped.
+	struct FPendingStateChange
+	{
+		FMassEntityHandle Entity;
+		FName SignalName;
+	};
+
+	// One melee hit; resolved in the signal flush together with all other hits of the frame
+	struct FPendingDamageEvent
+	{
+		FMassEntityHandle Attacker;
+		FMassEntityHandle Target;
+		TWeakObjectPtr<AUnitBase> AttackerUnit;
+		TWeakObjectPtr<AUnitBase> TargetUnit;
+		float Damage = 0.f;
+		bool bMagicDamage = false;
+	};
+
+	// Any thread; with net.RTS.Signals.BatchHandlers=0 posts one game thread task per call instead
+	void QueueSignalBatch(FName SignalName, const TArray<FMassEntityHandle>& Entities, FSignalBatchHandler Handler);
+	// Any thread; ChangeUnitState deliveries in arrival order, an entity's repeated signal is queued once
+	void QueueStateChanges(FName SignalName, const TArray<FMassEntityHandle>& Entities);
+	// Any thread; with net.RTS.Combat.BatchDamage=0 resolves the hit in its own game thread task instead
+	void QueueDamageEvent(const FPendingDamageEvent& DamageEvent);
+	void ScheduleSignalFlush();
+	void FlushSignalBatches();
+	// Game thread; runs ChangeUnitState_GameThread over consecutive entries with the same signal
+	void RunStateChanges(const TArray<FPendingStateChange>& StateChanges, const TArray<FPendingStateChange>& DeliveryLog);
+	// Game thread; groups hits by target, applies armour/shield math per hit and one attribute update per target
+	void ResolveDamageEvents(TArray<FPendingDamageEvent>& DamageEvents);
+	static void ApplyMeleeHitEffects(AUnitBase* Attacker, AUnitBase* Target);
+
+	FCriticalSection PendingSignalBatchesCS;
+	TArray<FPendingSignalBatch> PendingSignalBatches;
+	TArray<FPendingStateChange> PendingStateChanges;
+	// Last signal queued per entity this flush
+	TMap<FMassEntityHandle, FName> PendingLastStateChange;
+	// Every state change delivery, only recorded with net.RTS.Signals.ValidateStateOrder
+	TArray<FPendingStateChange> StateChangeDeliveryLog;
+	TArray<FPendingDamageEvent> PendingDamageEvents;
+	bool bSignalBatchFlushScheduled = false;
+
+	void IdlePatrolSwitcher_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void ChangeUnitState_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void SyncRepairTime_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleStartDead_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleEndDead_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleGetResource_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleReachedBase_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleGetClosestBaseArea_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleSpawnBuildingRequest_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void SyncCastTime_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void SyncUnitBase_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void EndCast_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void SetToUnitStatePlaceholder_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleUpdateFogMask_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
+	void HandleUpdateSelectionCircle_GameThread(FName SignalName, TArray<FMassEntityHandle>& Entities);
 };
\ No newline at end of file
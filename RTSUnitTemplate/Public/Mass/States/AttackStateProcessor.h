@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassEntityTypes.h"
 #include "MassCommonFragments.h"
 // === FÜGE DIESEN INCLUDE HINZU ===
@@ -43,7 +44,7 @@ struct FMassDamageSignalPayload
 
 
 UCLASS()
-class RTSUNITTEMPLATE_API UAttackStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UAttackStateProcessor : public UTimeSlicedStateProcessor
 {
     GENERATED_BODY()
 
@@ -53,16 +54,12 @@ public:
 protected:
     virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
     virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-    virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+    virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
     float ExecutionInterval = 0.1f;
 	
 private:
-    FMassEntityQuery EntityQuery;
-
-    float TimeSinceLastRun = 0.0f;
-    
     // Cached Subsystem Pointer
     UPROPERTY(Transient)
     TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
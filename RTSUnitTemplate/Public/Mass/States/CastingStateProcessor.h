@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "CastingStateProcessor.generated.h"
 
@@ -10,7 +11,7 @@
  * 
  */
 UCLASS()
-class RTSUNITTEMPLATE_API UCastingStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UCastingStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 
@@ -19,11 +20,11 @@ public:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void BeginDestroy() override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 
-	// Split execution into explicit client/server variants like RunStateProcessor
-	void ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
-	void ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
+	// Client and server variants of the chunk function, like RunStateProcessor
+	bool PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
+	bool PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
 	
 	UFUNCTION()
 	void HandleClientSetToPlaceholder(FName SignalName, TArray<FMassEntityHandle>& Entities);
@@ -32,8 +33,6 @@ public:
 	float ExecutionInterval = 0.1f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
 	float TimeSinceLastRun = 0.0f;
 
 	UPROPERTY(Transient)
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "ChaseStateProcessor.generated.h"
 
@@ -17,7 +18,7 @@ struct FMassStatePauseTag; // Zielzustand
 struct FMassStateIdleTag; // Zielzustand
 
 UCLASS()
-class RTSUNITTEMPLATE_API UChaseStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UChaseStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 
@@ -27,19 +28,15 @@ public:
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 
-	void ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
-	void ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
+	bool PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
+	bool PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
 	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
 	float ExecutionInterval = 0.1f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
-	float TimeSinceLastRun = 0.0f;
-
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "DeathStateProcessor.generated.h"
 
@@ -13,7 +14,7 @@ struct FMassVelocityFragment;
 struct FMassActorFragment; // Für Effekte/Destroy
 
 UCLASS()
-class RTSUNITTEMPLATE_API UDeathStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UDeathStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 
@@ -23,11 +24,11 @@ public:
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 	virtual void BeginDestroy() override;
 
-	void ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
-	void ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
+	bool PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
+	bool PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
 
 	UFUNCTION()
 	void HandleRemoveDeadUnit(FName SignalName, TArray<FMassEntityHandle>& Entities);
@@ -36,8 +37,6 @@ protected:
 	float ExecutionInterval = 0.1f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
 	float TimeSinceLastRun = 0.0f;
 
 	UPROPERTY(Transient)
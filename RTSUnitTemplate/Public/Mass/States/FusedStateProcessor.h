@@ -0,0 +1,51 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "FusedStateProcessor.generated.h"
+
+class UTimeSlicedStateProcessor;
+
+/**
+ * Optional replacement for running every time sliced state processor on its own (net.RTS.States.Fused).
+ * Iterates all chunks with an FMassAIStateFragment once per frame and dispatches each chunk through a
+ * table indexed by its archetype, i.e. by its state tag set, to the chunk functions of the matching
+ * state processors. The fragment views of the chunk are bound once and shared by all of them.
+ * State processors that are not due this frame (time slicing) are skipped.
+ * The building state processors are not fused; they have no per entity work.
+ * net.RTS.States.LogTransitions logs every applied state change, to diff the fused and unfused paths.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UFusedStateProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UFusedStateProcessor();
+
+	static bool IsEnabled();
+
+	// Called by UTimeSlicedStateProcessor on initialization and destruction
+	static void RegisterStateProcessor(const FMassEntityManager& EntityManager, UTimeSlicedStateProcessor& StateProcessor);
+	static void UnregisterStateProcessor(UTimeSlicedStateProcessor& StateProcessor);
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	typedef TArray<int32, TInlineAllocator<2>> FStateDispatch;
+
+	// Indices into StateProcessors whose query matches the archetype, built on first use
+	const FStateDispatch& GetDispatch(const FMassArchetypeHandle& Archetype);
+
+	FMassEntityQuery EntityQuery;
+
+	// Snapshot of the registered state processors; the dispatch table indexes into it
+	TArray<TWeakObjectPtr<UTimeSlicedStateProcessor>> StateProcessors;
+	int32 RegistryVersion = INDEX_NONE;
+
+	TMap<FMassArchetypeHandle, FStateDispatch> DispatchByArchetype;
+};
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassCommonTypes.h"
 #include "MassSignalSubsystem.h"
 #include "IdleStateProcessor.generated.h"
@@ -20,7 +21,7 @@ struct FMassStatePatrolTag;
 
 
 UCLASS()
-class RTSUNITTEMPLATE_API UIdleStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UIdleStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 
@@ -30,15 +31,15 @@ public:
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
 	float ExecutionInterval = 0.1f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
-	float TimeSinceLastRun = 0.0f;
+	// Follow assignment throttling (once per second)
+	float FollowTimeSinceLastRun = 0.0f;
+	bool bFollowTickThisCycle = false;
 
 	// --- Konfigurationswerte ---
 	// Besser: Diese Werte aus einem Shared Fragment lesen (z.B. FMassAIConfigSharedFragment)
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "IsAttackedStateProcessor.generated.h"
 
@@ -10,7 +11,7 @@
  * 
  */
 UCLASS()
-class RTSUNITTEMPLATE_API UIsAttackedStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UIsAttackedStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 
@@ -18,14 +19,12 @@ class RTSUNITTEMPLATE_API UIsAttackedStateProcessor : public UMassProcessor
 public:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
 	float ExecutionInterval = 0.1f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
 	float TimeSinceLastRun = 0.0f;
 
 	UPROPERTY(Transient)
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "PatrolIdleStateProcessor.generated.h"
 
@@ -18,7 +19,7 @@ struct FMassStateChaseTag;
 
 
 UCLASS()
-class RTSUNITTEMPLATE_API UPatrolIdleStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UPatrolIdleStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 public:
@@ -26,14 +27,12 @@ public:
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
 	float ExecutionInterval = 0.5f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
 	float TimeSinceLastRun = 0.0f;
 
 	UPROPERTY(Transient)
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "PatrolRandomStateProcessor.generated.h"
 
@@ -18,7 +19,7 @@ struct FMassStateChaseTag;
 class UNavigationSystemV1; // Für Random Point
 
 UCLASS()
-class RTSUNITTEMPLATE_API UPatrolRandomStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UPatrolRandomStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 public:
@@ -26,14 +27,12 @@ public:
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
 	float ExecutionInterval = 0.1f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
 	float TimeSinceLastRun = 0.0f;
 
 	UPROPERTY(Transient)
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "RunStateProcessor.generated.h"
 
@@ -10,7 +11,7 @@
  * 
  */
 UCLASS()
-class RTSUNITTEMPLATE_API URunStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API URunStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 
@@ -19,10 +20,10 @@ public:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
 	
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 
-	void ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
-	void ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
+	bool PrepareClientChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
+	bool PrepareServerChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction);
 
 	
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
@@ -31,10 +32,6 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
 	bool bShowLogs = false;
 private:
-	FMassEntityQuery EntityQuery;
-
-	float TimeSinceLastRun = 0.0f;
-	
 	// Follow movement signal throttling (once per second)
 	float FollowExecutionInterval = 1.0f;
 	float FollowTimeSinceLastRun = 0.0f;
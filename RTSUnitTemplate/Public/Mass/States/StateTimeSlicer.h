@@ -0,0 +1,42 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+
+/**
+ * Spreads the work of a state processor that runs every ExecutionInterval over several frames.
+ * Every entity gets a stable slice (entity index modulo the slice count) and the processor wakes up
+ * every ExecutionInterval / NumSlices to process the next slice. Each entity is therefore still
+ * processed once per ExecutionInterval, so StateTimer += ExecutionInterval keeps its meaning.
+ * The first wake-up is offset by a phase derived from the processor name, so processors sharing
+ * the same interval do not all run on the same frame.
+ * With net.RTS.States.TimeSlices=1 this is the old TimeSinceLastRun gate.
+ */
+struct RTSUNITTEMPLATE_API FMassStateTimeSlicer
+{
+	static constexpr int32 MaxSlices = 32;
+
+	// Phase offset for the first wake-up, usually the processor class name
+	void SetPhase(FName PhaseName);
+
+	// Game thread, once per Execute; returns false when no slice is due this frame
+	bool Advance(float DeltaTime, float ExecutionInterval);
+
+	// Thread safe while processing the chunks of this frame
+	bool ShouldProcess(const FMassEntityHandle& Entity) const
+	{
+		return (DueSliceMask & (1u << (static_cast<uint32>(Entity.Index) % static_cast<uint32>(NumSlices)))) != 0;
+	}
+
+	// True when slice 0 was due this frame, i.e. a new pass over all entities began; for per-interval bookkeeping
+	bool StartedNewCycle() const { return bStartedNewCycle; }
+
+private:
+	float TimeSinceLastSlice = 0.f;
+	float PhaseFraction = 0.f;
+	int32 NumSlices = 0;
+	int32 NextSlice = 0;
+	uint32 DueSliceMask = 0;
+	bool bStartedNewCycle = false;
+};
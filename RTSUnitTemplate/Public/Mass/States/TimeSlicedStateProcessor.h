@@ -0,0 +1,39 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "Mass/States/StateTimeSlicer.h"
+#include "TimeSlicedStateProcessor.generated.h"
+
+/**
+ * Base of the unit state processors (Idle, Run, Chase, Attack, Pause, Casting, IsAttacked, PatrolIdle,
+ * PatrolRandom, Death and the worker states). The building state processors stay plain processors, their
+ * Execute is empty.
+ * A state processor does not iterate its query itself: PrepareChunkFunction runs the time slice gate and
+ * the per frame setup and hands back the work for one chunk. Execute runs that function over EntityQuery,
+ * unless net.RTS.States.Fused is on, in which case UFusedStateProcessor walks all unit chunks once and
+ * dispatches each chunk to the states whose query matches its archetype.
+ */
+UCLASS(Abstract)
+class RTSUNITTEMPLATE_API UTimeSlicedStateProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	// Once per frame; false when nothing is due, otherwise OutChunkFunction processes one chunk matching EntityQuery
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction)
+		PURE_VIRTUAL(UTimeSlicedStateProcessor::PrepareChunkFunction, return false;);
+
+	bool DoesArchetypeMatch(const FMassArchetypeHandle& Archetype) const { return EntityQuery.DoesArchetypeMatchRequirements(Archetype); }
+
+protected:
+	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual void BeginDestroy() override;
+
+	FMassEntityQuery EntityQuery;
+
+	FMassStateTimeSlicer TimeSlicer;
+};
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "Mass/States/TimeSlicedStateProcessor.h"
 #include "MassEntityTypes.h"         // Required for FMassEntityQuery
 #include "MassSignalSubsystem.h"
 #include "GoToResourceExtractionStateProcessor.generated.h"
@@ -15,7 +16,7 @@ struct FMassExecutionContext;
  * Checks for arrival and signals when the unit is close enough.
  */
 UCLASS()
-class RTSUNITTEMPLATE_API UGoToResourceExtractionStateProcessor : public UMassProcessor
+class RTSUNITTEMPLATE_API UGoToResourceExtractionStateProcessor : public UTimeSlicedStateProcessor
 {
 	GENERATED_BODY()
 
@@ -25,16 +26,12 @@ public:
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+	virtual bool PrepareChunkFunction(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassExecuteFunction& OutChunkFunction) override;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
 	float ExecutionInterval = 0.1f;
 	
 private:
-	FMassEntityQuery EntityQuery;
-
-	float TimeSinceLastRun = 0.0f;
-
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
 };
\ No newline at end of file
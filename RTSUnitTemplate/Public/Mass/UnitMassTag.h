@@ -216,6 +216,25 @@ struct FMassWorkerStatsFragment : public FMassFragment
 	bool AutoMining = true;
 };
 
+/** Visibility last applied to the unit actor by UUnitVisibilityProcessor, so actor changes only happen on transitions. */
+USTRUCT()
+struct FMassUnitVisibilityFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
+	bool bInitialized = false;
+
+	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
+	bool bOnViewport = false;
+
+	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
+	bool bCharacterVisible = false;
+
+	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
+	bool bTimerVisible = false;
+};
+
 USTRUCT()
 struct FUnitStateFragment : public FMassFragment
 {
@@ -41,10 +41,25 @@ protected:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
     float ExecutionInterval = 0.1f;
     
+    // Queues a path request; all requests of a frame are grouped and solved together in FlushPathRequests
     void RequestPathfindingAsync(FMassEntityHandle Entity, FVector StartLocation, FVector EndLocation);
     void ResetPathfindingFlagDeferred(FMassEntityHandle Entity);
 
+    // Groups the queued requests by goal cell, collapses identical (start cell, goal cell) pairs and
+    // runs the remaining navmesh queries in a single background task
+    void FlushPathRequests();
+
 private:
+    struct FPendingPathRequest
+    {
+        FMassEntityHandle Entity;
+        FVector StartLocation = FVector::ZeroVector;
+        FVector EndLocation = FVector::ZeroVector;
+        double RequestTime = 0.0;
+    };
+
+    TArray<FPendingPathRequest> PendingPathRequests;
+
     FMassEntityQuery EntityQuery;
 	FMassEntityQuery ClientEntityQuery;
     
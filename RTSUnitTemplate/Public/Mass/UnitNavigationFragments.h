@@ -37,4 +37,16 @@ struct FUnitNavigationPathFragment : public FMassFragment
 	{
 		return CurrentPath.IsValid();
 	}
-};
\ No newline at end of file
+};
+
+/** Navmesh poly the entity was last found on, used by UUnitApplyMassMovementProcessor to skip full projections. */
+USTRUCT()
+struct FUnitNavPolyFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	NavNodeRef PolyRef = INVALID_NAVNODEREF;
+
+	/** Result of the last full projection, reused when the projection budget of a frame is spent. */
+	bool bWasLeavingNavMesh = false;
+};
@@ -0,0 +1,30 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "UnitVisibilityProcessor.generated.h"
+
+/**
+ * Replaces the per-actor visibility work of APerformanceUnit::Tick (viewport projection, fog visibility,
+ * health bar and timer widgets). Builds the view projection once per frame, tests every unit position
+ * against the screen rect and only touches the actor when its visibility changes.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitVisibilityProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UUnitVisibilityProcessor();
+
+	// True while this processor drives unit visibility; APerformanceUnit then skips its own checks
+	static bool IsEnabled();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
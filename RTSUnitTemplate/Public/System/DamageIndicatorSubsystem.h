@@ -0,0 +1,64 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DamageIndicatorSubsystem.generated.h"
+
+class AActor;
+class AIndicatorActor;
+
+/** One damage number waiting for the end of frame flush. */
+struct FDamageIndicatorRequest
+{
+	TWeakObjectPtr<AActor> Target;
+	TSubclassOf<AIndicatorActor> IndicatorClass;
+	FVector Location = FVector::ZeroVector;
+	float Damage = 0.f;
+	FLinearColor HighColor = FLinearColor::White;
+	FLinearColor LowColor = FLinearColor::White;
+	float ColorOffset = 0.f;
+	bool bLocalTeam = false;
+};
+
+/** Indicator currently shown for a target, kept to merge follow-up hits into it. */
+struct FActiveDamageIndicator
+{
+	TWeakObjectPtr<AIndicatorActor> Indicator;
+	double StartTime = 0.0;
+};
+
+/**
+ * Client side pool for damage numbers. Hits are queued during the frame, hits on the same target are
+ * merged into the indicator already shown for it, and at most a fixed number of new indicators appear
+ * per frame with the local player's units first. Indicators are recycled instead of spawned and destroyed.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UDamageIndicatorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RequestIndicator(AActor* Target, TSubclassOf<AIndicatorActor> IndicatorClass, const FVector& Location, float Damage,
+		FLinearColor HighColor, FLinearColor LowColor, float ColorOffset, bool bLocalTeam);
+
+	// Called by pooled indicators once their lifetime ended
+	void ReleaseIndicator(AIndicatorActor* Indicator);
+
+private:
+	AIndicatorActor* AcquireIndicator(TSubclassOf<AIndicatorActor> IndicatorClass);
+	void RemoveActiveByTarget(const AIndicatorActor* Indicator);
+
+	TArray<FDamageIndicatorRequest> PendingRequests;
+
+	TMap<TWeakObjectPtr<AActor>, FActiveDamageIndicator> ActiveByTarget;
+
+	TMap<UClass*, TArray<TWeakObjectPtr<AIndicatorActor>>> FreeIndicators;
+	// Shown indicators, oldest first; the oldest is recycled when the pool is full
+	TArray<TWeakObjectPtr<AIndicatorActor>> ActiveIndicators;
+	int32 NumPooledIndicators = 0;
+};
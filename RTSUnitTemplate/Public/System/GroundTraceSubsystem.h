@@ -0,0 +1,39 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "GroundTraceSubsystem.generated.h"
+
+/**
+ * Ignore list for ground traces on channels units block (AUnitControllerBase::TraceGround).
+ * Holds every unit and work area; the world is scanned once, afterwards the list follows actor spawn/destroy callbacks.
+ * Simple and complex query params are cached separately, so traces bind them by reference instead of copying the list.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UGroundTraceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	const FCollisionQueryParams& GetIgnoreParams(bool bTraceComplex);
+
+	// True for actors already in the ignore list (units and work areas)
+	static bool IsIgnored(const AActor* Actor);
+
+private:
+	void EnsureTracking();
+	void OnActorSpawned(AActor* Actor);
+	void OnActorDestroyed(AActor* Actor);
+
+	TArray<TWeakObjectPtr<AActor>> IgnoredActors;
+	FCollisionQueryParams SimpleParams;
+	FCollisionQueryParams ComplexParams;
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	bool bTracking = false;
+	bool bParamsDirty = true;
+};
@@ -0,0 +1,76 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Core/ActorGridIndex.h"
+#include "Actors/WorkArea.h"
+#include "Characters/Unit/BuildingBase.h"
+#include "PlacementSpatialIndexSubsystem.generated.h"
+
+class USceneComponent;
+enum class EUpdateTransformFlags : int32;
+enum class ETeleportType : uint8;
+
+DECLARE_STATS_GROUP(TEXT("RTS Placement"), STATGROUP_RTSPlacement, STATCAT_Advanced);
+
+/**
+ * Spatial index of the work areas and buildings for placement, snapping and drag code (AExtendedControllerBase).
+ * Both kinds live in a TActorGridIndex with an XY footprint radius per actor. The index follows actor spawn /
+ * destroy callbacks and the root component transform of every tracked actor, so drag frames no longer iterate
+ * the world. Queries are conservative: they return every actor whose footprint can be within the given distance,
+ * callers keep their exact tests on live bounds and get the same results as a full scan.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UPlacementSpatialIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// nullptr when net.RTS.Placement.SpatialIndex is off; callers then iterate the world
+	static UPlacementSpatialIndexSubsystem* GetIfEnabled(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	// Work areas / buildings whose footprint may come within Radius (2D) of Location, in world iteration order
+	void GatherWorkAreasInRadius(const FVector& Location, float Radius, TArray<AWorkArea*>& OutWorkAreas);
+	void GatherBuildingsInRadius(const FVector& Location, float Radius, TArray<ABuildingBase*>& OutBuildings);
+
+	// Work areas whose footprint may cross the XY projection of the segment, i.e. everything a trace along it can hit
+	void GatherWorkAreasAlongSegment(const FVector& Start, const FVector& End, TArray<AWorkArea*>& OutWorkAreas);
+
+	// True if any work area except Ignored is a no build zone
+	bool HasNoBuildZone(const AWorkArea* Ignored);
+
+	// Called by AWorkArea when IsNoBuildZone changes (setter and replication)
+	void NotifyNoBuildZoneChanged(AWorkArea* WorkArea);
+
+private:
+	void EnsureTracking();
+	void FlushDirtyActors();
+
+	void AddActor(AActor* Actor);
+	void RemoveActor(AActor* Actor);
+	void OnActorSpawned(AActor* Actor);
+	void OnActorDestroyed(AActor* Actor);
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	static bool IsTracked(const AActor* Actor);
+	void RefreshNoBuildZone(AWorkArea* WorkArea);
+
+	TActorGridIndex<AWorkArea> WorkAreaIndex;
+	TActorGridIndex<ABuildingBase> BuildingIndex;
+	// Indexed work areas flagged as no build zone, so drag frames do not walk every work area
+	TArray<TWeakObjectPtr<AWorkArea>> NoBuildZones;
+	// Root components we listen to, to unbind on destroy
+	TMap<TObjectKey<AActor>, TWeakObjectPtr<USceneComponent>> BoundRoots;
+	// Spawned since the last query, in spawn order
+	TArray<TWeakObjectPtr<AActor>> PendingActors;
+	// Root transform changed since the last query
+	TSet<TWeakObjectPtr<AActor>> DirtyActors;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	bool bTracking = false;
+};
@@ -0,0 +1,85 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/Queue.h"
+#include "UnitAttributeSyncSubsystem.generated.h"
+
+class AUnitBase;
+class UAbilitySystemComponent;
+struct FGameplayAttribute;
+struct FMassCombatStatsFragment;
+
+/** Attributes mirrored into FMassCombatStatsFragment, one dirty bit each. */
+enum class EUnitSyncedAttribute : uint8
+{
+	Health,
+	Shield,
+	MaxHealth,
+	AttackDamage,
+	Range,
+	RunSpeed,
+	Armor,
+	MagicResistance,
+	Num
+};
+
+/**
+ * Keeps FMassCombatStatsFragment in line with the unit's UAttributeSetBase without copying every attribute
+ * on each SyncUnitBase signal. Registered units report changed attributes through the ability system
+ * component's value change delegates (and UAttributeSetBase's direct Health/Shield setters, which bypass
+ * the component). Changes are pushed into a thread safe queue and drained once per frame: only dirty
+ * attributes are written, read from the attribute set at drain time, so several changes in one frame
+ * cost one write. A full copy runs on registration, spawn, load and level-up.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitAttributeSyncSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// True while attributes are synced by change; otherwise SynchronizeStatsFromActorToFragment copies them every time
+	static bool IsEnabled();
+
+	// Idempotent; binds the attribute delegates and queues a full sync on first registration
+	void RegisterUnit(AUnitBase* Unit);
+	void UnregisterUnit(AUnitBase* Unit);
+
+	// Any thread
+	void QueueAttributeChange(AUnitBase* Unit, EUnitSyncedAttribute Attribute);
+	void QueueFullSync(AUnitBase* Unit);
+
+	// Registers the unit and queues a full sync on the actor's world subsystem if the actor is an AUnitBase and syncing by change is on
+	static void RequestFullSync(AActor* UnitActor);
+
+	// Drains pending changes immediately
+	void Flush();
+
+private:
+	struct FPendingAttributeSync
+	{
+		TWeakObjectPtr<AUnitBase> Unit;
+		uint16 DirtyMask = 0;
+	};
+
+	struct FRegisteredUnit
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		FDelegateHandle Handles[static_cast<int32>(EUnitSyncedAttribute::Num)];
+	};
+
+	static FGameplayAttribute GetGameplayAttribute(EUnitSyncedAttribute Attribute);
+	static void ApplyToFragment(AUnitBase* Unit, uint16 DirtyMask, FMassCombatStatsFragment& CombatStats);
+	// net.RTS.Sync.ValidateAttributes: logs fragment fields that differ from the attribute set
+	static void ValidateFragment(AUnitBase* Unit, const FMassCombatStatsFragment& CombatStats);
+
+	void UnbindUnit(FRegisteredUnit& Registered);
+
+	TQueue<FPendingAttributeSync, EQueueMode::Mpsc> PendingChanges;
+	TMap<TObjectKey<AUnitBase>, FRegisteredUnit> RegisteredUnits;
+};
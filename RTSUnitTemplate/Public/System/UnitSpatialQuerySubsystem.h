@@ -0,0 +1,69 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UnitSpatialQuerySubsystem.generated.h"
+
+class AUnitBase;
+
+/** Per frame snapshot of a unit, as seen by detection queries. */
+struct FUnitSpatialEntry
+{
+	AUnitBase* Unit = nullptr;
+	FVector Location = FVector::ZeroVector;
+	// Index into ARTSGameModeBase::AllUnits, used to return results in the same order as a full scan
+	int32 SourceIndex = INDEX_NONE;
+	bool bIsFlying = false;
+	bool bIsInvisible = false;
+	bool bIsDead = false;
+};
+
+/** Uniform grid over the units of one team. Entries are sorted by cell, each cell maps to a contiguous range. */
+struct FTeamUnitGrid
+{
+	TArray<FUnitSpatialEntry> Entries;
+	TMap<FIntPoint, FIntPoint> CellRanges; // Cell -> (First entry, Num entries)
+};
+
+/** Filter of AUnitControllerBase::DetectUnitsFromGameMode, applied to every candidate in range. */
+struct FUnitDetectionFilter
+{
+	int32 TeamId = 0;
+	bool bFriendly = false;
+	bool bCanDetectInvisible = false;
+	bool bOnlyGround = false;
+	bool bOnlyFlying = false;
+};
+
+/**
+ * Spatial index for the actor based AI (AUnitControllerBase and subclasses).
+ * Unit positions and detection flags from ARTSGameModeBase::AllUnits are bucketed into one grid per team,
+ * rebuilt lazily at most once per frame on the first query, so detection no longer scans every unit per unit.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitSpatialQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Appends all units within Radius of Center that pass Filter, in AllUnits order
+	void QueryUnitsInRadius(const FVector& Center, float Radius, const FUnitDetectionFilter& Filter, TArray<AActor*>& OutUnits);
+
+private:
+	void RebuildIfNeeded();
+
+	FIntPoint ToCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	}
+
+	TMap<int32, FTeamUnitGrid> TeamGrids;
+	uint64 LastBuildFrame = MAX_uint64;
+	float CellSize = 1000.f;
+
+	// Scratch for sorting query results, reused between queries
+	TArray<const FUnitSpatialEntry*> ScratchResults;
+};
@@ -0,0 +1,241 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UnitTweenSubsystem.generated.h"
+
+class AMassUnitBase;
+class UInstancedStaticMeshComponent;
+class USceneComponent;
+
+/** What a tween writes to. */
+enum class EUnitTweenTargetType : uint8
+{
+	// Local transform of one ISM instance
+	ISMInstance,
+	// Relative transform of a scene component
+	Component,
+	// The unit actor itself, synced back to its Mass entity
+	Actor
+};
+
+/** Transform driven by a tween. Every tween belongs to a unit and is dropped when that unit ends play. */
+struct FUnitTweenTarget
+{
+	TWeakObjectPtr<AMassUnitBase> Owner;
+	TWeakObjectPtr<USceneComponent> Component;
+	int32 InstanceIndex = INDEX_NONE;
+	EUnitTweenTargetType Type = EUnitTweenTargetType::Component;
+
+	static FUnitTweenTarget MakeISMInstance(AMassUnitBase* InOwner, UInstancedStaticMeshComponent* InISM, int32 InInstanceIndex);
+	static FUnitTweenTarget MakeComponent(AMassUnitBase* InOwner, USceneComponent* InComponent);
+	static FUnitTweenTarget MakeActor(AMassUnitBase* InOwner);
+};
+
+/** Map key of a tween target; at most one tween of each kind runs per key. */
+struct FUnitTweenKey
+{
+	TWeakObjectPtr<UObject> Object;
+	int32 InstanceIndex = INDEX_NONE;
+
+	FUnitTweenKey() = default;
+	explicit FUnitTweenKey(const FUnitTweenTarget& Target);
+
+	bool operator==(const FUnitTweenKey& Other) const
+	{
+		return Object == Other.Object && InstanceIndex == Other.InstanceIndex;
+	}
+
+	friend uint32 GetTypeHash(const FUnitTweenKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Object), GetTypeHash(Key.InstanceIndex));
+	}
+};
+
+struct FUnitRotationTween
+{
+	FUnitTweenTarget Target;
+	FUnitTweenKey Key;
+	FQuat Start = FQuat::Identity;
+	FQuat End = FQuat::Identity;
+	float Duration = 0.f;
+	float Elapsed = 0.f;
+	float EaseExp = 1.f;
+	bool bTeleport = false;
+};
+
+// Used for both location and scale tweens
+struct FUnitVectorTween
+{
+	FUnitTweenTarget Target;
+	FUnitTweenKey Key;
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	float Duration = 0.f;
+	float Elapsed = 0.f;
+	float EaseExp = 1.f;
+};
+
+// Ping-pong scale between MinScale and MaxScale until stopped
+struct FUnitPulsateTween
+{
+	FUnitTweenTarget Target;
+	FUnitTweenKey Key;
+	FVector MinScale = FVector::OneVector;
+	FVector MaxScale = FVector::OneVector;
+	float HalfPeriod = 1.f;
+	float Elapsed = 0.f;
+};
+
+// Constant yaw rotation until stopped
+struct FUnitSpinTween
+{
+	FUnitTweenTarget Target;
+	FUnitTweenKey Key;
+	float YawRate = 0.f;
+};
+
+// Restarts a rotation tween towards the owner's UnitToChase every frame until stopped
+struct FUnitYawFollow
+{
+	FUnitTweenTarget Target;
+	FUnitTweenKey Key;
+	float Duration = 0.f;
+	float EaseExp = 1.f;
+	float OffsetDegrees = 0.f;
+	bool bTeleport = false;
+};
+
+/** Dense tween storage with one entry per target; finished entries are swap-removed. */
+template<typename TweenType>
+struct TUnitTweenList
+{
+	TArray<TweenType> Tweens;
+	TMap<FUnitTweenKey, int32> IndexByKey;
+
+	int32 Num() const { return Tweens.Num(); }
+
+	TweenType& FindOrAdd(const FUnitTweenTarget& Target)
+	{
+		const FUnitTweenKey Key(Target);
+		if (const int32* Index = IndexByKey.Find(Key))
+		{
+			return Tweens[*Index];
+		}
+
+		TweenType& Tween = Tweens.AddDefaulted_GetRef();
+		Tween.Target = Target;
+		Tween.Key = Key;
+		IndexByKey.Add(Key, Tweens.Num() - 1);
+		return Tween;
+	}
+
+	void Remove(const FUnitTweenTarget& Target)
+	{
+		if (const int32* Index = IndexByKey.Find(FUnitTweenKey(Target)))
+		{
+			RemoveAt(*Index);
+		}
+	}
+
+	void RemoveAt(int32 Index)
+	{
+		IndexByKey.Remove(Tweens[Index].Key);
+		const int32 LastIndex = Tweens.Num() - 1;
+		if (Index != LastIndex)
+		{
+			IndexByKey.Add(Tweens[LastIndex].Key, Index);
+		}
+		Tweens.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+
+	void RemoveOwner(const AMassUnitBase* Owner)
+	{
+		for (int32 Index = Tweens.Num() - 1; Index >= 0; --Index)
+		{
+			if (Tweens[Index].Target.Owner.Get() == Owner)
+			{
+				RemoveAt(Index);
+			}
+		}
+	}
+
+	void Reset()
+	{
+		Tweens.Reset();
+		IndexByKey.Reset();
+	}
+};
+
+/**
+ * Runs the cosmetic tweens started by the AMassUnitBase Multicast*Linear, *YawToChase, PulsateISMScale
+ * and ContinuousUnitRotation RPCs. All tweens live in dense per-kind arrays and are advanced in one pass
+ * per frame instead of one looping timer per actor and kind. ISM instance writes of all tweens are
+ * collected and every touched ISM component marks its render state dirty once per frame.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitTweenSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// True while tweens run here; otherwise AMassUnitBase drives them with its own timers
+	static bool IsEnabled();
+
+	void StartRotation(const FUnitTweenTarget& Target, const FQuat& Start, const FQuat& End, float Duration, float EaseExp, bool bTeleport = false);
+	void StartLocation(const FUnitTweenTarget& Target, const FVector& Start, const FVector& End, float Duration, float EaseExp);
+	void StartScale(const FUnitTweenTarget& Target, const FVector& Start, const FVector& End, float Duration, float EaseExp);
+	void StartPulsate(const FUnitTweenTarget& Target, const FVector& MinScale, const FVector& MaxScale, float HalfPeriod);
+	void StartSpin(const FUnitTweenTarget& Target, float YawRate);
+	void StartYawFollow(const FUnitTweenTarget& Target, float Duration, float EaseExp, float OffsetDegrees, bool bTeleport = false);
+
+	void StopRotation(const FUnitTweenTarget& Target) { RotationTweens.Remove(Target); }
+	void StopScale(const FUnitTweenTarget& Target) { ScaleTweens.Remove(Target); }
+	void StopPulsate(const FUnitTweenTarget& Target) { PulsateTweens.Remove(Target); }
+	void StopSpin(const FUnitTweenTarget& Target) { SpinTweens.Remove(Target); }
+	void StopYawFollow(const FUnitTweenTarget& Target) { YawFollows.Remove(Target); }
+
+	void RemoveTweensForOwner(const AMassUnitBase* Owner);
+
+	int32 GetNumActiveTweens() const;
+
+private:
+	struct FPendingInstanceWrite
+	{
+		TWeakObjectPtr<UInstancedStaticMeshComponent> Component;
+		int32 InstanceIndex = INDEX_NONE;
+		FTransform Transform;
+		bool bTeleport = false;
+	};
+
+	static bool IsTargetValid(const FUnitTweenTarget& Target);
+
+	void UpdateYawFollows();
+	void AdvanceRotations(float DeltaTime);
+	void AdvanceVectors(TUnitTweenList<FUnitVectorTween>& List, float DeltaTime, bool bScale);
+	void AdvancePulsates(float DeltaTime);
+	void AdvanceSpins(float DeltaTime);
+
+	void ApplyRotation(const FUnitTweenTarget& Target, const FQuat& Rotation, bool bTeleport);
+	void ApplyLocation(const FUnitTweenTarget& Target, const FVector& Location);
+	void ApplyScale(const FUnitTweenTarget& Target, const FVector& Scale);
+
+	// Instance transform to modify this frame, read from the component on first access
+	FTransform& GetPendingInstanceTransform(const FUnitTweenTarget& Target, bool bTeleport);
+	void FlushInstanceWrites();
+
+	TUnitTweenList<FUnitRotationTween> RotationTweens;
+	TUnitTweenList<FUnitVectorTween> LocationTweens;
+	TUnitTweenList<FUnitVectorTween> ScaleTweens;
+	TUnitTweenList<FUnitPulsateTween> PulsateTweens;
+	TUnitTweenList<FUnitSpinTween> SpinTweens;
+	TUnitTweenList<FUnitYawFollow> YawFollows;
+
+	TArray<FPendingInstanceWrite> PendingInstanceWrites;
+	TMap<FUnitTweenKey, int32> PendingInstanceIndexByKey;
+};
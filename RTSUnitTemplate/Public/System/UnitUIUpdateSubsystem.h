@@ -0,0 +1,72 @@
+// Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UnitUIUpdateSubsystem.generated.h"
+
+class AUnitBase;
+
+/** UI work collected for one unit during the current frame. */
+struct FPendingUnitUIUpdate
+{
+	TWeakObjectPtr<AUnitBase> Unit;
+
+	// Health at the first change this frame and the latest projected health
+	bool bHealthChanged = false;
+	float FrameStartHealth = 0.f;
+	float LatestHealth = 0.f;
+
+	// Arguments for the collapse checks, first old value and latest new value
+	bool bHealthCollapseCheck = false;
+	float CollapseOldHealth = 0.f;
+	float CollapseNewHealth = 0.f;
+
+	bool bShieldCollapseCheck = false;
+	float CollapseOldShield = 0.f;
+	float CollapseNewShield = 0.f;
+
+	bool bWidgetDirty = false;
+};
+
+/**
+ * Collects health bar refreshes, collapse checks and health threshold events raised by
+ * UAttributeSetBase::PostGameplayEffectExecute and flushes them once per unit at the end of the frame.
+ * A unit hit 20 times in a frame rebuilds its widget once, and threshold crossings are computed
+ * between the health at the start of the frame and the final health.
+ * Units that died before the flush are skipped; lethal hits flush their unit first with FlushUnit.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitUIUpdateSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// True while updates are queued; otherwise callers update the unit directly
+	static bool IsEnabled();
+
+	void QueueHealthChange(AUnitBase* Unit, float OldHealth, float NewHealth);
+	void QueueHealthCollapseCheck(AUnitBase* Unit, float NewHealth, float OldHealth);
+	void QueueShieldCollapseCheck(AUnitBase* Unit, float NewShield, float OldShield);
+	void QueueWidgetUpdate(AUnitBase* Unit);
+
+	// Flushes pending updates immediately
+	void Flush();
+
+	// Flushes the pending updates of one unit, e.g. before its death handling runs
+	void FlushUnit(AUnitBase* Unit);
+
+private:
+	FPendingUnitUIUpdate& FindOrAddPending(AUnitBase* Unit);
+
+	static void FireThresholdCrossings(AUnitBase* Unit, float OldHealth, float NewHealth);
+	static void ApplyUpdate(AUnitBase* Unit, const FPendingUnitUIUpdate& Pending);
+
+	// Insertion ordered so units are flushed in the order they were first touched
+	TArray<FPendingUnitUIUpdate> PendingUpdates;
+	TMap<TObjectKey<AUnitBase>, int32> PendingIndexByUnit;
+};
@@ -34,8 +34,16 @@ public:
 	TObjectPtr<UFont> IndicatorFont;
 	
 	void UpdateIndicator();
+
+	// Restores the freshly constructed look so a pooled indicator can be shown again
+	void ResetIndicator();
+
+	// Pooled indicators stop updating while hidden, ResetIndicator restarts the timer
+	void StopUpdateTimer();
 	
 private:
+
+	ESlateVisibility InitialVisibility = ESlateVisibility::Visible;
 	
 	const float UpdateInterval = 0.5f;
 
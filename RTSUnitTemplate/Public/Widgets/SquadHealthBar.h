@@ -6,6 +6,44 @@
 #include "Widgets/UnitBaseHealthBar.h"
 #include "SquadHealthBar.generated.h"
 
+class AUnitBase;
+
+/** Aggregated health/shield values of one squad, as shown by USquadHealthBar. */
+struct FSquadHealthSnapshot
+{
+	float CurrentHealth = 0.f;
+	float MaxHealth = 0.f;
+	float CurrentShield = 0.f;
+	float MaxShield = 0.f;
+
+	bool Equals(const FSquadHealthSnapshot& Other, float Tolerance = KINDA_SMALL_NUMBER) const
+	{
+		return FMath::IsNearlyEqual(CurrentHealth, Other.CurrentHealth, Tolerance)
+			&& FMath::IsNearlyEqual(MaxHealth, Other.MaxHealth, Tolerance)
+			&& FMath::IsNearlyEqual(CurrentShield, Other.CurrentShield, Tolerance)
+			&& FMath::IsNearlyEqual(MaxShield, Other.MaxShield, Tolerance);
+	}
+};
+
+/**
+ * Per squad health totals, kept up to date incrementally. Each squad member's contribution is
+ * re-evaluated from its Health/Shield attribute-change callbacks, from the direct writes in
+ * UAttributeSetBase::SetAttributeHealth / SetAttributeShield (no callback fires for those), on squad assignment
+ * (AUnitBase::EnsureSquadHealthbarState), on death and removed on EndPlay, so reading a
+ * squad total is a single map lookup instead of a walk over all units.
+ */
+struct RTSUNITTEMPLATE_API FSquadHealthRegistry
+{
+	// Re-evaluates the unit's contribution; handles squad join/leave, death and attribute changes
+	static void UpdateUnit(AUnitBase* Unit);
+	static void RemoveUnit(AUnitBase* Unit);
+
+	static void GetSnapshot(const AUnitBase* SquadMember, FSquadHealthSnapshot& OutSnapshot);
+
+	// Reference implementation walking all units of the world, used to validate the aggregates
+	static void ComputeBruteForce(const AUnitBase* SquadMember, FSquadHealthSnapshot& OutSnapshot);
+};
+
 /**
  * A squad-level health bar that aggregates health across all units in the same squad.
  * It inherits from UUnitBaseHealthBar to reuse bindings and visibility behavior.
@@ -24,4 +62,8 @@ public:
 
 private:
 	void ComputeSquadHealth(float& OutCurrentHealth, float& OutMaxHealth, float& OutCurrentShield, float& OutMaxShield) const;
+
+	// Last values pushed to the bars; the health part is only redrawn when the aggregate changes
+	FSquadHealthSnapshot LastDrawnSnapshot;
+	bool bHasDrawnSnapshot = false;
 };
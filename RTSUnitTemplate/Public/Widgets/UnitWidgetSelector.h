@@ -12,10 +12,15 @@
 
 #include "UnitWidgetSelector.generated.h"
 
+struct FOnAttributeChangeData;
+
 class UButton;
+class UAbilitySystemComponent;
+class UAttributeSetBase;
 class UUniformGridPanel;
 class UPanelWidget;
 class UCanvasPanel;
+class UTexture2D;
 
 UCLASS()
 class RTSUNITTEMPLATE_API UUnitWidgetSelector : public UUserWidget
@@ -24,6 +29,7 @@ class RTSUNITTEMPLATE_API UUnitWidgetSelector : public UUserWidget
 	 
 	
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 	//void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
@@ -210,6 +216,48 @@ public:
 	// Clears all spawned unit cards
 	UFUNCTION(BlueprintCallable, Category = "RTSUnitTemplate|UnitCards")
 	void ClearUnitCards();
+
+private:
+	struct FUnitCardHealthBinding
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		FDelegateHandle HealthHandle;
+		FDelegateHandle MaxHealthHandle;
+		// Damage, heal and regen write Health/Shield directly, without the change delegates above
+		TWeakObjectPtr<UAttributeSetBase> Attributes;
+		FDelegateHandle DirectWriteHandle;
+	};
+
+	// Creates MaxUnitCards cards once; afterwards cards are only shown or collapsed
+	void EnsureUnitCardPool();
+	void SetActiveUnitCardCount(int32 Count);
+	void SetCardIcon(int32 CardIndex, UTexture2D* Icon);
+
+	// Returns true when the selection differs from the one the cards were last built for
+	bool RefreshSelectionSignature();
+	void UpdateHealthBindings();
+	void UnbindAllHealthBindings();
+	void OnSelectedUnitHealthChanged(const FOnAttributeChangeData& Data);
+	void OnSelectedUnitDirectHealthWrite(UAttributeSetBase* AttributeSet);
+	static void UnbindHealthBinding(const FUnitCardHealthBinding& Binding);
+
+	bool bUnitCardPoolBuilt = false;
+	bool bUnitCardPoolGrouped = false;
+	int32 ActiveUnitCardCount = 0;
+	ESlateVisibility UnitCardShownVisibility = ESlateVisibility::Visible;
+
+	// Last applied state per pooled card, used to skip cards that did not change
+	TArray<TWeakObjectPtr<AUnitBase>> CardDisplayedUnits;
+	TArray<int32> CardDisplayedCounts;
+	TArray<float> CardDisplayedHealth;
+
+	uint32 LastSelectionSignature = 0;
+	int32 LastSelectionCount = INDEX_NONE;
+	bool bUnitCardHealthDirty = true;
+
+	TMap<TWeakObjectPtr<AUnitBase>, FUnitCardHealthBinding> HealthBindings;
+
+public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
 	TArray<class USelectorButton*> SingleSelectButtons;